@@ -74,6 +74,11 @@ namespace Spect.Net.Assembler.Assembler
         /// </summary>
         public List<ListFileItem> ListFileItems { get; }
 
+        /// <summary>
+        /// Phase timings and counters of the compilation
+        /// </summary>
+        public AssemblerStatistics Statistics { get; } = new AssemblerStatistics();
+
         /// <summary>Initializes a new instance of the <see cref="T:System.Object" /> class.</summary>
         public AssemblerOutput(SourceFileItem sourceItem)
         {
@@ -0,0 +1,142 @@
+﻿using System;
+using System.Diagnostics;
+
+namespace Spect.Net.Assembler.Assembler
+{
+    /// <summary>
+    /// This class stores the phase timings and counters of a single compilation
+    /// </summary>
+    public class AssemblerStatistics
+    {
+        /// <summary>
+        /// Time spent with ANTLR lexing, parsing, and visiting the syntax tree
+        /// (including included files)
+        /// </summary>
+        public TimeSpan ParseTime { get; private set; }
+
+        /// <summary>
+        /// Time spent with processing directives (#if, #define, #include, etc.)
+        /// and the .model pragma, excluding the parsing of included files
+        /// </summary>
+        public TimeSpan DirectiveTime { get; private set; }
+
+        /// <summary>
+        /// Time spent with code emission, including macro expansion
+        /// </summary>
+        public TimeSpan EmitTime { get; private set; }
+
+        /// <summary>
+        /// Time spent with the final symbol fixup phase
+        /// </summary>
+        public TimeSpan FixupTime { get; private set; }
+
+        /// <summary>
+        /// Time spent with executing the COMPAREBIN pragmas
+        /// </summary>
+        public TimeSpan CompareTime { get; private set; }
+
+        /// <summary>
+        /// The total time of the compilation
+        /// </summary>
+        public TimeSpan TotalTime { get; private set; }
+
+        /// <summary>
+        /// Number of source lines passed to the code emission phase
+        /// </summary>
+        public int SourceLines { get; set; }
+
+        /// <summary>
+        /// Number of source files parsed (including the main file)
+        /// </summary>
+        public int ParsedFiles { get; set; }
+
+        /// <summary>
+        /// Number of macro invocations expanded
+        /// </summary>
+        public int MacrosExpanded { get; set; }
+
+        /// <summary>
+        /// Number of structure invocations processed
+        /// </summary>
+        public int StructsInvoked { get; set; }
+
+        /// <summary>
+        /// Number of fixup entries recorded during code emission
+        /// </summary>
+        public int FixupsRecorded { get; set; }
+
+        /// <summary>
+        /// Number of bytes emitted into the output segments
+        /// </summary>
+        public int EmittedBytes { get; set; }
+
+        /// <summary>
+        /// Bytes allocated in the current AppDomain during the compilation.
+        /// </summary>
+        /// <remarks>
+        /// This value is available only when AppDomain resource monitoring is
+        /// turned on (AppDomain.MonitoringIsEnabled); otherwise, it is null.
+        /// </remarks>
+        public long? AllocatedBytes { get; set; }
+
+        /// <summary>
+        /// Number of garbage collections (all generations) during the compilation
+        /// </summary>
+        public int GcCount { get; set; }
+
+        /// <summary>
+        /// Adds the specified number of Stopwatch ticks to the parse time
+        /// </summary>
+        internal void AddParseTicks(long ticks)
+            => ParseTime += ToTimeSpan(ticks);
+
+        /// <summary>
+        /// Sets the directive processing time from the whole parse phase
+        /// </summary>
+        /// <param name="ticks">Stopwatch ticks of the whole parse phase</param>
+        internal void SetParsePhaseTicks(long ticks)
+        {
+            var directiveTime = ToTimeSpan(ticks) - ParseTime;
+            DirectiveTime = directiveTime < TimeSpan.Zero ? TimeSpan.Zero : directiveTime;
+        }
+
+        /// <summary>
+        /// Sets the emit phase time
+        /// </summary>
+        internal void SetEmitTicks(long ticks) => EmitTime = ToTimeSpan(ticks);
+
+        /// <summary>
+        /// Sets the fixup phase time
+        /// </summary>
+        internal void SetFixupTicks(long ticks) => FixupTime = ToTimeSpan(ticks);
+
+        /// <summary>
+        /// Sets the COMPAREBIN phase time
+        /// </summary>
+        internal void SetCompareTicks(long ticks) => CompareTime = ToTimeSpan(ticks);
+
+        /// <summary>
+        /// Sets the total compilation time
+        /// </summary>
+        internal void SetTotalTicks(long ticks) => TotalTime = ToTimeSpan(ticks);
+
+        /// <summary>
+        /// Returns a string that represents the current object.
+        /// </summary>
+        public override string ToString()
+        {
+            return $"Total: {TotalTime.TotalMilliseconds:F2}ms (parse: {ParseTime.TotalMilliseconds:F2}ms, "
+                + $"directives: {DirectiveTime.TotalMilliseconds:F2}ms, emit: {EmitTime.TotalMilliseconds:F2}ms, "
+                + $"fixup: {FixupTime.TotalMilliseconds:F2}ms, compare: {CompareTime.TotalMilliseconds:F2}ms); "
+                + $"lines: {SourceLines}, files: {ParsedFiles}, macros: {MacrosExpanded}, structs: {StructsInvoked}, "
+                + $"fixups: {FixupsRecorded}, bytes: {EmittedBytes}, GCs: {GcCount}"
+                + (AllocatedBytes.HasValue ? $", allocated: {AllocatedBytes.Value}" : "");
+        }
+
+        /// <summary>
+        /// Converts Stopwatch ticks to a TimeSpan
+        /// </summary>
+        private static TimeSpan ToTimeSpan(long ticks)
+            => TimeSpan.FromTicks((long)(ticks * ((double)TimeSpan.TicksPerSecond / Stopwatch.Frequency)));
+    }
+}
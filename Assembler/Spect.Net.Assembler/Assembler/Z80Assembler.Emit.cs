@@ -1752,6 +1752,7 @@ namespace Spect.Net.Assembler.Assembler
                 arguments.Add(macroDef.ArgumentNames[i], argValue);
             }
             if (errorFound) return;
+            Output.Statistics.MacrosExpanded++;
 
             // --- Create a scope for the macro
             var macroScope = new SymbolScope
@@ -1914,6 +1915,7 @@ namespace Spect.Net.Assembler.Assembler
             {
                 ReportError(Errors.Z0439, structStmt, structStmt.Name);
             }
+            Output.Statistics.StructsInvoked++;
 
             // --- Store the structure start offset so that we can use it later for fixup.
             EnsureCodeSegment();
@@ -303,6 +303,7 @@ namespace Spect.Net.Assembler.Assembler
             var fixup = new FixupEntry(this, CurrentModule, opLine, type, Output.Segments.Count - 1,
                 offset ?? fixupOffset,
                 expression, label, structeBytes);
+            Output.Statistics.FixupsRecorded++;
 
             // --- Record fixups in every local scope up to the root
             foreach (var scope in CurrentModule.LocalScopes)
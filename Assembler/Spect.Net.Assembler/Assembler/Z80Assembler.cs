@@ -1,5 +1,6 @@
 ﻿using System;
 using System.Collections.Generic;
+using System.Diagnostics;
 using System.IO;
 using System.Linq;
 using Antlr4.Runtime;
@@ -140,12 +141,19 @@ namespace Spect.Net.Assembler.Assembler
             ConditionSymbols = new HashSet<string>(_options.PredefinedSymbols);
             CurrentModule = Output = new AssemblerOutput(sourceItem);
             CompareBins = new List<BinaryComparisonInfo>();
+            var stats = Output.Statistics;
+            var gcCountStart = GetGcCount();
+            var allocatedStart = AppDomain.MonitoringIsEnabled
+                ? AppDomain.CurrentDomain.MonitoringTotalAllocatedMemorySize
+                : 0L;
+            var compileStart = Stopwatch.GetTimestamp();
 
             // --- Do the compilation phases
-            if (!ExecuteParse(0, sourceItem, sourceText, out var lines)
-                || !EmitCode(lines)
-                || !FixupSymbols()
-                || !CompareBinaries())
+            var lines = new List<SourceLineBase>();
+            if (!RunPhase(() => ExecuteParse(0, sourceItem, sourceText, out lines), stats.SetParsePhaseTicks)
+                || !RunPhase(() => EmitCode(lines), stats.SetEmitTicks)
+                || !RunPhase(FixupSymbols, stats.SetFixupTicks)
+                || !RunPhase(CompareBinaries, stats.SetCompareTicks))
             {
                 // --- Compilation failed, remove segments
                 Output.Segments.Clear();
@@ -154,9 +162,47 @@ namespace Spect.Net.Assembler.Assembler
 
             // --- Create symbol map
             Output.CreateSymbolMap();
+
+            // --- Complete the statistics
+            stats.SetTotalTicks(Stopwatch.GetTimestamp() - compileStart);
+            stats.SourceLines = lines.Count;
+            stats.EmittedBytes = Output.Segments.Sum(s => s.EmittedCode.Count);
+            stats.GcCount = GetGcCount() - gcCountStart;
+            if (AppDomain.MonitoringIsEnabled)
+            {
+                stats.AllocatedBytes = AppDomain.CurrentDomain.MonitoringTotalAllocatedMemorySize
+                    - allocatedStart;
+            }
             return Output;
         }
 
+        /// <summary>
+        /// Executes the specified compilation phase and measures its time
+        /// </summary>
+        /// <param name="phase">Compilation phase to execute</param>
+        /// <param name="storeTicks">Action that stores the elapsed Stopwatch ticks</param>
+        /// <returns>The result of the phase</returns>
+        private static bool RunPhase(Func<bool> phase, Action<long> storeTicks)
+        {
+            var start = Stopwatch.GetTimestamp();
+            var result = phase();
+            storeTicks(Stopwatch.GetTimestamp() - start);
+            return result;
+        }
+
+        /// <summary>
+        /// Gets the number of garbage collections so far
+        /// </summary>
+        private static int GetGcCount()
+        {
+            var count = 0;
+            for (var i = 0; i <= GC.MaxGeneration; i++)
+            {
+                count += GC.CollectionCount(i);
+            }
+            return count;
+        }
+
         #region Parsing and Directive processing
 
         /// <summary>
@@ -174,6 +220,7 @@ namespace Spect.Net.Assembler.Assembler
             parsedLines = new List<SourceLineBase>();
 
             // --- Parse all source code lines
+            var parseStart = Stopwatch.GetTimestamp();
             var inputStream = new AntlrInputStream(sourceText);
             var lexer = new Z80AsmLexer(inputStream);
             var tokenStream = new CommonTokenStream(lexer);
@@ -182,6 +229,8 @@ namespace Spect.Net.Assembler.Assembler
             var visitor = new Z80AsmVisitor(inputStream);
             visitor.Visit(context);
             var visitedLines = visitor.Compilation;
+            Output.Statistics.AddParseTicks(Stopwatch.GetTimestamp() - parseStart);
+            Output.Statistics.ParsedFiles++;
 
             // --- Store any tasks defined by the user
             StoreTasks(sourceItem, visitedLines.Lines);
@@ -0,0 +1,151 @@
+﻿using System.Collections.Generic;
+
+namespace Spect.Net.EvalParser.SyntaxTree
+{
+    /// <summary>
+    /// This class represents the machine state an expression depends on
+    /// </summary>
+    /// <remarks>
+    /// Registers and flags are collected from every branch of the expression,
+    /// so the set is a superset of what a single evaluation reads. Memory
+    /// addresses are known in advance only when the address expression is
+    /// constant; otherwise, the expression has computed addresses.
+    /// </remarks>
+    public class ExpressionDependencies
+    {
+        private readonly List<ushort> _memoryAddresses = new List<ushort>();
+
+        /// <summary>
+        /// Names of the registers the expression reads (lowercase)
+        /// </summary>
+        public HashSet<string> Registers { get; } = new HashSet<string>();
+
+        /// <summary>
+        /// Names of the flags the expression reads (lowercase)
+        /// </summary>
+        public HashSet<string> Flags { get; } = new HashSet<string>();
+
+        /// <summary>
+        /// Memory addresses read through constant address expressions
+        /// </summary>
+        public IReadOnlyList<ushort> MemoryAddresses => _memoryAddresses;
+
+        /// <summary>
+        /// Indicates that the expression reads memory through an address that
+        /// depends on registers, flags, symbols, or memory
+        /// </summary>
+        public bool HasComputedAddresses { get; private set; }
+
+        /// <summary>
+        /// Indicates that the expression uses symbols
+        /// </summary>
+        public bool UsesSymbols { get; private set; }
+
+        /// <summary>
+        /// Indicates that the expression does not depend on the machine state
+        /// </summary>
+        public bool IsConstant => Registers.Count == 0 && Flags.Count == 0
+            && _memoryAddresses.Count == 0 && !HasComputedAddresses && !UsesSymbols;
+
+        /// <summary>
+        /// Collects the dependencies of the specified expression
+        /// </summary>
+        /// <param name="expression">Expression to analyze</param>
+        /// <returns>Dependencies of the expression</returns>
+        public static ExpressionDependencies Collect(ExpressionNode expression)
+        {
+            var dependencies = new ExpressionDependencies();
+            dependencies.Visit(expression);
+            return dependencies;
+        }
+
+        /// <summary>
+        /// Collects the dependencies of the specified node and its children
+        /// </summary>
+        private void Visit(ExpressionNode node)
+        {
+            switch (node)
+            {
+                case Z80RegisterNode registerNode:
+                    if (registerNode.Register != null)
+                    {
+                        Registers.Add(registerNode.Register.ToLower());
+                    }
+                    break;
+
+                case Z80FlagNode flagNode:
+                    if (flagNode.Flag != null)
+                    {
+                        Flags.Add(flagNode.Flag.ToLower());
+                    }
+                    break;
+
+                case SymbolNode _:
+                    UsesSymbols = true;
+                    break;
+
+                case MemoryIndirectNode memoryNode:
+                    VisitMemory(memoryNode);
+                    break;
+
+                case UnaryExpressionNode unaryNode:
+                    Visit(unaryNode.Operand);
+                    break;
+
+                case BinaryOperationNode binaryNode:
+                    Visit(binaryNode.LeftOperand);
+                    Visit(binaryNode.RightOperand);
+                    break;
+
+                case ConditionalExpressionNode conditionalNode:
+                    Visit(conditionalNode.Condition);
+                    Visit(conditionalNode.TrueExpression);
+                    Visit(conditionalNode.FalseExpression);
+                    break;
+            }
+        }
+
+        /// <summary>
+        /// Collects the dependencies of a memory indirection
+        /// </summary>
+        private void VisitMemory(MemoryIndirectNode memoryNode)
+        {
+            var addressDependencies = Collect(memoryNode.Address);
+            if (!addressDependencies.IsConstant)
+            {
+                // --- The address is known only at evaluation time
+                Registers.UnionWith(addressDependencies.Registers);
+                Flags.UnionWith(addressDependencies.Flags);
+                UsesSymbols |= addressDependencies.UsesSymbols;
+                HasComputedAddresses = true;
+                return;
+            }
+
+            // --- A constant address expression does not use the evaluation context
+            var address = memoryNode.Address.Evaluate(null);
+            if (!address.IsValid) return;
+
+            int length;
+            switch (memoryNode.WidthSpecifier)
+            {
+                case "W":
+                    length = 2;
+                    break;
+                case "DW":
+                    length = 4;
+                    break;
+                default:
+                    length = 1;
+                    break;
+            }
+            for (var i = 0; i < length; i++)
+            {
+                var memAddress = (ushort)(address.Value + i);
+                if (!_memoryAddresses.Contains(memAddress))
+                {
+                    _memoryAddresses.Add(memAddress);
+                }
+            }
+        }
+    }
+}
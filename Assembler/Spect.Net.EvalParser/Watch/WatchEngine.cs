@@ -0,0 +1,396 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using Spect.Net.EvalParser.SyntaxTree;
+
+namespace Spect.Net.EvalParser.Watch
+{
+    /// <summary>
+    /// This class evaluates registered watch expressions and publishes the
+    /// changed values in a single batch.
+    /// </summary>
+    /// <remarks>
+    /// Each expression keeps the register, flag, and memory values it has been
+    /// evaluated with. An expression is evaluated again only when any of these
+    /// values has changed. Registers and flags come from the expression tree;
+    /// memory addresses come from the tree when the address is constant, or
+    /// from the last evaluation when the address is computed. As the computed
+    /// addresses depend only on the tracked values, they cannot change while
+    /// those values do not. Symbols are not tracked; call Invalidate when the
+    /// symbol table changes.
+    /// The machine calls Evaluate at frame boundaries or, when TactInterval is
+    /// set, at the specified tact interval. The ValuesChanged event is raised
+    /// on the thread of the evaluation.
+    /// </remarks>
+    public class WatchEngine
+    {
+        // --- Stored instead of the value of a register or flag that cannot be read
+        private const uint ERROR_VALUE = 0xFFFF_FFFF;
+
+        private readonly object _locker = new object();
+        private readonly List<WatchEntry> _entries = new List<WatchEntry>();
+        private readonly Dictionary<string, uint> _registerSnapshot = new Dictionary<string, uint>();
+        private readonly Dictionary<string, uint> _flagSnapshot = new Dictionary<string, uint>();
+        private readonly List<WatchValueChange> _changes = new List<WatchValueChange>();
+        private readonly RecordingContext _recordingContext;
+        private int _nextId = 1;
+        private long _tactInterval;
+
+        /// <summary>
+        /// The context the expressions are evaluated in
+        /// </summary>
+        public IExpressionEvaluationContext EvalContext { get; }
+
+        /// <summary>
+        /// Number of CPU tacts between two evaluations. Zero means evaluation
+        /// at frame boundaries.
+        /// </summary>
+        public long TactInterval
+        {
+            get => _tactInterval;
+            set
+            {
+                _tactInterval = value < 0 ? 0 : value;
+                NextEvaluationTact = _tactInterval > 0 ? 0 : long.MaxValue;
+            }
+        }
+
+        /// <summary>
+        /// The CPU tact when the next interval evaluation is due
+        /// </summary>
+        public long NextEvaluationTact { get; private set; } = long.MaxValue;
+
+        /// <summary>
+        /// Number of registered watch expressions
+        /// </summary>
+        public int Count
+        {
+            get
+            {
+                lock (_locker)
+                {
+                    return _entries.Count;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Number of expressions evaluated in the last pass
+        /// </summary>
+        public int LastEvaluatedCount { get; private set; }
+
+        /// <summary>
+        /// Number of expressions skipped in the last pass
+        /// </summary>
+        public int LastSkippedCount { get; private set; }
+
+        /// <summary>
+        /// This event is raised when any of the watch values has changed
+        /// </summary>
+        public event EventHandler<WatchValuesChangedEventArgs> ValuesChanged;
+
+        /// <summary>
+        /// Initializes the engine with the specified context
+        /// </summary>
+        /// <param name="evalContext">Context to evaluate the expressions in</param>
+        public WatchEngine(IExpressionEvaluationContext evalContext)
+        {
+            EvalContext = evalContext;
+            _recordingContext = new RecordingContext(evalContext);
+        }
+
+        /// <summary>
+        /// Registers a new watch expression
+        /// </summary>
+        /// <param name="expression">Expression to watch</param>
+        /// <returns>The ID of the watch expression</returns>
+        public int Add(ExpressionNode expression)
+        {
+            if (expression == null)
+            {
+                throw new ArgumentNullException(nameof(expression));
+            }
+            lock (_locker)
+            {
+                var entry = new WatchEntry(_nextId++, expression);
+                _entries.Add(entry);
+                return entry.Id;
+            }
+        }
+
+        /// <summary>
+        /// Removes the specified watch expression
+        /// </summary>
+        /// <param name="id">ID of the watch expression</param>
+        /// <returns>True, if the expression has been removed</returns>
+        public bool Remove(int id)
+        {
+            lock (_locker)
+            {
+                return _entries.RemoveAll(e => e.Id == id) > 0;
+            }
+        }
+
+        /// <summary>
+        /// Removes all watch expressions
+        /// </summary>
+        public void Clear()
+        {
+            lock (_locker)
+            {
+                _entries.Clear();
+            }
+        }
+
+        /// <summary>
+        /// Forces the evaluation of all expressions in the next pass
+        /// </summary>
+        public void Invalidate()
+        {
+            lock (_locker)
+            {
+                foreach (var entry in _entries)
+                {
+                    entry.IsDirty = true;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Signs that the machine has completed a frame
+        /// </summary>
+        /// <param name="tacts">Current CPU tacts</param>
+        public void OnFrameCompleted(long tacts)
+        {
+            if (_tactInterval == 0)
+            {
+                Evaluate(tacts);
+            }
+        }
+
+        /// <summary>
+        /// Evaluates the expressions whose dependencies have changed, and raises
+        /// the ValuesChanged event with the changed values
+        /// </summary>
+        /// <param name="tacts">Current CPU tacts</param>
+        /// <returns>The changed values</returns>
+        public IReadOnlyList<WatchValueChange> Evaluate(long tacts = 0)
+        {
+            WatchValueChange[] changes;
+            lock (_locker)
+            {
+                NextEvaluationTact = _tactInterval > 0 ? tacts + _tactInterval : long.MaxValue;
+                _registerSnapshot.Clear();
+                _flagSnapshot.Clear();
+                _changes.Clear();
+                var evaluated = 0;
+                foreach (var entry in _entries)
+                {
+                    if (!HasChanged(entry)) continue;
+                    evaluated++;
+                    EvaluateEntry(entry);
+                }
+                LastEvaluatedCount = evaluated;
+                LastSkippedCount = _entries.Count - evaluated;
+                if (_changes.Count == 0) return Array.Empty<WatchValueChange>();
+                changes = _changes.ToArray();
+            }
+            ValuesChanged?.Invoke(this, new WatchValuesChangedEventArgs(changes, tacts));
+            return changes;
+        }
+
+        /// <summary>
+        /// Checks if any of the values the entry depends on has changed
+        /// </summary>
+        private bool HasChanged(WatchEntry entry)
+        {
+            if (entry.IsDirty) return true;
+            for (var i = 0; i < entry.Registers.Length; i++)
+            {
+                if (GetRegister(entry.Registers[i]) != entry.RegisterValues[i]) return true;
+            }
+            for (var i = 0; i < entry.Flags.Length; i++)
+            {
+                if (GetFlag(entry.Flags[i]) != entry.FlagValues[i]) return true;
+            }
+            for (var i = 0; i < entry.MemoryAddresses.Length; i++)
+            {
+                if (ReadMemory(entry.MemoryAddresses[i]) != entry.MemoryValues[i]) return true;
+            }
+            return false;
+        }
+
+        /// <summary>
+        /// Evaluates the expression, stores its dependency values, and records
+        /// the change, if there is any
+        /// </summary>
+        private void EvaluateEntry(WatchEntry entry)
+        {
+            ExpressionValue value;
+            _recordingContext.StartRecording();
+            try
+            {
+                value = entry.Expression.Evaluate(_recordingContext);
+            }
+            catch
+            {
+                // --- This exception is intentionally ignored. We try again in the next pass.
+                entry.IsDirty = true;
+                return;
+            }
+
+            // --- Store the values the expression has been evaluated with
+            for (var i = 0; i < entry.Registers.Length; i++)
+            {
+                entry.RegisterValues[i] = GetRegister(entry.Registers[i]);
+            }
+            for (var i = 0; i < entry.Flags.Length; i++)
+            {
+                entry.FlagValues[i] = GetFlag(entry.Flags[i]);
+            }
+            if (entry.Dependencies.HasComputedAddresses)
+            {
+                entry.SetMemoryAddresses(_recordingContext.ReadAddresses);
+            }
+            for (var i = 0; i < entry.MemoryAddresses.Length; i++)
+            {
+                entry.MemoryValues[i] = ReadMemory(entry.MemoryAddresses[i]);
+            }
+
+            // --- Record the change
+            var valueType = entry.Expression.ValueType;
+            var error = value == ExpressionValue.Error ? entry.Expression.EvaluationError : null;
+            var isSame = !entry.IsFirst
+                && entry.HasError == (value == ExpressionValue.Error)
+                && (entry.HasError || entry.LastValue == value.Value)
+                && entry.LastValueType == valueType
+                && entry.LastError == error;
+            entry.IsDirty = false;
+            entry.IsFirst = false;
+            entry.HasError = value == ExpressionValue.Error;
+            entry.LastValue = value.Value;
+            entry.LastValueType = valueType;
+            entry.LastError = error;
+            if (!isSame)
+            {
+                _changes.Add(new WatchValueChange(entry.Id, value, valueType, error));
+            }
+        }
+
+        /// <summary>
+        /// Gets the value of the specified register in the current pass
+        /// </summary>
+        private uint GetRegister(string register)
+        {
+            if (_registerSnapshot.TryGetValue(register, out var value)) return value;
+            var regValue = EvalContext.GetZ80RegisterValue(register, out _);
+            value = regValue.IsValid ? regValue.Value : ERROR_VALUE;
+            _registerSnapshot[register] = value;
+            return value;
+        }
+
+        /// <summary>
+        /// Gets the value of the specified flag in the current pass
+        /// </summary>
+        private uint GetFlag(string flag)
+        {
+            if (_flagSnapshot.TryGetValue(flag, out var value)) return value;
+            var flagValue = EvalContext.GetZ80FlagValue(flag);
+            value = flagValue.IsValid ? flagValue.Value : ERROR_VALUE;
+            _flagSnapshot[flag] = value;
+            return value;
+        }
+
+        /// <summary>
+        /// Reads the memory at the specified address
+        /// </summary>
+        private byte ReadMemory(ushort address)
+            => (byte)EvalContext.GetMemoryIndirectValue(new ExpressionValue(address)).Value;
+
+        /// <summary>
+        /// This class stores a watch expression with the values it has been
+        /// evaluated with
+        /// </summary>
+        private class WatchEntry
+        {
+            public readonly int Id;
+            public readonly ExpressionNode Expression;
+            public readonly ExpressionDependencies Dependencies;
+            public readonly string[] Registers;
+            public readonly uint[] RegisterValues;
+            public readonly string[] Flags;
+            public readonly uint[] FlagValues;
+            public ushort[] MemoryAddresses;
+            public byte[] MemoryValues;
+            public bool IsDirty = true;
+            public bool IsFirst = true;
+            public bool HasError;
+            public uint LastValue;
+            public ExpressionValueType LastValueType;
+            public string LastError;
+
+            public WatchEntry(int id, ExpressionNode expression)
+            {
+                Id = id;
+                Expression = expression;
+                Dependencies = ExpressionDependencies.Collect(expression);
+                Registers = Dependencies.Registers.ToArray();
+                RegisterValues = new uint[Registers.Length];
+                Flags = Dependencies.Flags.ToArray();
+                FlagValues = new uint[Flags.Length];
+                SetMemoryAddresses(Dependencies.MemoryAddresses);
+            }
+
+            public void SetMemoryAddresses(IReadOnlyList<ushort> addresses)
+            {
+                if (MemoryAddresses == null || MemoryAddresses.Length != addresses.Count)
+                {
+                    MemoryAddresses = new ushort[addresses.Count];
+                    MemoryValues = new byte[addresses.Count];
+                }
+                for (var i = 0; i < addresses.Count; i++)
+                {
+                    MemoryAddresses[i] = addresses[i];
+                }
+            }
+        }
+
+        /// <summary>
+        /// This context forwards the calls to the evaluation context, and
+        /// records the memory addresses read
+        /// </summary>
+        private class RecordingContext : IExpressionEvaluationContext
+        {
+            private readonly IExpressionEvaluationContext _context;
+            private readonly List<ushort> _readAddresses = new List<ushort>();
+
+            public IReadOnlyList<ushort> ReadAddresses => _readAddresses;
+
+            public RecordingContext(IExpressionEvaluationContext context)
+            {
+                _context = context;
+            }
+
+            public void StartRecording() => _readAddresses.Clear();
+
+            public ExpressionValue GetSymbolValue(string symbol)
+                => _context.GetSymbolValue(symbol);
+
+            public ExpressionValue GetZ80RegisterValue(string registerName, out bool is8Bit)
+                => _context.GetZ80RegisterValue(registerName, out is8Bit);
+
+            public ExpressionValue GetZ80FlagValue(string flagName)
+                => _context.GetZ80FlagValue(flagName);
+
+            public ExpressionValue GetMemoryIndirectValue(ExpressionValue address)
+            {
+                var memAddress = (ushort)address.Value;
+                if (!_readAddresses.Contains(memAddress))
+                {
+                    _readAddresses.Add(memAddress);
+                }
+                return _context.GetMemoryIndirectValue(address);
+            }
+        }
+    }
+}
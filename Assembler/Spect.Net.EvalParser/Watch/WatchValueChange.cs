@@ -0,0 +1,51 @@
+﻿using Spect.Net.EvalParser.SyntaxTree;
+
+namespace Spect.Net.EvalParser.Watch
+{
+    /// <summary>
+    /// This class represents the new value of a watch expression
+    /// </summary>
+    public class WatchValueChange
+    {
+        /// <summary>
+        /// The ID of the watch expression
+        /// </summary>
+        public int Id { get; }
+
+        /// <summary>
+        /// The new value of the expression
+        /// </summary>
+        public ExpressionValue Value { get; }
+
+        /// <summary>
+        /// The value type of the expression
+        /// </summary>
+        public ExpressionValueType ValueType { get; }
+
+        /// <summary>
+        /// The evaluation error, provided the value is an error
+        /// </summary>
+        public string EvaluationError { get; }
+
+        /// <summary>
+        /// Indicates that the evaluation failed
+        /// </summary>
+        public bool HasError => Value == ExpressionValue.Error;
+
+        /// <summary>
+        /// Initializes the change
+        /// </summary>
+        /// <param name="id">Watch expression ID</param>
+        /// <param name="value">New value</param>
+        /// <param name="valueType">Value type</param>
+        /// <param name="evaluationError">Evaluation error</param>
+        public WatchValueChange(int id, ExpressionValue value, ExpressionValueType valueType,
+            string evaluationError)
+        {
+            Id = id;
+            Value = value;
+            ValueType = valueType;
+            EvaluationError = evaluationError;
+        }
+    }
+}
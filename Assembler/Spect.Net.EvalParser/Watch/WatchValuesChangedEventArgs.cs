@@ -0,0 +1,32 @@
+﻿using System;
+using System.Collections.Generic;
+
+namespace Spect.Net.EvalParser.Watch
+{
+    /// <summary>
+    /// Arguments of the event raised when watch values have been changed
+    /// </summary>
+    public class WatchValuesChangedEventArgs : EventArgs
+    {
+        /// <summary>
+        /// The changed values in the order of watch registration
+        /// </summary>
+        public IReadOnlyList<WatchValueChange> Changes { get; }
+
+        /// <summary>
+        /// The CPU tacts at the time of the evaluation
+        /// </summary>
+        public long Tacts { get; }
+
+        /// <summary>
+        /// Initializes the event arguments
+        /// </summary>
+        /// <param name="changes">Changed values</param>
+        /// <param name="tacts">CPU tacts at the time of the evaluation</param>
+        public WatchValuesChangedEventArgs(IReadOnlyList<WatchValueChange> changes, long tacts)
+        {
+            Changes = changes;
+            Tacts = tacts;
+        }
+    }
+}
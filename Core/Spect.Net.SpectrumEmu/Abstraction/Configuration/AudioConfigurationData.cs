@@ -22,6 +22,12 @@
         /// </summary>
         public int TactsPerSample { get; set; }
 
+        /// <summary>
+        /// Indicates if the device should render band-limited steps instead
+        /// of sampling the signal at fixed points
+        /// </summary>
+        public bool BandLimitedSynthesis { get; set; }
+
         public AudioConfigurationData()
         {
             // TODO: Remove this initial setup
@@ -40,7 +46,8 @@
             {
                 AudioSampleRate = AudioSampleRate,
                 SamplesPerFrame = SamplesPerFrame,
-                TactsPerSample = TactsPerSample
+                TactsPerSample = TactsPerSample,
+                BandLimitedSynthesis = BandLimitedSynthesis
             };
         }
     }
@@ -0,0 +1,22 @@
+﻿using Spect.Net.SpectrumEmu.Abstraction.Devices;
+using Spect.Net.SpectrumEmu.Abstraction.Providers;
+
+namespace Spect.Net.SpectrumEmu.Abstraction.Configuration
+{
+    /// <summary>
+    /// This class describes configuration information for the audio mixer device.
+    /// </summary>
+    public sealed class AudioMixerDeviceInfo:
+        DeviceInfoBase<IAudioMixerDevice, INoConfiguration, IAudioMixerProvider>
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="T:System.Object" /> class.
+        /// </summary>
+        /// <param name="provider">Provider that renders the mixed stream</param>
+        /// <param name="device">Optional device instance</param>
+        public AudioMixerDeviceInfo(IAudioMixerProvider provider, IAudioMixerDevice device = null) : 
+            base(provider, null, device)
+        {
+        }
+    }
+}
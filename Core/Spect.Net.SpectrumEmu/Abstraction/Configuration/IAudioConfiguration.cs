@@ -19,5 +19,11 @@
         /// The number of ULA tacts per audio sample
         /// </summary>
         int TactsPerSample { get; }
+
+        /// <summary>
+        /// Indicates if the device should render band-limited steps instead
+        /// of sampling the signal at fixed points
+        /// </summary>
+        bool BandLimitedSynthesis { get; }
     }
 }
\ No newline at end of file
@@ -0,0 +1,29 @@
+﻿using System.Collections.Generic;
+using Spect.Net.SpectrumEmu.Devices.Sound;
+
+namespace Spect.Net.SpectrumEmu.Abstraction.Devices
+{
+    /// <summary>
+    /// This interface represents the device that mixes the audio sources of
+    /// the Spectrum VM into a single output stream
+    /// </summary>
+    public interface IAudioMixerDevice: IFrameBoundDevice, ISpectrumBoundDevice, IAudioSamplesDevice
+    {
+        /// <summary>
+        /// The number of CPU tacts per output sample
+        /// </summary>
+        int TactsPerSample { get; }
+
+        /// <summary>
+        /// The channels of the mixer
+        /// </summary>
+        IReadOnlyList<AudioMixerChannel> Channels { get; }
+
+        /// <summary>
+        /// Gets the channel with the specified name
+        /// </summary>
+        /// <param name="name">Channel name</param>
+        /// <returns>The channel, if found; otherwise, null</returns>
+        AudioMixerChannel GetChannel(string name);
+    }
+}
@@ -69,5 +69,10 @@ namespace Spect.Net.SpectrumEmu.Abstraction.Devices
         /// Ejects the disk from Drive A:
         /// </summary>
         Task EjectDriveB();
+
+        /// <summary>
+        /// Writes the pending changes of the inserted floppies into their files
+        /// </summary>
+        void Flush();
     }
 }
\ No newline at end of file
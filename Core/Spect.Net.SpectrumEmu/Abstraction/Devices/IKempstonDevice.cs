@@ -1,4 +1,6 @@
-﻿namespace Spect.Net.SpectrumEmu.Abstraction.Devices
+﻿using Spect.Net.SpectrumEmu.Devices.Kempston;
+
+namespace Spect.Net.SpectrumEmu.Abstraction.Devices
 {
     /// <summary>
     /// This interface represents the Kempston device
@@ -34,5 +36,12 @@
         /// The flag that indicates if the fire button is pressed.
         /// </summary>
         bool FirePressed { get; }
+
+        /// <summary>
+        /// Sets the joystick state from scheduled input. Until the next reset,
+        /// this state overrides the state of the Kempston provider.
+        /// </summary>
+        /// <param name="buttons">The pressed buttons</param>
+        void SetInputState(KempstonButtons buttons);
     }
 }
\ No newline at end of file
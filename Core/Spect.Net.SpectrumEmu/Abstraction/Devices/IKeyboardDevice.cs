@@ -21,6 +21,17 @@ namespace Spect.Net.SpectrumEmu.Abstraction.Devices
         /// <returns>True, if the key is down; otherwise, false</returns>
         bool GetStatus(SpectrumKeyCode key);
 
+        /// <summary>
+        /// Sets the status of a key from scheduled input
+        /// </summary>
+        /// <param name="key">Key code</param>
+        /// <param name="isDown">True, if the key is down; otherwise, false</param>
+        /// <remarks>
+        /// A scheduled key stays down until its scheduled release, even if
+        /// the keyboard provider reports it released in the meantime.
+        /// </remarks>
+        void SetScheduledStatus(SpectrumKeyCode key, bool isDown);
+
         /// <summary>
         /// Gets the byte we would get when querying the I/O address with the
         /// specified byte as the highest 8 bits of the address line
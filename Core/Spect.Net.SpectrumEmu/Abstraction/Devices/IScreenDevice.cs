@@ -47,6 +47,11 @@ namespace Spect.Net.SpectrumEmu.Abstraction.Devices
         /// <returns></returns>
         byte GetContentionValue(int tact);
 
+        /// <summary>
+        /// Gets the precomputed memory and I/O contention delays of the frame
+        /// </summary>
+        ContentionTable ContentionTable { get; }
+
         /// <summary>
         /// Gets the buffer that holds the screen pixels
         /// </summary>
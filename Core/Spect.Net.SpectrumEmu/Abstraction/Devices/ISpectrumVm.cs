@@ -1,9 +1,12 @@
 ﻿using System.Threading;
 using Spect.Net.EvalParser.SyntaxTree;
+using Spect.Net.EvalParser.Watch;
 using Spect.Net.SpectrumEmu.Abstraction.Configuration;
 using Spect.Net.SpectrumEmu.Abstraction.Providers;
+using Spect.Net.SpectrumEmu.Devices.Keyboard;
 using Spect.Net.SpectrumEmu.Devices.Screen;
 using Spect.Net.SpectrumEmu.Machine;
+using Spect.Net.SpectrumEmu.Recording;
 
 
 namespace Spect.Net.SpectrumEmu.Abstraction.Devices
@@ -38,6 +41,14 @@ namespace Spect.Net.SpectrumEmu.Abstraction.Devices
         /// </summary>
         int CurrentFrameTact { get; }
 
+        /// <summary>
+        /// The number of CPU tacts elapsed since the start of the current frame
+        /// </summary>
+        /// <remarks>
+        /// This value is not divided by the clock multiplier
+        /// </remarks>
+        int CurrentFrameCpuTact { get; }
+
         /// <summary>
         /// The length of the physical frame in clock counts
         /// </summary>
@@ -65,6 +76,16 @@ namespace Spect.Net.SpectrumEmu.Abstraction.Devices
         /// </summary>
         long LastExecutionContentionValue { get; }
 
+        /// <summary>
+        /// Signs that the screen memory or the border color is about to change
+        /// </summary>
+        /// <remarks>
+        /// In turbo mode, the screen is rendered only when a scanline has been
+        /// completed. This method renders the part of the scanline before the
+        /// current instruction, so it still shows the old content.
+        /// </remarks>
+        void OnScreenChanging();
+
         /// <summary>
         /// The current execution cycle options
         /// </summary>
@@ -191,6 +212,16 @@ namespace Spect.Net.SpectrumEmu.Abstraction.Devices
         /// </summary>
         IAudioConfiguration SoundConfiguration { get; }
 
+        /// <summary>
+        /// The optional device that mixes the audio sources
+        /// </summary>
+        IAudioMixerDevice AudioMixerDevice { get; }
+
+        /// <summary>
+        /// The provider that renders the mixed audio stream
+        /// </summary>
+        IAudioMixerProvider AudioMixerProvider { get; }
+
         /// <summary>
         /// The device that implements the Spectrum Next feature set
         /// </summary>
@@ -226,6 +257,21 @@ namespace Spect.Net.SpectrumEmu.Abstraction.Devices
         /// </summary>
         IExpressionEvaluationContext DebugExpressionContext { get; set; }
 
+        /// <summary>
+        /// Watch expressions evaluated while the machine runs
+        /// </summary>
+        WatchEngine WatchEngine { get; set; }
+
+        /// <summary>
+        /// The recorder that captures the completed frames
+        /// </summary>
+        FrameRecorder FrameRecorder { get; set; }
+
+        /// <summary>
+        /// Keyboard and Kempston events scheduled for specific CPU tacts
+        /// </summary>
+        InputSchedule InputSchedule { get; }
+
         /// <summary>
         /// The main execution cycle of the Spectrum VM
         /// </summary>
@@ -255,5 +301,19 @@ namespace Spect.Net.SpectrumEmu.Abstraction.Devices
         /// <param name="json">JSON representation of the VM's state</param>
         /// <param name="modelName">Current virtual machine model name</param>
         void SetVmState(string json, string modelName);
+
+        /// <summary>
+        /// Takes an in-memory snapshot of the virtual machine's state
+        /// </summary>
+        /// <param name="modelName">Current virtual machine model name</param>
+        /// <returns>The snapshot of the VM's state</returns>
+        VmStateSnapshot CreateSnapshot(string modelName);
+
+        /// <summary>
+        /// Restores the virtual machine's state from the specified snapshot
+        /// </summary>
+        /// <param name="snapshot">Snapshot to restore</param>
+        /// <param name="modelName">Current virtual machine model name</param>
+        void RestoreSnapshot(VmStateSnapshot snapshot, string modelName);
     }
 }
\ No newline at end of file
@@ -15,7 +15,46 @@ namespace Spect.Net.SpectrumEmu.Abstraction.Devices
         /// <summary>
         /// Gets the current set of registers
         /// </summary>
-        Registers Registers { get; }
+        /// <remarks>
+        /// The registers are returned by reference. Use a ref local to modify
+        /// them; a normal local variable holds a copy.
+        /// Registers used to be a class, so code that writes the registers
+        /// through <c>var r = cpu.Registers; r.A = ...</c> now changes only
+        /// the copy, silently. Use <c>ref var r = ref cpu.Registers</c>, or
+        /// modify a copy and write it back with <see cref="SetRegisters"/>.
+        /// </remarks>
+        ref Registers Registers { get; }
+
+        /// <summary>
+        /// Gets the current value of the PC register
+        /// </summary>
+        /// <remarks>
+        /// Use this property to check PC after each instruction; it does not
+        /// calculate the deferred flags.
+        /// </remarks>
+        ushort PC { get; }
+
+        /// <summary>
+        /// Gets a copy of the current register values
+        /// </summary>
+        Registers GetRegisters();
+
+        /// <summary>
+        /// Sets all registers from the specified values
+        /// </summary>
+        /// <param name="registers">Register values to set</param>
+        void SetRegisters(in Registers registers);
+
+        /// <summary>
+        /// The profiler that collects the instruction statistics;
+        /// null, if profiling is turned off
+        /// </summary>
+        Z80InstructionProfiler Profiler { get; set; }
+
+        /// <summary>
+        /// Indicates if the 8-bit ALU operations defer the calculation of F
+        /// </summary>
+        bool DeferredFlags { get; set; }
 
         /// <summary>
         /// CPU signals
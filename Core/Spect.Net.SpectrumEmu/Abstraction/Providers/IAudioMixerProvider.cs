@@ -0,0 +1,13 @@
+﻿namespace Spect.Net.SpectrumEmu.Abstraction.Providers
+{
+    /// <summary>
+    /// This interface represents a device that can render the mixed
+    /// output of all audio sources into sound
+    /// </summary>
+    /// <remarks>
+    /// The mixed stream uses the sample rate of the beeper configuration.
+    /// </remarks>
+    public interface IAudioMixerProvider : IBeeperProvider
+    {
+    }
+}
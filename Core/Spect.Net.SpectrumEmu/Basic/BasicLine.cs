@@ -0,0 +1,50 @@
+﻿namespace Spect.Net.SpectrumEmu.Basic
+{
+    /// <summary>
+    /// This structure describes a line of a tokenized BASIC program
+    /// </summary>
+    /// <remarks>
+    /// The structure stores only the position of the line; the text of the
+    /// line is created by BasicProgramDecoder when it is needed.
+    /// </remarks>
+    public struct BasicLine
+    {
+        /// <summary>
+        /// The line number
+        /// </summary>
+        public int LineNo { get; }
+
+        /// <summary>
+        /// Offset of the line (the line number) in the memory
+        /// </summary>
+        public int Offset { get; }
+
+        /// <summary>
+        /// Length of the line body (including the closing ENTER)
+        /// </summary>
+        public int Length { get; }
+
+        /// <summary>
+        /// Offset of the first byte of the line body
+        /// </summary>
+        public int BodyOffset => Offset + 4;
+
+        /// <summary>
+        /// Offset of the byte following the line
+        /// </summary>
+        public int EndOffset => Offset + 4 + Length;
+
+        /// <summary>
+        /// Initializes the line
+        /// </summary>
+        /// <param name="lineNo">Line number</param>
+        /// <param name="offset">Offset of the line in the memory</param>
+        /// <param name="length">Length of the line body</param>
+        public BasicLine(int lineNo, int offset, int length)
+        {
+            LineNo = lineNo;
+            Offset = offset;
+            Length = length;
+        }
+    }
+}
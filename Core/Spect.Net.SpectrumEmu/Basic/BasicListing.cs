@@ -0,0 +1,138 @@
+﻿using System;
+using System.Collections.Generic;
+
+namespace Spect.Net.SpectrumEmu.Basic
+{
+    /// <summary>
+    /// This class keeps the decoded listing of a BASIC program up to date
+    /// </summary>
+    /// <remarks>
+    /// The listing keeps a copy of the program bytes it has decoded. On
+    /// refresh, lines with the same number and the same bytes as before
+    /// keep their text, so only the changed lines are formatted again.
+    /// Line texts are created when they are first asked for.
+    /// </remarks>
+    public class BasicListing
+    {
+        private readonly BasicProgramDecoder _decoder;
+        private readonly List<BasicLine> _lines = new List<BasicLine>();
+        private readonly List<string> _texts = new List<string>();
+        private byte[] _program = new byte[0];
+        private int _programStart;
+
+        /// <summary>
+        /// The lines of the program
+        /// </summary>
+        public IReadOnlyList<BasicLine> Lines => _lines;
+
+        /// <summary>
+        /// Creates a listing that uses the specified decoder
+        /// </summary>
+        /// <param name="decoder">Decoder to use; null for the ZX Spectrum 48 decoder</param>
+        public BasicListing(BasicProgramDecoder decoder = null)
+        {
+            _decoder = decoder ?? new BasicProgramDecoder();
+        }
+
+        /// <summary>
+        /// Refreshes the listing from the program in the memory of a machine
+        /// </summary>
+        /// <param name="memory">The 64K memory of the machine</param>
+        /// <returns>The number of lines that are new or changed</returns>
+        public int Refresh(byte[] memory)
+        {
+            return BasicProgramDecoder.TryGetProgramBounds(memory, out var progStart, out var progEnd)
+                ? Refresh(memory, progStart, progEnd)
+                : Refresh(memory, 0, 0);
+        }
+
+        /// <summary>
+        /// Refreshes the listing from the specified memory section
+        /// </summary>
+        /// <param name="memory">Memory that contains the program</param>
+        /// <param name="start">Offset of the first line</param>
+        /// <param name="end">Offset following the last line</param>
+        /// <returns>The number of lines that are new or changed</returns>
+        public int Refresh(byte[] memory, int start, int end)
+        {
+            if (memory == null) throw new ArgumentNullException(nameof(memory));
+            if (end > memory.Length) end = memory.Length;
+
+            // --- Index the lines of the previous listing by their numbers
+            var oldLines = new Dictionary<int, int>(_lines.Count);
+            for (var i = 0; i < _lines.Count; i++)
+            {
+                oldLines[_lines[i].LineNo] = i;
+            }
+            var oldTexts = _texts.ToArray();
+            var oldLineList = _lines.ToArray();
+
+            _lines.Clear();
+            _texts.Clear();
+            var changed = 0;
+            foreach (var line in _decoder.DecodeLines(memory, start, end))
+            {
+                string text = null;
+                if (oldLines.TryGetValue(line.LineNo, out var oldIndex)
+                    && IsSameLine(oldLineList[oldIndex], memory, line))
+                {
+                    text = oldTexts[oldIndex];
+                }
+                else
+                {
+                    changed++;
+                }
+                _lines.Add(line);
+                _texts.Add(text);
+            }
+
+            // --- Keep a copy of the program to compare with on the next refresh
+            var length = Math.Max(0, Math.Min(end, memory.Length) - start);
+            if (_program.Length != length)
+            {
+                _program = new byte[length];
+            }
+            if (length > 0)
+            {
+                Buffer.BlockCopy(memory, start, _program, 0, length);
+            }
+            _programStart = start;
+            return changed;
+        }
+
+        /// <summary>
+        /// Gets the text of the specified line
+        /// </summary>
+        /// <param name="index">Index of the line in Lines</param>
+        /// <returns>The text of the line without the line number</returns>
+        public string GetText(int index)
+        {
+            var text = _texts[index];
+            if (text == null)
+            {
+                var line = _lines[index];
+
+                // --- The line is formatted from the saved copy of the program
+                var copy = new BasicLine(line.LineNo, line.Offset - _programStart, line.Length);
+                text = _texts[index] = _decoder.FormatLine(_program, copy);
+            }
+            return text;
+        }
+
+        /// <summary>
+        /// Checks if the line has the same bytes as the old one
+        /// </summary>
+        private bool IsSameLine(BasicLine oldLine, byte[] memory, BasicLine line)
+        {
+            if (oldLine.Length != line.Length) return false;
+            var oldPos = oldLine.Offset - _programStart;
+            var oldEnd = oldLine.EndOffset - _programStart;
+            if (oldEnd > _program.Length || line.EndOffset > memory.Length) return false;
+            for (var pos = line.Offset; oldPos < oldEnd; oldPos++, pos++)
+            {
+                if (_program[oldPos] != memory[pos]) return false;
+            }
+            return true;
+        }
+    }
+}
@@ -0,0 +1,164 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Text;
+using Spect.Net.SpectrumEmu.Machine;
+
+namespace Spect.Net.SpectrumEmu.Basic
+{
+    /// <summary>
+    /// This class decodes tokenized ZX Spectrum BASIC programs
+    /// </summary>
+    /// <remarks>
+    /// Decoding the lines only reads the line headers; the text of a line
+    /// is created when FormatLine is called for it.
+    /// </remarks>
+    public class BasicProgramDecoder
+    {
+        private readonly IReadOnlyList<string> _tokens;
+        private readonly StringBuilder _builder = new StringBuilder(256);
+
+        /// <summary>
+        /// Creates a decoder that uses the specified token table
+        /// </summary>
+        /// <param name="tokens">
+        /// Token table starting with the token of 0xA5; null to use the
+        /// ZX Spectrum 48 tokens
+        /// </param>
+        public BasicProgramDecoder(IReadOnlyList<string> tokens = null)
+        {
+            _tokens = tokens ?? BasicTokens.Spectrum48;
+        }
+
+        /// <summary>
+        /// Gets the bounds of the BASIC program from the PROG and VARS
+        /// system variables
+        /// </summary>
+        /// <param name="memory">The 64K memory of the machine</param>
+        /// <param name="progStart">Start address of the program</param>
+        /// <param name="progEnd">End address of the program (exclusive)</param>
+        /// <returns>True, if the bounds are valid; otherwise, false</returns>
+        public static bool TryGetProgramBounds(byte[] memory, out ushort progStart, out ushort progEnd)
+        {
+            progStart = progEnd = 0;
+            if (memory == null || memory.Length < 0x10000) return false;
+            progStart = ReadWord(memory, SystemVariables.Get("PROG").Address);
+            progEnd = ReadWord(memory, SystemVariables.Get("VARS").Address);
+            return progStart != 0 && progEnd != 0 && progStart <= progEnd;
+        }
+
+        /// <summary>
+        /// Decodes the lines of the BASIC program in the memory of a machine
+        /// </summary>
+        /// <param name="memory">The 64K memory of the machine</param>
+        public IEnumerable<BasicLine> DecodeProgram(byte[] memory)
+            => TryGetProgramBounds(memory, out var progStart, out var progEnd)
+                ? DecodeLines(memory, progStart, progEnd)
+                : new BasicLine[0];
+
+        /// <summary>
+        /// Decodes the lines of the BASIC program in the specified memory section
+        /// </summary>
+        /// <param name="memory">Memory that contains the program</param>
+        /// <param name="start">Offset of the first line</param>
+        /// <param name="end">Offset following the last line</param>
+        public IEnumerable<BasicLine> DecodeLines(byte[] memory, int start, int end)
+        {
+            if (memory == null) throw new ArgumentNullException(nameof(memory));
+            if (end > memory.Length) end = memory.Length;
+            if (start < 0 || start >= end) yield break;
+
+            while (start < end && start + 4 <= memory.Length)
+            {
+                var line = new BasicLine(
+                    memory[start] * 0x100 + memory[start + 1],
+                    start,
+                    memory[start + 2] + memory[start + 3] * 0x100);
+                yield return line;
+                start = line.EndOffset;
+            }
+        }
+
+        /// <summary>
+        /// Gets the text of the specified line
+        /// </summary>
+        /// <param name="memory">Memory that contains the program</param>
+        /// <param name="line">Line to format</param>
+        /// <returns>The text of the line without the line number</returns>
+        public string FormatLine(byte[] memory, BasicLine line)
+        {
+            _builder.Clear();
+            FormatLine(memory, line, _builder);
+            return _builder.ToString();
+        }
+
+        /// <summary>
+        /// Appends the text of the specified line to a string builder
+        /// </summary>
+        /// <param name="memory">Memory that contains the program</param>
+        /// <param name="line">Line to format</param>
+        /// <param name="sb">String builder to append the text to</param>
+        public void FormatLine(byte[] memory, BasicLine line, StringBuilder sb)
+        {
+            var pos = line.BodyOffset;
+            var lineEnd = line.EndOffset;
+            if (lineEnd > memory.Length - 1)
+            {
+                lineEnd = memory.Length - 1;
+            }
+
+            var spaceBeforeToken = false;
+            while (pos < lineEnd)
+            {
+                var nextSymbol = memory[pos++];
+                if (nextSymbol >= BasicTokens.FIRST_TOKEN)
+                {
+                    // --- This is a token
+                    if (spaceBeforeToken)
+                    {
+                        sb.Append(' ');
+                    }
+                    var tokenCode = nextSymbol - BasicTokens.FIRST_TOKEN;
+                    var token = _tokens[tokenCode];
+                    sb.Append(token);
+                    if (tokenCode > 2 && char.IsLetter(token[token.Length - 1]))
+                    {
+                        sb.Append(' ');
+                        spaceBeforeToken = false;
+                    }
+                    continue;
+                }
+
+                // --- Whatever we print, the next token needs a space
+                spaceBeforeToken = true;
+
+                if (nextSymbol >= 0x20 && nextSymbol <= 0x7F)
+                {
+                    // --- Printable character
+                    sb.Append((char)nextSymbol);
+                    continue;
+                }
+
+                if (nextSymbol == BasicTokens.ENTER)
+                {
+                    continue;
+                }
+
+                if (nextSymbol == BasicTokens.NUMBER_MARKER)
+                {
+                    // --- Skip the binary form of a floating point number
+                    pos += 5;
+                    continue;
+                }
+
+                // --- Non-printable character, let's display it with an escape sequence
+                sb.Append('°').Append(nextSymbol.ToString("X2")).Append('°');
+            }
+        }
+
+        /// <summary>
+        /// Reads a little-endian word from the memory
+        /// </summary>
+        private static ushort ReadWord(byte[] memory, int address)
+            => (ushort)(memory[address] + memory[(ushort)(address + 1)] * 0x100);
+    }
+}
@@ -0,0 +1,92 @@
+﻿using System;
+using Spect.Net.SpectrumEmu.Abstraction.Devices;
+using Spect.Net.SpectrumEmu.Machine;
+
+namespace Spect.Net.SpectrumEmu.Basic
+{
+    /// <summary>
+    /// This class puts a tokenized BASIC program into the memory of a machine
+    /// </summary>
+    /// <remarks>
+    /// The program replaces the current one at PROG, the variables are
+    /// cleared, and the system variables that point above the program are
+    /// set the same way as the ROM sets them after LOAD, so the program can
+    /// be listed or started with RUN right away.
+    /// </remarks>
+    public static class BasicProgramLoader
+    {
+        /// <summary>
+        /// The free space the ROM needs above the workspace (see TEST-ROOM)
+        /// </summary>
+        public const int MIN_FREE_MEMORY = 80;
+
+        /// <summary>
+        /// Loads the specified program into the memory
+        /// </summary>
+        /// <param name="memory">Memory device of the machine</param>
+        /// <param name="program">Tokenized program lines</param>
+        /// <returns>The address following the program (the new value of VARS)</returns>
+        public static ushort Load(IMemoryDevice memory, byte[] program)
+        {
+            if (memory == null) throw new ArgumentNullException(nameof(memory));
+            if (program == null) throw new ArgumentNullException(nameof(program));
+
+            var progStart = ReadWord(memory, "PROG");
+            if (progStart == 0)
+            {
+                throw new InvalidOperationException(
+                    "PROG is not set; the ROM must be initialized before loading a BASIC program.");
+            }
+
+            // --- Check that the program fits below RAMTOP
+            var vars = progStart + program.Length;
+            var eLine = vars + 1;
+            var workspace = eLine + 2;
+            var ramTop = ReadWord(memory, "RAMTOP");
+            if (workspace + MIN_FREE_MEMORY > ramTop)
+            {
+                throw new InvalidOperationException(
+                    $"The BASIC program ({program.Length} bytes) does not fit below RAMTOP (#{ramTop:X4}).");
+            }
+
+            // --- Copy the program, then the empty variables area and edit line
+            for (var i = 0; i < program.Length; i++)
+            {
+                memory.Write((ushort)(progStart + i), program[i], true);
+            }
+            memory.Write((ushort)vars, 0x80, true);
+            memory.Write((ushort)eLine, BasicTokens.ENTER, true);
+            memory.Write((ushort)(eLine + 1), 0x80, true);
+
+            // --- Set the system variables above the program
+            WriteWord(memory, "VARS", vars);
+            WriteWord(memory, "E_LINE", eLine);
+            WriteWord(memory, "K_CUR", eLine);
+            WriteWord(memory, "WORKSP", workspace);
+            WriteWord(memory, "STKBOT", workspace);
+            WriteWord(memory, "STKEND", workspace);
+            WriteWord(memory, "DATADD", progStart - 1);
+            WriteWord(memory, "X_PTR", 0);
+            return (ushort)vars;
+        }
+
+        /// <summary>
+        /// Reads the value of a two-byte system variable
+        /// </summary>
+        private static ushort ReadWord(IMemoryDevice memory, string name)
+        {
+            var addr = SystemVariables.Get(name).Address;
+            return (ushort)(memory.Read(addr, true) + memory.Read((ushort)(addr + 1), true) * 0x100);
+        }
+
+        /// <summary>
+        /// Writes the value of a two-byte system variable
+        /// </summary>
+        private static void WriteWord(IMemoryDevice memory, string name, int value)
+        {
+            var addr = SystemVariables.Get(name).Address;
+            memory.Write(addr, (byte)value, true);
+            memory.Write((ushort)(addr + 1), (byte)(value >> 8), true);
+        }
+    }
+}
@@ -0,0 +1,282 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Globalization;
+using System.IO;
+using System.Linq;
+using Spect.Net.SpectrumEmu.Utility;
+
+namespace Spect.Net.SpectrumEmu.Basic
+{
+    /// <summary>
+    /// This class converts ZX Spectrum BASIC source text into the tokenized
+    /// form the ROM stores programs in
+    /// </summary>
+    /// <remarks>
+    /// Keywords are recognized case-insensitively, and the spaces within
+    /// multi-word keywords are optional (GOTO, GO TO). A keyword that ends
+    /// with a letter is not recognized inside a longer name. The spaces
+    /// around keywords are dropped, as the ROM adds them when listing.
+    /// Numbers get their hidden five-byte form, except for the digits of a
+    /// name (x10); strings and REM comments are copied as they are.
+    /// </remarks>
+    public class BasicTokenizer
+    {
+        private readonly List<(string Keyword, byte Code)> _keywords;
+
+        /// <summary>
+        /// Creates a tokenizer that uses the specified token table
+        /// </summary>
+        /// <param name="tokens">
+        /// Token table starting with the token of 0xA5; null to use the
+        /// ZX Spectrum 48 tokens
+        /// </param>
+        public BasicTokenizer(IReadOnlyList<string> tokens = null)
+        {
+            tokens = tokens ?? BasicTokens.Spectrum48;
+            _keywords = tokens
+                .Select((token, index) => (Keyword: token,
+                    Code: (byte)(BasicTokens.FIRST_TOKEN + index)))
+                .OrderByDescending(k => k.Keyword.Replace(" ", "").Length)
+                .ToList();
+        }
+
+        /// <summary>
+        /// Tokenizes the specified program
+        /// </summary>
+        /// <param name="source">BASIC source text, one numbered line per row</param>
+        /// <returns>The tokenized program ordered by line numbers</returns>
+        /// <remarks>
+        /// Empty rows are ignored. A line number used more than once keeps
+        /// the last line, as if it was typed in.
+        /// </remarks>
+        public byte[] TokenizeProgram(string source)
+        {
+            if (source == null) throw new ArgumentNullException(nameof(source));
+            var lines = new SortedDictionary<int, byte[]>();
+            using (var reader = new StringReader(source))
+            {
+                string row;
+                while ((row = reader.ReadLine()) != null)
+                {
+                    if (string.IsNullOrWhiteSpace(row)) continue;
+                    var line = TokenizeLine(row);
+                    lines[line[0] * 0x100 + line[1]] = line;
+                }
+            }
+            return lines.Values.SelectMany(l => l).ToArray();
+        }
+
+        /// <summary>
+        /// Tokenizes a single program line
+        /// </summary>
+        /// <param name="row">Source text of the line with its line number</param>
+        /// <returns>Line number, body length, body, and ENTER</returns>
+        public byte[] TokenizeLine(string row)
+        {
+            if (row == null) throw new ArgumentNullException(nameof(row));
+
+            // --- Get the line number
+            var pos = 0;
+            while (pos < row.Length && row[pos] == ' ') pos++;
+            var numStart = pos;
+            while (pos < row.Length && char.IsDigit(row[pos])) pos++;
+            if (pos == numStart
+                || !int.TryParse(row.Substring(numStart, pos - numStart), out var lineNo)
+                || lineNo < 1 || lineNo > 9999)
+            {
+                throw new FormatException($"The BASIC line has no valid line number (1-9999): '{row}'");
+            }
+            while (pos < row.Length && row[pos] == ' ') pos++;
+
+            // --- Tokenize the line body
+            var body = new List<byte>();
+            var inString = false;
+            var inRem = false;
+            var inName = false;
+            byte? lastToken = null;
+            while (pos < row.Length)
+            {
+                var ch = row[pos];
+                if (inRem)
+                {
+                    body.Add(ToSpectrumChar(ch, row));
+                    pos++;
+                    continue;
+                }
+                if (inString)
+                {
+                    body.Add(ToSpectrumChar(ch, row));
+                    inString = ch != '"';
+                    pos++;
+                    continue;
+                }
+                if (ch == '"')
+                {
+                    body.Add((byte)ch);
+                    inString = true;
+                    inName = false;
+                    lastToken = null;
+                    pos++;
+                    continue;
+                }
+
+                // --- Keywords
+                if (TryMatchKeyword(row, pos, inName, out var code, out var keywordEnd))
+                {
+                    // --- The ROM adds the spaces around keywords when listing
+                    while (body.Count > 0 && body[body.Count - 1] == ' ') body.RemoveAt(body.Count - 1);
+                    body.Add(code);
+                    pos = keywordEnd;
+                    while (pos < row.Length && row[pos] == ' ') pos++;
+                    inRem = code == BasicTokens.FIRST_TOKEN + 0x45;
+                    inName = false;
+                    lastToken = code;
+                    continue;
+                }
+
+                // --- Numbers (not within names)
+                if ((char.IsDigit(ch) || ch == '.' && pos + 1 < row.Length && char.IsDigit(row[pos + 1]))
+                    && !inName)
+                {
+                    pos = lastToken == BasicTokens.FIRST_TOKEN + 0x1F
+                        ? AddBinaryNumber(row, pos, body)
+                        : AddNumber(row, pos, body);
+                    lastToken = null;
+                    continue;
+                }
+
+                // --- A name starts with a letter and goes on with letters and digits
+                body.Add(ToSpectrumChar(ch, row));
+                inName = char.IsLetter(ch) || inName && char.IsDigit(ch);
+                lastToken = null;
+                pos++;
+            }
+            body.Add(BasicTokens.ENTER);
+
+            var result = new byte[body.Count + 4];
+            result[0] = (byte)(lineNo >> 8);
+            result[1] = (byte)lineNo;
+            result[2] = (byte)body.Count;
+            result[3] = (byte)(body.Count >> 8);
+            body.CopyTo(result, 4);
+            return result;
+        }
+
+        /// <summary>
+        /// Checks if a keyword starts at the specified position
+        /// </summary>
+        private bool TryMatchKeyword(string row, int pos, bool inName, out byte code, out int end)
+        {
+            foreach (var (keyword, keywordCode) in _keywords)
+            {
+                if (!MatchesAt(row, pos, keyword, out end)) continue;
+
+                // --- Alphabetic keywords must not be part of a longer name
+                if (char.IsLetter(keyword[0]) && inName) continue;
+                if (char.IsLetter(keyword[keyword.Length - 1]) && end < row.Length && char.IsLetter(row[end])) continue;
+                code = keywordCode;
+                return true;
+            }
+            code = 0;
+            end = pos;
+            return false;
+        }
+
+        /// <summary>
+        /// Matches a keyword at the specified position; the spaces within
+        /// the keyword are optional in the source
+        /// </summary>
+        private static bool MatchesAt(string row, int pos, string keyword, out int end)
+        {
+            end = pos;
+            foreach (var ch in keyword)
+            {
+                if (ch == ' ')
+                {
+                    while (end < row.Length && row[end] == ' ') end++;
+                    continue;
+                }
+                if (end >= row.Length || char.ToUpperInvariant(row[end]) != ch) return false;
+                end++;
+            }
+            return true;
+        }
+
+        /// <summary>
+        /// Adds a decimal number in text and in hidden binary form
+        /// </summary>
+        private static int AddNumber(string row, int pos, List<byte> body)
+        {
+            var start = pos;
+            while (pos < row.Length && (char.IsDigit(row[pos]) || row[pos] == '.')) pos++;
+            if (pos < row.Length && (row[pos] == 'e' || row[pos] == 'E'))
+            {
+                var expPos = pos + 1;
+                if (expPos < row.Length && (row[expPos] == '+' || row[expPos] == '-')) expPos++;
+                if (expPos < row.Length && char.IsDigit(row[expPos]))
+                {
+                    pos = expPos;
+                    while (pos < row.Length && char.IsDigit(row[pos])) pos++;
+                }
+            }
+            var text = row.Substring(start, pos - start);
+            if (!double.TryParse(text, NumberStyles.Float, CultureInfo.InvariantCulture, out var value))
+            {
+                throw new FormatException($"Invalid number '{text}' in BASIC line '{row}'");
+            }
+            AddWithValue(text, value, body);
+            return pos;
+        }
+
+        /// <summary>
+        /// Adds a binary number following the BIN keyword
+        /// </summary>
+        private static int AddBinaryNumber(string row, int pos, List<byte> body)
+        {
+            var start = pos;
+            var value = 0.0;
+            while (pos < row.Length && (row[pos] == '0' || row[pos] == '1'))
+            {
+                value = value * 2 + (row[pos] - '0');
+                pos++;
+            }
+            if (pos == start)
+            {
+                // --- Not a binary number, handle it as a decimal one
+                return AddNumber(row, pos, body);
+            }
+            AddWithValue(row.Substring(start, pos - start), value, body);
+            return pos;
+        }
+
+        /// <summary>
+        /// Adds the text of a number followed by its hidden five-byte form
+        /// </summary>
+        private static void AddWithValue(string text, double value, List<byte> body)
+        {
+            body.AddRange(text.Select(c => (byte)c));
+            body.Add(BasicTokens.NUMBER_MARKER);
+            body.AddRange(FloatNumber.ToBytes(value));
+        }
+
+        /// <summary>
+        /// Converts a source character to the Spectrum character set
+        /// </summary>
+        private static byte ToSpectrumChar(char ch, string row)
+        {
+            switch (ch)
+            {
+                case '£':
+                    return 0x60;
+                case '©':
+                    return 0x7F;
+                default:
+                    if (ch < 0x20 || ch > 0x7E)
+                    {
+                        throw new FormatException($"Character '{ch}' cannot be used in BASIC line '{row}'");
+                    }
+                    return (byte)ch;
+            }
+        }
+    }
+}
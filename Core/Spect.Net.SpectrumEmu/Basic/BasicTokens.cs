@@ -0,0 +1,48 @@
+﻿using System.Collections.Generic;
+using System.Collections.ObjectModel;
+
+namespace Spect.Net.SpectrumEmu.Basic
+{
+    /// <summary>
+    /// This class stores the keyword tokens of the ZX Spectrum 48 BASIC
+    /// </summary>
+    /// <remarks>
+    /// The table is the same as the one of the ZX Spectrum 48 ROM, so
+    /// programs can be decoded without a running virtual machine.
+    /// </remarks>
+    public static class BasicTokens
+    {
+        /// <summary>
+        /// The code of the first token (RND)
+        /// </summary>
+        public const byte FIRST_TOKEN = 0xA5;
+
+        /// <summary>
+        /// Marks the five-byte binary form of a number
+        /// </summary>
+        public const byte NUMBER_MARKER = 0x0E;
+
+        /// <summary>
+        /// Marks the end of a BASIC line
+        /// </summary>
+        public const byte ENTER = 0x0D;
+
+        /// <summary>
+        /// The tokens in the order of their codes, starting with FIRST_TOKEN
+        /// </summary>
+        public static IReadOnlyList<string> Spectrum48 { get; } = new ReadOnlyCollection<string>(new[]
+        {
+            "RND", "INKEY$", "PI", "FN", "POINT", "SCREEN$", "ATTR", "AT", "TAB",     // A5..AD
+            "VAL$", "CODE", "VAL", "LEN", "SIN", "COS", "TAN", "ASN", "ACS",          // AE..B6
+            "ATN", "LN", "EXP", "INT", "SQR", "SGN", "ABS", "PEEK", "IN",             // B7..BF
+            "USR", "STR$", "CHR$", "NOT", "BIN", "OR", "AND", "<=", ">=",             // C0..C8
+            "<>", "LINE", "THEN", "TO", "STEP", "DEF FN", "CAT", "FORMAT", "MOVE",    // C9..D1
+            "ERASE", "OPEN #", "CLOSE #", "MERGE", "VERIFY", "BEEP", "CIRCLE", "INK", // D2..D9
+            "PAPER", "FLASH", "BRIGHT", "INVERSE", "OVER", "OUT", "LPRINT", "LLIST",  // DA..E1
+            "STOP", "READ", "DATA", "RESTORE", "NEW", "BORDER", "CONTINUE", "DIM",    // E2..E9
+            "REM", "FOR", "GO TO", "GO SUB", "INPUT", "LOAD", "LIST", "LET",          // EA..F1
+            "PAUSE", "NEXT", "POKE", "PRINT", "PLOT", "RUN", "SAVE", "RANDOMIZE",     // F2..F9
+            "IF", "CLS", "DRAW", "CLEAR", "RETURN", "COPY"                            // FA..FF
+        });
+    }
+}
@@ -16,8 +16,14 @@ namespace Spect.Net.SpectrumEmu.Cpu
     /// There are also two sets of Accumulator and Flag registers and 
     /// six special-purpose registers.
     /// </summary>
+    /// <remarks>
+    /// The registers form a single value-type block owned by the CPU.
+    /// IZ80Cpu.Registers returns it by reference, so the CPU state can be
+    /// modified in place; assigning it to a variable takes a snapshot, and
+    /// assigning a snapshot back restores all registers with a block copy.
+    /// </remarks>
     [StructLayout(LayoutKind.Explicit)]
-    public class Registers
+    public struct Registers
     {
         #region Register layouts
 
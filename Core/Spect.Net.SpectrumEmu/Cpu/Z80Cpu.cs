@@ -33,6 +33,8 @@ namespace Spect.Net.SpectrumEmu.Cpu
         private readonly ITbBlueControlDevice _tbblueDevice;
         private readonly IList<byte> _instructionBytes = new List<byte>(4);
         private ushort _lastPC;
+        private Z80InstructionProfiler _profiler;
+        private long _opStartTacts;
 
         /// <summary>
         /// This flag signs if the Z80 extended instruction set (Spectrum Next)
@@ -50,7 +52,55 @@ namespace Spect.Net.SpectrumEmu.Cpu
         /// <summary>
         /// Gets the current set of registers
         /// </summary>
-        public Registers Registers => _registers;
+        /// <remarks>
+        /// Calculates F, if the flags of the last ALU operation are deferred
+        /// </remarks>
+        public ref Registers Registers
+        {
+            get
+            {
+                MaterializeFlags();
+                return ref _registers;
+            }
+        }
+
+        /// <summary>
+        /// Gets the current value of the PC register
+        /// </summary>
+        /// <remarks>
+        /// Unlike Registers, it does not calculate deferred flags, so it
+        /// can be checked after each instruction.
+        /// </remarks>
+        public ushort PC => _registers.PC;
+
+        /// <summary>
+        /// Gets a copy of the current register values
+        /// </summary>
+        public Registers GetRegisters()
+        {
+            MaterializeFlags();
+            return _registers;
+        }
+
+        /// <summary>
+        /// Sets all registers from the specified values
+        /// </summary>
+        /// <param name="registers">Register values to set</param>
+        public void SetRegisters(in Registers registers)
+        {
+            _flagsDeferred = false;
+            _registers = registers;
+        }
+
+        /// <summary>
+        /// The profiler that collects the instruction statistics;
+        /// null, if profiling is turned off
+        /// </summary>
+        public Z80InstructionProfiler Profiler
+        {
+            get => _profiler;
+            set => _profiler = value;
+        }
 
         /// <summary>
         /// CPU signals
@@ -155,6 +205,7 @@ namespace Spect.Net.SpectrumEmu.Cpu
             InitializeBitOpsExecutionTable();
             InitializeIndexedBitOpsExecutionTable();
             InitializeAluTables();
+            InitializeDeferredFlagsTables();
             ExecutionFlowStatus = new MemoryStatusArray();
             MemoryReadStatus = new MemoryStatusArray();
             MemoryWriteStatus = new MemoryStatusArray();
@@ -349,6 +400,12 @@ namespace Spect.Net.SpectrumEmu.Cpu
             // --- Nothing more to do in this execution cycle
             if (ProcessCpuSignals()) return;
 
+            // --- Instructions are profiled from their first prefix
+            if (_profiler != null && !_isInOpExecution)
+            {
+                _opStartTacts = _tacts;
+            }
+
             // --- Get operation code and refresh the memory
             MaskableInterruptModeEntered = false;
             var opCode = ReadCodeMemory();
@@ -415,20 +472,21 @@ namespace Spect.Net.SpectrumEmu.Cpu
         /// </summary>
         public void TurnOffCpu()
         {
-            Registers.AF = 0xFFFF;
-            Registers.BC = 0xFFFF;
-            Registers.DE = 0xFFFF;
-            Registers.HL = 0xFFFF;
-            Registers._AF_ = 0xFFFF;
-            Registers._BC_ = 0xFFFF;
-            Registers._DE_ = 0xFFFF;
-            Registers._HL_ = 0xFFFF;
-            Registers.IX = 0xFFFF;
-            Registers.IY = 0xFFFF;
-            Registers.SP = 0xFFFF;
-            Registers.PC = 0xFFFF;
-            Registers.IR = 0xFFFF;
-            Registers.WZ = 0xFFFF;
+            _flagsDeferred = false;
+            _registers.AF = 0xFFFF;
+            _registers.BC = 0xFFFF;
+            _registers.DE = 0xFFFF;
+            _registers.HL = 0xFFFF;
+            _registers._AF_ = 0xFFFF;
+            _registers._BC_ = 0xFFFF;
+            _registers._DE_ = 0xFFFF;
+            _registers._HL_ = 0xFFFF;
+            _registers.IX = 0xFFFF;
+            _registers.IY = 0xFFFF;
+            _registers.SP = 0xFFFF;
+            _registers.PC = 0xFFFF;
+            _registers.IR = 0xFFFF;
+            _registers.WZ = 0xFFFF;
         }
 
         /// <summary>
@@ -521,7 +579,9 @@ namespace Spect.Net.SpectrumEmu.Cpu
         {
             MemoryReading?.Invoke(this, new AddressEventArgs(addr));
             MemoryReadStatus.Touch(addr);
+            var startTacts = _tacts;
             var data = _memoryDevice.Read(addr);
+            _profiler?.RecordMemoryContention(_tacts - startTacts);
             MemoryRead?.Invoke(this, new AddressAndDataEventArgs(addr, data));
             return data;
         }
@@ -534,7 +594,9 @@ namespace Spect.Net.SpectrumEmu.Cpu
         public byte ReadCodeMemory()
         {
             ExecutionFlowStatus.Touch(_registers.PC);
+            var startTacts = _tacts;
             var data = _memoryDevice.Read(_registers.PC);
+            _profiler?.RecordMemoryContention(_tacts - startTacts);
             _instructionBytes.Add(data);
             return data;
         }
@@ -550,7 +612,9 @@ namespace Spect.Net.SpectrumEmu.Cpu
         {
             MemoryWriting?.Invoke(this, new AddressAndDataEventArgs(addr, value));
             MemoryWriteStatus.Touch(addr);
+            var startTacts = _tacts;
             _memoryDevice.Write(addr, value);
+            _profiler?.RecordMemoryContention(_tacts - startTacts);
             MemoryWritten?.Invoke(this, new AddressAndDataEventArgs(addr, value));
         }
 
@@ -563,7 +627,9 @@ namespace Spect.Net.SpectrumEmu.Cpu
         public byte ReadPort(ushort addr)
         {
             PortReading?.Invoke(this, new AddressEventArgs(addr));
+            var startTacts = _tacts;
             var data = _portDevice.ReadPort(addr);
+            _profiler?.RecordIoCycle(_tacts - startTacts);
             PortRead?.Invoke(this, new AddressAndDataEventArgs(addr, data));
             return data;
         }
@@ -578,7 +644,9 @@ namespace Spect.Net.SpectrumEmu.Cpu
         public void WritePort(ushort addr, byte data)
         {
             PortWriting?.Invoke(this, new AddressAndDataEventArgs(addr, data));
+            var startTacts = _tacts;
             _portDevice.WritePort(addr, data);
+            _profiler?.RecordIoCycle(_tacts - startTacts);
             PortWritten?.Invoke(this, new AddressAndDataEventArgs(addr, data));
         }
 
@@ -640,14 +708,43 @@ namespace Spect.Net.SpectrumEmu.Cpu
             StackDebugSupport.StepOutAddress = null;
             OperationExecuting?.Invoke(this,
                 new Z80InstructionExecutionEventArgs(_lastPC, _instructionBytes, _opCode));
+
+            // --- Calculate the deferred flags, if the instruction may use them
+            if (_flagsDeferred
+                && (_prefixMode != OpPrefixMode.None || _indexMode != OpIndexMode.None
+                    || !s_KeepsDeferredFlags[_opCode]))
+            {
+                CalculateDeferredFlags();
+            }
             process();
+            _profiler?.RecordInstruction(GetOpcodePage(), _opCode, _tacts - _opStartTacts);
             OperationExecuted?.Invoke(this,
-                new Z80InstructionExecutionEventArgs(_lastPC, _instructionBytes, _opCode, Registers.PC));
+                new Z80InstructionExecutionEventArgs(_lastPC, _instructionBytes, _opCode, _registers.PC));
             _prefixMode = OpPrefixMode.None;
             _indexMode = OpIndexMode.None;
             _isInOpExecution = false;
             _instructionBytes.Clear();
-            _lastPC = Registers.PC;
+            _lastPC = _registers.PC;
+        }
+
+        /// <summary>
+        /// Gets the operation code page of the instruction being executed
+        /// </summary>
+        private Z80OpcodePage GetOpcodePage()
+        {
+            switch (_prefixMode)
+            {
+                case OpPrefixMode.Bit:
+                    return _indexMode == OpIndexMode.IX
+                        ? Z80OpcodePage.IndexedBitIx
+                        : _indexMode == OpIndexMode.IY ? Z80OpcodePage.IndexedBitIy : Z80OpcodePage.Bit;
+                case OpPrefixMode.Extended:
+                    return Z80OpcodePage.Extended;
+                default:
+                    return _indexMode == OpIndexMode.IX
+                        ? Z80OpcodePage.IndexedIx
+                        : _indexMode == OpIndexMode.IY ? Z80OpcodePage.IndexedIy : Z80OpcodePage.Standard;
+            }
         }
 
         /// <summary>
@@ -713,6 +810,9 @@ namespace Spect.Net.SpectrumEmu.Cpu
             _registers.IR = 0x0000;
             _isInOpExecution = false;
             _tacts = 0;
+
+            // --- Code discovery uses the addresses executed since reset
+            ExecutionFlowStatus.ClearAll();
         }
 
         /// <summary>
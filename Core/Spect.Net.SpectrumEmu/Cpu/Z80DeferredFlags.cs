@@ -0,0 +1,214 @@
+﻿// ReSharper disable InconsistentNaming
+
+using System;
+using System.Runtime.CompilerServices;
+
+namespace Spect.Net.SpectrumEmu.Cpu
+{
+    /// <summary>
+    /// This partion of the class implements the deferred calculation of
+    /// the F register for the 8-bit ALU operations
+    /// </summary>
+    /// <remarks>
+    /// In deferred flags mode the ADD, ADC, SUB, SBC, AND, XOR, OR, and CP
+    /// operations with a register or (HL) operand store their operands and
+    /// leave F unchanged. F is calculated from the same flag tables the
+    /// normal operations use when the next instruction may read it, or when
+    /// the registers are read through the Registers property.
+    /// </remarks>
+    public partial class Z80Cpu
+    {
+        private const int ALU_ADD = 0;
+        private const int ALU_ADC = 1;
+        private const int ALU_SUB = 2;
+        private const int ALU_SBC = 3;
+        private const int ALU_AND = 4;
+        private const int ALU_XOR = 5;
+        private const int ALU_OR = 6;
+
+        /// <summary>
+        /// Signs the standard operations that can be executed while the
+        /// flags are deferred: they do not use F, or they defer F themselves
+        /// </summary>
+        private static bool[] s_KeepsDeferredFlags;
+
+        /// <summary>
+        /// Standard operations jump table with immediate flag calculation
+        /// </summary>
+        private Action[] _immediateFlagsOperations;
+
+        /// <summary>
+        /// Standard operations jump table with deferred flag calculation
+        /// </summary>
+        private Action[] _deferredFlagsOperations;
+
+        private bool _deferredFlagsMode;
+        private bool _flagsDeferred;
+        private int _deferredAluOp;
+        private byte _deferredLeft;
+        private byte _deferredRight;
+        private int _deferredCarry;
+
+        /// <summary>
+        /// Indicates if the 8-bit ALU operations defer the calculation of F
+        /// </summary>
+        public bool DeferredFlags
+        {
+            get => _deferredFlagsMode;
+            set
+            {
+                MaterializeFlags();
+                _deferredFlagsMode = value;
+                _standarOperations = value ? _deferredFlagsOperations : _immediateFlagsOperations;
+            }
+        }
+
+        /// <summary>
+        /// Initializes the execution tables used in deferred flags mode
+        /// </summary>
+        private void InitializeDeferredFlagsTables()
+        {
+            _immediateFlagsOperations = _standarOperations;
+            _deferredFlagsOperations = (Action[])_standarOperations.Clone();
+            for (var opCode = 0x80; opCode < 0xC0; opCode++)
+            {
+                _deferredFlagsOperations[opCode] = AluOpDeferred;
+            }
+
+            s_KeepsDeferredFlags = new bool[0x100];
+            var keepers = new byte[]
+            {
+                0x00, 0x01, 0x02, 0x03, 0x06, 0x0A, 0x0B, 0x0E, // NOP, LD, INC rr, DEC rr
+                0x10, 0x11, 0x12, 0x13, 0x16, 0x18, 0x1A, 0x1B, 0x1E, // DJNZ, JR e
+                0x21, 0x22, 0x23, 0x26, 0x2A, 0x2B, 0x2E,
+                0x31, 0x32, 0x33, 0x36, 0x3A, 0x3B, 0x3E,
+                0xC1, 0xC3, 0xC5, 0xC7, 0xC9, 0xCD, 0xCF, // POP, JP, PUSH, RST, RET, CALL
+                0xD1, 0xD3, 0xD5, 0xD7, 0xD9, 0xDB, 0xDF, // OUT (N),A, EXX, IN A,(N)
+                0xE1, 0xE3, 0xE5, 0xE7, 0xE9, 0xEB, 0xEF, // EX (SP),HL, JP (HL), EX DE,HL
+                0xF3, 0xF7, 0xF9, 0xFB, 0xFF              // DI, LD SP,HL, EI
+            };
+            foreach (var opCode in keepers)
+            {
+                s_KeepsDeferredFlags[opCode] = true;
+            }
+
+            // --- 8-bit loads and HALT
+            for (var opCode = 0x40; opCode < 0x80; opCode++)
+            {
+                s_KeepsDeferredFlags[opCode] = true;
+            }
+
+            // --- ALU operations that do not use the carry
+            for (var opCode = 0x80; opCode < 0xC0; opCode++)
+            {
+                var aluOp = (opCode >> 3) & 0x07;
+                s_KeepsDeferredFlags[opCode] = aluOp != ALU_ADC && aluOp != ALU_SBC;
+            }
+        }
+
+        /// <summary>
+        /// Calculates F, provided the flags of the last ALU operation are deferred
+        /// </summary>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        private void MaterializeFlags()
+        {
+            if (_flagsDeferred)
+            {
+                CalculateDeferredFlags();
+            }
+        }
+
+        /// <summary>
+        /// Calculates F from the stored operands of the last ALU operation
+        /// </summary>
+        private void CalculateDeferredFlags()
+        {
+            _flagsDeferred = false;
+            var left = _deferredLeft;
+            var right = _deferredRight;
+            switch (_deferredAluOp)
+            {
+                case ALU_ADD:
+                case ALU_ADC:
+                    _registers.F = s_AdcFlags[_deferredCarry * 0x10000 + left * 0x100 + right];
+                    return;
+                case ALU_SUB:
+                case ALU_SBC:
+                    _registers.F = s_SbcFlags[_deferredCarry * 0x10000 + left * 0x100 + right];
+                    return;
+                case ALU_AND:
+                    _registers.F = (byte)(s_AluLogOpFlags[left & right] | FlagsSetMask.H);
+                    return;
+                case ALU_XOR:
+                    _registers.F = s_AluLogOpFlags[left ^ right];
+                    return;
+                case ALU_OR:
+                    _registers.F = s_AluLogOpFlags[left | right];
+                    return;
+                default:
+                    _registers.F = (byte)((s_SbcFlags[left * 0x100 + right]
+                                           & FlagsResetMask.R3 & FlagsResetMask.R5)
+                                          | (right & FlagsSetMask.R3R5));
+                    return;
+            }
+        }
+
+        /// <summary>
+        ///     "ALU A,r" and "ALU A,(HL)" operations (0x80..0xBF) with deferred flags
+        /// </summary>
+        /// <remarks>
+        ///     The operation calculates A and stores its operands, so that
+        ///     F can be calculated later. ADC and SBC read the carry, so
+        ///     the flags of the previous operation are already calculated.
+        ///     T-States: 4 (4) or 7 (4, 3) for (HL)
+        ///     Contention breakdown: pc:4 or pc:4,hl:3
+        /// </remarks>
+        private void AluOpDeferred()
+        {
+            byte src;
+            switch (_opCode & 0x07)
+            {
+                case 0: src = _registers.B; break;
+                case 1: src = _registers.C; break;
+                case 2: src = _registers.D; break;
+                case 3: src = _registers.E; break;
+                case 4: src = _registers.H; break;
+                case 5: src = _registers.L; break;
+                case 6:
+                    src = ReadMemory(_registers.HL);
+                    ClockP3();
+                    break;
+                default: src = _registers.A; break;
+            }
+
+            var aluOp = (_opCode >> 3) & 0x07;
+            var carry = aluOp == ALU_ADC || aluOp == ALU_SBC ? _registers.F & FlagsSetMask.C : 0;
+            _deferredAluOp = aluOp;
+            _deferredLeft = _registers.A;
+            _deferredRight = src;
+            _deferredCarry = carry;
+            _flagsDeferred = true;
+
+            switch (aluOp)
+            {
+                case ALU_ADD:
+                case ALU_ADC:
+                    _registers.A += (byte)(src + carry);
+                    break;
+                case ALU_SUB:
+                case ALU_SBC:
+                    _registers.A -= (byte)(src + carry);
+                    break;
+                case ALU_AND:
+                    _registers.A &= src;
+                    break;
+                case ALU_XOR:
+                    _registers.A ^= src;
+                    break;
+                case ALU_OR:
+                    _registers.A |= src;
+                    break;
+            }
+        }
+    }
+}
@@ -57,6 +57,7 @@ namespace Spect.Net.SpectrumEmu.Cpu
                 cpu.AllowExtendedInstructionSet = AllowExtendedInstructionSet;
                 cpu._tacts = Tacts;
                 cpu._registers = Registers;
+                cpu._flagsDeferred = false;
                 cpu.StateFlags = StateFlags;
                 cpu.UseGateArrayContention = UseGateArrayContention;
                 cpu.IFF1 = IFF1;
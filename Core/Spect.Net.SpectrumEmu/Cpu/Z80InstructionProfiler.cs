@@ -0,0 +1,228 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+using Newtonsoft.Json;
+
+namespace Spect.Net.SpectrumEmu.Cpu
+{
+    /// <summary>
+    /// This class collects the number of executions and the T-states
+    /// of the Z80 operation codes
+    /// </summary>
+    /// <remarks>
+    /// The CPU updates the profiler only while it is assigned to the
+    /// Z80Cpu.Profiler property; without a profiler, instruction execution
+    /// costs only a null check. The statistics are updated on the emulation
+    /// thread, so read them while the machine is paused to get consistent
+    /// values.
+    /// </remarks>
+    public class Z80InstructionProfiler
+    {
+        /// <summary>
+        /// Number of operation code pages
+        /// </summary>
+        public const int PAGE_COUNT = 7;
+
+        /// <summary>
+        /// T-states of an uncontended I/O cycle
+        /// </summary>
+        public const int IO_CYCLE_TACTS = 4;
+
+        private static readonly string[] s_Prefixes = { "", "CB", "ED", "DD", "FD", "DD CB", "FD CB" };
+
+        private readonly long[] _counts = new long[PAGE_COUNT * 0x100];
+        private readonly long[] _tacts = new long[PAGE_COUNT * 0x100];
+
+        /// <summary>
+        /// Number of instructions executed
+        /// </summary>
+        public long InstructionCount { get; private set; }
+
+        /// <summary>
+        /// T-states spent in the executed instructions
+        /// </summary>
+        public long InstructionTacts { get; private set; }
+
+        /// <summary>
+        /// T-states spent in memory contention
+        /// </summary>
+        public long MemoryContentionTacts { get; private set; }
+
+        /// <summary>
+        /// T-states spent in I/O contention (I/O cycle time above the
+        /// uncontended four T-states)
+        /// </summary>
+        public long IoContentionTacts { get; private set; }
+
+        /// <summary>
+        /// Gets the prefix bytes of the specified page
+        /// </summary>
+        /// <param name="page">Operation code page</param>
+        /// <returns>Prefix bytes in hexadecimal, separated by space</returns>
+        public static string GetPrefix(Z80OpcodePage page) => s_Prefixes[(int)page];
+
+        /// <summary>
+        /// Records an executed instruction
+        /// </summary>
+        /// <param name="page">Operation code page</param>
+        /// <param name="opCode">Operation code within the page</param>
+        /// <param name="tacts">T-states of the instruction</param>
+        public void RecordInstruction(Z80OpcodePage page, byte opCode, long tacts)
+        {
+            var index = ((int)page << 8) | opCode;
+            _counts[index]++;
+            _tacts[index] += tacts;
+            InstructionCount++;
+            InstructionTacts += tacts;
+        }
+
+        /// <summary>
+        /// Records the T-states of a memory access beyond the uncontended timing
+        /// </summary>
+        /// <param name="tacts">Contention T-states</param>
+        public void RecordMemoryContention(long tacts)
+        {
+            MemoryContentionTacts += tacts;
+        }
+
+        /// <summary>
+        /// Records the T-states of an I/O cycle
+        /// </summary>
+        /// <param name="tacts">T-states spent in the I/O cycle</param>
+        /// <remarks>
+        /// The port devices emulate the entire I/O cycle, so only the time
+        /// above the uncontended cycle counts as contention.
+        /// </remarks>
+        public void RecordIoCycle(long tacts)
+        {
+            if (tacts > IO_CYCLE_TACTS)
+            {
+                IoContentionTacts += tacts - IO_CYCLE_TACTS;
+            }
+        }
+
+        /// <summary>
+        /// Gets the number of executions of the specified operation code
+        /// </summary>
+        /// <param name="page">Operation code page</param>
+        /// <param name="opCode">Operation code within the page</param>
+        public long GetCount(Z80OpcodePage page, byte opCode) => _counts[((int)page << 8) | opCode];
+
+        /// <summary>
+        /// Gets the T-states spent in the specified operation code
+        /// </summary>
+        /// <param name="page">Operation code page</param>
+        /// <param name="opCode">Operation code within the page</param>
+        public long GetTacts(Z80OpcodePage page, byte opCode) => _tacts[((int)page << 8) | opCode];
+
+        /// <summary>
+        /// Gets the number of executions of the operation codes in the specified page
+        /// </summary>
+        /// <param name="page">Operation code page</param>
+        public long GetPageCount(Z80OpcodePage page) => SumPage(_counts, page);
+
+        /// <summary>
+        /// Gets the T-states spent in the operation codes of the specified page
+        /// </summary>
+        /// <param name="page">Operation code page</param>
+        public long GetPageTacts(Z80OpcodePage page) => SumPage(_tacts, page);
+
+        /// <summary>
+        /// Gets the statistics of the executed operation codes, the most
+        /// expensive first
+        /// </summary>
+        public IReadOnlyList<Z80OpcodeStatistics> GetStatistics()
+        {
+            var result = new List<Z80OpcodeStatistics>();
+            for (var i = 0; i < _counts.Length; i++)
+            {
+                if (_counts[i] == 0) continue;
+                result.Add(new Z80OpcodeStatistics((Z80OpcodePage)(i >> 8), (byte)i, _counts[i], _tacts[i]));
+            }
+            return result
+                .OrderByDescending(s => s.Tacts)
+                .ThenBy(s => s.Page)
+                .ThenBy(s => s.OpCode)
+                .ToList();
+        }
+
+        /// <summary>
+        /// Formats the statistics as a text table
+        /// </summary>
+        public string ToTable()
+        {
+            var sb = new StringBuilder();
+            sb.AppendLine("Prefix Op       Count        T-states    Avg   Share");
+            foreach (var stat in GetStatistics())
+            {
+                var share = InstructionTacts == 0 ? 0.0 : 100.0 * stat.Tacts / InstructionTacts;
+                sb.AppendLine($"{stat.Prefix,-6} {stat.OpCode:X2} {stat.Count,11} {stat.Tacts,15} {stat.AverageTacts,6:F1} {share,6:F2}%");
+            }
+            sb.AppendLine($"Instructions: {InstructionCount}, T-states: {InstructionTacts}");
+            sb.AppendLine($"Memory contention: {MemoryContentionTacts}, I/O contention: {IoContentionTacts}");
+            return sb.ToString();
+        }
+
+        /// <summary>
+        /// Formats the statistics as JSON
+        /// </summary>
+        public string ToJson()
+        {
+            var pages = new List<object>();
+            for (var page = 0; page < PAGE_COUNT; page++)
+            {
+                pages.Add(new
+                {
+                    Page = ((Z80OpcodePage)page).ToString(),
+                    Prefix = GetPrefix((Z80OpcodePage)page),
+                    Count = GetPageCount((Z80OpcodePage)page),
+                    Tacts = GetPageTacts((Z80OpcodePage)page)
+                });
+            }
+            return JsonConvert.SerializeObject(new
+            {
+                InstructionCount,
+                InstructionTacts,
+                MemoryContentionTacts,
+                IoContentionTacts,
+                Pages = pages,
+                OpCodes = GetStatistics().Select(s => new
+                {
+                    Page = s.Page.ToString(),
+                    s.Prefix,
+                    OpCode = s.OpCode.ToString("X2"),
+                    s.Count,
+                    s.Tacts
+                })
+            }, Formatting.Indented);
+        }
+
+        /// <summary>
+        /// Removes the collected statistics
+        /// </summary>
+        public void Clear()
+        {
+            Array.Clear(_counts, 0, _counts.Length);
+            Array.Clear(_tacts, 0, _tacts.Length);
+            InstructionCount = 0;
+            InstructionTacts = 0;
+            MemoryContentionTacts = 0;
+            IoContentionTacts = 0;
+        }
+
+        /// <summary>
+        /// Sums the values of the specified page
+        /// </summary>
+        private static long SumPage(long[] values, Z80OpcodePage page)
+        {
+            var sum = 0L;
+            var start = (int)page << 8;
+            for (var i = start; i < start + 0x100; i++)
+            {
+                sum += values[i];
+            }
+            return sum;
+        }
+    }
+}
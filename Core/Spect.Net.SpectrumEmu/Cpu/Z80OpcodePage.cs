@@ -0,0 +1,30 @@
+﻿namespace Spect.Net.SpectrumEmu.Cpu
+{
+    /// <summary>
+    /// This enum represents the Z80 operation code pages, selected by the
+    /// prefixes of the instructions
+    /// </summary>
+    public enum Z80OpcodePage : byte
+    {
+        /// <summary>Standard operations (no prefix)</summary>
+        Standard = 0,
+
+        /// <summary>Bit operations (0xCB prefix)</summary>
+        Bit,
+
+        /// <summary>Extended operations (0xED prefix)</summary>
+        Extended,
+
+        /// <summary>IX-indexed operations (0xDD prefix)</summary>
+        IndexedIx,
+
+        /// <summary>IY-indexed operations (0xFD prefix)</summary>
+        IndexedIy,
+
+        /// <summary>IX-indexed bit operations (0xDD 0xCB prefix)</summary>
+        IndexedBitIx,
+
+        /// <summary>IY-indexed bit operations (0xFD 0xCB prefix)</summary>
+        IndexedBitIy
+    }
+}
@@ -0,0 +1,50 @@
+﻿namespace Spect.Net.SpectrumEmu.Cpu
+{
+    /// <summary>
+    /// This class represents the execution statistics of a single
+    /// Z80 operation code
+    /// </summary>
+    public class Z80OpcodeStatistics
+    {
+        /// <summary>
+        /// The operation code page
+        /// </summary>
+        public Z80OpcodePage Page { get; }
+
+        /// <summary>
+        /// The prefix bytes of the page (e.g. "DD CB")
+        /// </summary>
+        public string Prefix => Z80InstructionProfiler.GetPrefix(Page);
+
+        /// <summary>
+        /// The operation code within the page
+        /// </summary>
+        public byte OpCode { get; }
+
+        /// <summary>
+        /// Number of executions
+        /// </summary>
+        public long Count { get; }
+
+        /// <summary>
+        /// T-states spent in the operation, including prefixes and contention
+        /// </summary>
+        public long Tacts { get; }
+
+        /// <summary>
+        /// Average T-states of an execution
+        /// </summary>
+        public double AverageTacts => Count == 0 ? 0.0 : (double)Tacts / Count;
+
+        /// <summary>
+        /// Initializes the statistics of the specified operation code
+        /// </summary>
+        public Z80OpcodeStatistics(Z80OpcodePage page, byte opCode, long count, long tacts)
+        {
+            Page = page;
+            OpCode = opCode;
+            Count = count;
+            Tacts = tacts;
+        }
+    }
+}
@@ -427,15 +427,15 @@ namespace Spect.Net.SpectrumEmu.Cpu
             }
             else
             {
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
                 ClockP1();
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
                 ClockP1();
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
                 ClockP1();
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
                 ClockP1();
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
                 ClockP1();
             }
             var oldPc = _registers.PC - 2;
@@ -824,15 +824,15 @@ namespace Spect.Net.SpectrumEmu.Cpu
             }
             else
             {
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
                 ClockP1();
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
                 ClockP1();
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
                 ClockP1();
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
                 ClockP1();
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
                 ClockP1();
             }
             _registers.WZ = _registers.PC = (ushort)(_registers.PC + (sbyte)e);
@@ -1071,15 +1071,15 @@ namespace Spect.Net.SpectrumEmu.Cpu
             }
             else
             {
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
                 ClockP1();
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
                 ClockP1();
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
                 ClockP1();
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
                 ClockP1();
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
                 ClockP1();
             }
             _registers.WZ = _registers.PC = (ushort) (_registers.PC + (sbyte) e);
@@ -1288,15 +1288,15 @@ namespace Spect.Net.SpectrumEmu.Cpu
             }
             else
             {
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
                 ClockP1();
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
                 ClockP1();
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
                 ClockP1();
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
                 ClockP1();
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
                 ClockP1();
             }
             _registers.WZ = _registers.PC = (ushort) (_registers.PC + (sbyte) e);
@@ -1551,15 +1551,15 @@ namespace Spect.Net.SpectrumEmu.Cpu
             }
             else
             {
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
                 ClockP1();
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
                 ClockP1();
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
                 ClockP1();
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
                 ClockP1();
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
                 ClockP1();
             }
             _registers.WZ = _registers.PC = (ushort) (_registers.PC + (sbyte) e);
@@ -4523,7 +4523,7 @@ namespace Spect.Net.SpectrumEmu.Cpu
             var oldPc = _registers.PC;
             if (!UseGateArrayContention)
             {
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
             }
             ClockP1();
 
@@ -4800,7 +4800,7 @@ namespace Spect.Net.SpectrumEmu.Cpu
             var oldPc = _registers.PC;
             if (!UseGateArrayContention)
             {
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
             }
             ClockP1();
 
@@ -4858,7 +4858,7 @@ namespace Spect.Net.SpectrumEmu.Cpu
             _registers.PC++;
             if (!UseGateArrayContention)
             {
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
             }
             ClockP1();
 
@@ -5126,7 +5126,7 @@ namespace Spect.Net.SpectrumEmu.Cpu
             var oldPc = _registers.PC;
             if (!UseGateArrayContention)
             {
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
             }
             ClockP1();
 
@@ -5410,7 +5410,7 @@ namespace Spect.Net.SpectrumEmu.Cpu
 
             if (!UseGateArrayContention)
             {
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
             }
             ClockP1();
 
@@ -5706,7 +5706,7 @@ namespace Spect.Net.SpectrumEmu.Cpu
 
             if (!UseGateArrayContention)
             {
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
             }
             ClockP1();
 
@@ -5983,7 +5983,7 @@ namespace Spect.Net.SpectrumEmu.Cpu
 
             if (!UseGateArrayContention)
             {
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
             }
             ClockP1();
 
@@ -6237,7 +6237,7 @@ namespace Spect.Net.SpectrumEmu.Cpu
 
             if (!UseGateArrayContention)
             {
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
             }
             ClockP1();
 
@@ -6518,7 +6518,7 @@ namespace Spect.Net.SpectrumEmu.Cpu
 
             if (!UseGateArrayContention)
             {
-                ReadMemory(Registers.PC);
+                ReadMemory(_registers.PC);
             }
             ClockP1();
 
@@ -0,0 +1,183 @@
+﻿using System;
+
+namespace Spect.Net.SpectrumEmu.Devices.Beeper
+{
+    /// <summary>
+    /// This class renders a 1-bit signal (such as the EAR bit) from the CPU
+    /// tacts of its edges, using band-limited steps (BLEP)
+    /// </summary>
+    /// <remarks>
+    /// Each edge is rendered as the integral of a windowed sinc instead of
+    /// an instant jump. Edges between two sample points are not lost, and
+    /// they do not alias. The output is delayed by the half width of the
+    /// step, so an edge changes only the samples after its CPU tact.
+    /// The rendering cost depends on the number of edges, and not on the
+    /// number of CPU tacts.
+    /// </remarks>
+    public class BandLimitedStepSynthesizer
+    {
+        /// <summary>
+        /// Default half width of a step, given in samples
+        /// </summary>
+        public const int DEFAULT_HALF_WIDTH = 8;
+
+        // --- Cutoff frequency relative to the sample rate
+        private const double CUTOFF = 0.45;
+        private const int INITIAL_EDGE_CAPACITY = 1024;
+
+        private readonly int _tactsPerSample;
+        private readonly float[] _residual;
+        private long[] _edgeTacts = new long[INITIAL_EDGE_CAPACITY];
+        private float[] _edgeDeltas = new float[INITIAL_EDGE_CAPACITY];
+        private int _edgeCount;
+        private float _level;
+
+        /// <summary>
+        /// The delay of the output, given in CPU tacts
+        /// </summary>
+        public int Delay { get; }
+
+        /// <summary>
+        /// Number of edges waiting to be rendered
+        /// </summary>
+        public int EdgeCount => _edgeCount;
+
+        /// <summary>
+        /// Initializes the synthesizer
+        /// </summary>
+        /// <param name="tactsPerSample">Number of CPU tacts between two samples</param>
+        /// <param name="halfWidth">Half width of a step, given in samples</param>
+        public BandLimitedStepSynthesizer(int tactsPerSample, int halfWidth = DEFAULT_HALF_WIDTH)
+        {
+            _tactsPerSample = tactsPerSample;
+            Delay = halfWidth * tactsPerSample;
+            _residual = CreateResidualTable(tactsPerSample, halfWidth);
+        }
+
+        /// <summary>
+        /// Removes the pending edges, and sets the output level
+        /// </summary>
+        /// <param name="level">Output level</param>
+        public void Reset(float level = 0.0f)
+        {
+            _edgeCount = 0;
+            _level = level;
+        }
+
+        /// <summary>
+        /// Records an edge of the signal
+        /// </summary>
+        /// <param name="tact">CPU tact of the edge</param>
+        /// <param name="delta">Level change of the edge</param>
+        /// <remarks>
+        /// Edges must be recorded in the order of their CPU tacts
+        /// </remarks>
+        public void AddEdge(long tact, float delta)
+        {
+            if (_edgeCount == _edgeTacts.Length)
+            {
+                Array.Resize(ref _edgeTacts, _edgeCount * 2);
+                Array.Resize(ref _edgeDeltas, _edgeCount * 2);
+            }
+            _edgeTacts[_edgeCount] = tact + Delay;
+            _edgeDeltas[_edgeCount] = delta;
+            _edgeCount++;
+        }
+
+        /// <summary>
+        /// Renders a block of samples. Subsequent blocks must be contiguous.
+        /// </summary>
+        /// <param name="samples">Sample buffer</param>
+        /// <param name="index">Index of the first sample within the buffer</param>
+        /// <param name="count">Number of samples to render</param>
+        /// <param name="firstSampleTact">CPU tact of the first sample</param>
+        public void Render(float[] samples, int index, int count, long firstSampleTact)
+        {
+            if (count <= 0) return;
+            var endTact = firstSampleTact + (long)count * _tactsPerSample;
+            var end = index + count;
+
+            // --- Fill the samples with the plain step signal. Edges before the
+            // --- block have already changed the level in a previous block.
+            var sampleIndex = index;
+            for (var e = 0; e < _edgeCount; e++)
+            {
+                var edgeTact = _edgeTacts[e];
+                if (edgeTact < firstSampleTact) continue;
+                if (edgeTact >= endTact) break;
+
+                var edgeSample = index + (int)((edgeTact - firstSampleTact + _tactsPerSample - 1) / _tactsPerSample);
+                while (sampleIndex < edgeSample)
+                {
+                    samples[sampleIndex++] = _level;
+                }
+                _level += _edgeDeltas[e];
+            }
+            while (sampleIndex < end)
+            {
+                samples[sampleIndex++] = _level;
+            }
+
+            // --- Add the band-limited residual of each edge, and keep the
+            // --- edges that still affect the next block
+            var kept = 0;
+            for (var e = 0; e < _edgeCount; e++)
+            {
+                var edgeTact = _edgeTacts[e];
+                var delta = _edgeDeltas[e];
+                var windowStart = edgeTact - Delay - firstSampleTact;
+                var windowEnd = edgeTact + Delay - firstSampleTact;
+                if (windowEnd >= 0 && windowStart < (long)count * _tactsPerSample)
+                {
+                    var first = windowStart <= 0 ? 0 : (int)((windowStart + _tactsPerSample - 1) / _tactsPerSample);
+                    var last = (int)Math.Min(count - 1, windowEnd / _tactsPerSample);
+                    var offset = (int)(first * (long)_tactsPerSample - windowStart);
+                    for (var i = first; i <= last; i++)
+                    {
+                        samples[index + i] += delta * _residual[offset];
+                        offset += _tactsPerSample;
+                    }
+                }
+                if (edgeTact + Delay >= endTact)
+                {
+                    _edgeTacts[kept] = edgeTact;
+                    _edgeDeltas[kept] = delta;
+                    kept++;
+                }
+            }
+            _edgeCount = kept;
+        }
+
+        /// <summary>
+        /// Creates the table of the difference between the band-limited step
+        /// and the ideal step, for every CPU tact within the step
+        /// </summary>
+        private static float[] CreateResidualTable(int tactsPerSample, int halfWidth)
+        {
+            var delay = halfWidth * tactsPerSample;
+            var length = 2 * delay + 1;
+            var impulse = new double[length];
+            var total = 0.0;
+            for (var k = 0; k < length; k++)
+            {
+                // --- Blackman-windowed sinc, position given in samples
+                var u = (double)(k - delay) / tactsPerSample;
+                var x = 2 * CUTOFF * u;
+                var sinc = Math.Abs(x) < 1e-9 ? 1.0 : Math.Sin(Math.PI * x) / (Math.PI * x);
+                var window = 0.42 + 0.5 * Math.Cos(Math.PI * u / halfWidth)
+                    + 0.08 * Math.Cos(2 * Math.PI * u / halfWidth);
+                impulse[k] = sinc * window;
+                total += impulse[k];
+            }
+
+            var residual = new float[length];
+            var step = 0.0;
+            for (var k = 0; k < length; k++)
+            {
+                step += impulse[k] / total;
+                residual[k] = (float)(step - (k >= delay ? 1.0 : 0.0));
+            }
+            return residual;
+        }
+    }
+}
@@ -1,4 +1,5 @@
 ﻿using System;
+using System.Collections.Generic;
 using Spect.Net.SpectrumEmu.Abstraction.Configuration;
 using Spect.Net.SpectrumEmu.Abstraction.Devices;
 using Spect.Net.SpectrumEmu.Abstraction.Providers;
@@ -15,6 +16,8 @@ namespace Spect.Net.SpectrumEmu.Devices.Beeper
         private int _frameTacts;
         private int _tactsPerSample;
         private bool _useTapeMode;
+        private BandLimitedStepSynthesizer _synthesizer;
+        private readonly Dictionary<int, float[]> _sampleBuffers = new Dictionary<int, float[]>();
 
         /// <summary>
         /// Audio samples to build the audio stream
@@ -41,6 +44,9 @@ namespace Spect.Net.SpectrumEmu.Devices.Beeper
             _beeperProvider = hostVm.BeeperProvider;
             _frameTacts = hostVm.FrameTacts;
             _tactsPerSample = _audioConfiguration.TactsPerSample;
+            _synthesizer = _audioConfiguration.BandLimitedSynthesis
+                ? new BandLimitedStepSynthesizer(_tactsPerSample)
+                : null;
             Reset();
         }
 
@@ -54,6 +60,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Beeper
             FrameCount = 0;
             Overflow = 0;
             _useTapeMode = false;
+            _synthesizer?.Reset();
             _beeperProvider?.Reset();
             InitializeSampling();
         }
@@ -100,7 +107,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Beeper
             FrameCount++;
             InitializeSampling();
 
-            if (Overflow != 0)
+            if (Overflow != 0 && _synthesizer == null)
             {
                 // --- Managed overflown samples
                 CreateSamples(_frameBegins + Overflow);
@@ -113,7 +120,15 @@ namespace Spect.Net.SpectrumEmu.Devices.Beeper
         /// </summary>
         public void OnFrameCompleted()
         {
-            if (LastSampleTact < _frameBegins + _frameTacts)
+            if (_synthesizer != null)
+            {
+                // --- Render the recorded edges of the frame
+                var count = AudioSamples.Length - NextSampleIndex;
+                _synthesizer.Render(AudioSamples, NextSampleIndex, count, LastSampleTact);
+                NextSampleIndex += count;
+                LastSampleTact += (long)count * _tactsPerSample;
+            }
+            else if (LastSampleTact < _frameBegins + _frameTacts)
             {
                 // --- Expand the samples till the end of the frame
                 CreateSamples(_frameBegins + _frameTacts);
@@ -153,7 +168,15 @@ namespace Spect.Net.SpectrumEmu.Devices.Beeper
                 return;
             }
 
-            CreateSamples(HostVm.Cpu.Tacts);
+            if (_synthesizer != null)
+            {
+                // --- Edges are rendered when the frame completes
+                _synthesizer.AddEdge(HostVm.Cpu.Tacts, earBit ? 1.0f : -1.0f);
+            }
+            else
+            {
+                CreateSamples(HostVm.Cpu.Tacts);
+            }
             LastEarBit = earBit;
         }
 
@@ -178,8 +201,18 @@ namespace Spect.Net.SpectrumEmu.Devices.Beeper
                 : _frameBegins + _tactsPerSample - (_frameBegins + _tactsPerSample) % _tactsPerSample;
             var samplesInFrame = (_frameBegins + _frameTacts - LastSampleTact - 1) / _tactsPerSample + 1;
 
-            // --- Empty the samples array
-            AudioSamples = new float[samplesInFrame];
+            // --- Reuse the samples array of the same length. The number of samples
+            // --- may vary by one between frames, so we keep a buffer for each length.
+            if (!_sampleBuffers.TryGetValue((int)samplesInFrame, out var samples))
+            {
+                samples = new float[samplesInFrame];
+                _sampleBuffers[(int)samplesInFrame] = samples;
+            }
+            else
+            {
+                Array.Clear(samples, 0, samples.Length);
+            }
+            AudioSamples = samples;
             NextSampleIndex = 0;
         }
 
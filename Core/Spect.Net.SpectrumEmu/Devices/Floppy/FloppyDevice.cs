@@ -2,15 +2,34 @@
 using System.Threading.Tasks;
 using Spect.Net.SpectrumEmu.Abstraction.Configuration;
 using Spect.Net.SpectrumEmu.Abstraction.Devices;
+using Spect.Net.SpectrumEmu.Cpu;
+using Spect.Net.SpectrumEmu.Devices.Rom;
 
 namespace Spect.Net.SpectrumEmu.Devices.Floppy
 {
     /// <summary>
     /// Floppy device emulation
     /// </summary>
-    public class FloppyDevice: IFloppyDevice
+    /// <remarks>
+    /// In fast disk mode the device traps the DD_READ_SECTOR and
+    /// DD_WRITE_SECTOR routines of +3DOS, and transfers the sector between
+    /// the memory and the virtual floppy without emulating the controller.
+    /// </remarks>
+    public class FloppyDevice: IFloppyDevice, ICpuOperationBoundDevice
     {
+        // --- Offsets within the extended disk parameter block (XDPB)
+        private const int XDPB_SIDEDNESS = 17;
+        private const int XDPB_TRACKS_PER_SIDE = 18;
+        private const int XDPB_SECTORS_PER_TRACK = 19;
+        private const int XDPB_SECTOR_SIZE = 21;
+
         private readonly object _locker = new object();
+        private readonly byte[] _fastSectorBuffer = new byte[VirtualFloppyFile.SECTOR_SIZE];
+        private IZ80Cpu _cpu;
+        private IMemoryDevice _memoryDevice;
+        private int _dosRomIndex = -1;
+        private ushort _readSectorAddress;
+        private ushort _writeSectorAddress;
         private IFloppyConfiguration _config;
         private bool _acceptCommand;
         private Command _lastCommand;
@@ -54,6 +73,39 @@ namespace Spect.Net.SpectrumEmu.Devices.Floppy
         {
             HostVm = hostVm;
             _config = hostVm.FloppyConfiguration;
+            _cpu = hostVm.Cpu;
+            _memoryDevice = hostVm.MemoryDevice;
+
+            // --- Find the ROM with the +3DOS routines
+            _dosRomIndex = -1;
+            _readSectorAddress = _writeSectorAddress = 0;
+            for (var i = 0; i < hostVm.RomConfiguration.NumberOfRoms; i++)
+            {
+                var readAddress = hostVm.RomDevice.GetKnownAddress(SpectrumRomDevice.DD_READ_SECTOR_ADDRESS, i);
+                var writeAddress = hostVm.RomDevice.GetKnownAddress(SpectrumRomDevice.DD_WRITE_SECTOR_ADDRESS, i);
+                if (readAddress == null || writeAddress == null) continue;
+                _dosRomIndex = i;
+                _readSectorAddress = readAddress.Value;
+                _writeSectorAddress = writeAddress.Value;
+                break;
+            }
+        }
+
+        /// <summary>
+        /// Services the +3DOS sector routines in fast disk mode
+        /// </summary>
+        public void OnCpuOperationCompleted()
+        {
+            var pc = _cpu.PC;
+            if (pc != _readSectorAddress && pc != _writeSectorAddress
+                || _cpu.IsInOpExecution
+                || _dosRomIndex < 0
+                || !(HostVm.ExecuteCycleOptions?.FastDiskMode ?? false)
+                || _memoryDevice.GetSelectedRomIndex() != _dosRomIndex)
+            {
+                return;
+            }
+            FastTransferSector(pc == _writeSectorAddress);
         }
 
         /// <summary>
@@ -586,6 +638,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Floppy
         {
             lock (_locker)
             {
+                FlushFloppy(DriveAFloppy);
                 DriveAFloppy = VirtualFloppyFile.OpenFloppyFile(vfddPath);
             }
             return Task.FromResult(0);
@@ -599,6 +652,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Floppy
         {
             lock (_locker)
             {
+                FlushFloppy(DriveBFloppy);
                 DriveBFloppy = VirtualFloppyFile.OpenFloppyFile(vfddPath);
             }
             return Task.FromResult(0);
@@ -611,6 +665,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Floppy
         {
             lock (_locker)
             {
+                FlushFloppy(DriveAFloppy);
                 DriveAFloppy = null;
             }
             return Task.FromResult(0);
@@ -623,11 +678,30 @@ namespace Spect.Net.SpectrumEmu.Devices.Floppy
         {
             lock (_locker)
             {
+                FlushFloppy(DriveBFloppy);
                 DriveBFloppy = null;
             }
             return Task.FromResult(0);
         }
 
+        /// <summary>
+        /// Writes the pending changes of the inserted floppies into their files
+        /// </summary>
+        public void Flush()
+        {
+            lock (_locker)
+            {
+                if (!FlushFloppy(DriveAFloppy))
+                {
+                    DriveAFloppy = null;
+                }
+                if (!FlushFloppy(DriveBFloppy))
+                {
+                    DriveBFloppy = null;
+                }
+            }
+        }
+
         #region Helpers
 
         /// <summary>
@@ -667,6 +741,132 @@ namespace Spect.Net.SpectrumEmu.Devices.Floppy
             }, _dataResult);
         }
 
+        /// <summary>
+        /// Transfers a sector for the DD_READ_SECTOR or DD_WRITE_SECTOR routine
+        /// </summary>
+        /// <param name="write">True for DD_WRITE_SECTOR</param>
+        /// <returns>True, if the transfer is done; false to let the ROM do it</returns>
+        /// <remarks>
+        /// On entry B is the RAM page at #C000 for the buffer, C the unit,
+        /// D the logical track, E the logical sector, HL the buffer address,
+        /// and IX the address of the XDPB. Errors (no disk, write protection,
+        /// unsupported geometry) are left to the ROM, so it can report them.
+        /// </remarks>
+        private bool FastTransferSector(bool write)
+        {
+            ref var regs = ref _cpu.Registers;
+            var floppy = (regs.C & 0x01) == 0 ? DriveAFloppy : DriveBFloppy;
+            if (floppy == null || write && floppy.IsWriteProtected) return false;
+
+            // --- Map the logical track and sector to a physical position
+            var xdpb = regs.IX;
+            var tracksPerSide = ReadMemory((ushort)(xdpb + XDPB_TRACKS_PER_SIDE));
+            if (ReadMemory((ushort)(xdpb + XDPB_SECTOR_SIZE)) != 2
+                || regs.E >= ReadMemory((ushort)(xdpb + XDPB_SECTORS_PER_TRACK))
+                || tracksPerSide == 0)
+            {
+                return false;
+            }
+            int head;
+            int track;
+            switch (ReadMemory((ushort)(xdpb + XDPB_SIDEDNESS)) & 0x03)
+            {
+                case 0:
+                    head = 0;
+                    track = regs.D;
+                    break;
+                case 1:
+                    head = regs.D & 0x01;
+                    track = regs.D >> 1;
+                    break;
+                default:
+                    head = regs.D >= tracksPerSide ? 1 : 0;
+                    track = regs.D % tracksPerSide;
+                    break;
+            }
+            if (head == 1 && !floppy.IsDoubleSided) return false;
+
+            var bank = _memoryDevice.GetRamBank(regs.B & 0x07);
+            try
+            {
+                if (write)
+                {
+                    for (var i = 0; i < _fastSectorBuffer.Length; i++)
+                    {
+                        _fastSectorBuffer[i] = ReadBuffer(bank, (ushort)(regs.HL + i));
+                    }
+                    floppy.WriteData(head, track, regs.E + 1, _fastSectorBuffer);
+                }
+                else
+                {
+                    floppy.ReadData(head, track, regs.E + 1, _fastSectorBuffer);
+                    for (var i = 0; i < _fastSectorBuffer.Length; i++)
+                    {
+                        WriteBuffer(bank, (ushort)(regs.HL + i), _fastSectorBuffer[i]);
+                    }
+                }
+            }
+            catch (ArgumentException)
+            {
+                // --- The position is not on the disk
+                return false;
+            }
+
+            // --- Carry is set to sign success, then return to the caller
+            regs.F |= FlagsSetMask.C;
+            regs.PC = (ushort)(ReadMemory(regs.SP) | ReadMemory((ushort)(regs.SP + 1)) << 8);
+            regs.SP += 2;
+            return true;
+        }
+
+        /// <summary>
+        /// Reads a byte from the memory without contention
+        /// </summary>
+        private byte ReadMemory(ushort address) => _memoryDevice.Read(address, true);
+
+        /// <summary>
+        /// Reads a byte of a sector buffer; from #C000 the buffer is in the
+        /// specified RAM bank
+        /// </summary>
+        private byte ReadBuffer(byte[] bank, ushort address)
+            => address >= 0xC000
+                ? bank[address - 0xC000]
+                : _memoryDevice.Read(address, true);
+
+        /// <summary>
+        /// Writes a byte of a sector buffer; from #C000 the buffer is in the
+        /// specified RAM bank
+        /// </summary>
+        private void WriteBuffer(byte[] bank, ushort address, byte value)
+        {
+            if (address >= 0xC000)
+            {
+                bank[address - 0xC000] = value;
+            }
+            else
+            {
+                _memoryDevice.Write(address, value, true);
+            }
+        }
+
+        /// <summary>
+        /// Writes the pending changes of the specified floppy into its file
+        /// </summary>
+        /// <returns>False, if the floppy file cannot be written</returns>
+        private static bool FlushFloppy(VirtualFloppyFile floppy)
+        {
+            try
+            {
+                floppy?.Flush();
+                return true;
+            }
+            catch
+            {
+                // --- Probably the disk file has been deleted
+                return false;
+            }
+        }
+
         /// <summary>
         /// Ejects the current drive (as a result of unexpected error)
         /// </summary>
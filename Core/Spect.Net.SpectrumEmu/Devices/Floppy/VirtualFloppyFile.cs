@@ -8,6 +8,14 @@ namespace Spect.Net.SpectrumEmu.Devices.Floppy
     /// <summary>
     /// This class implements a virtual floppy file
     /// </summary>
+    /// <remarks>
+    /// The whole disk image is kept in memory while the floppy is used, so
+    /// reading a sector does not touch the file. Written sectors are
+    /// appended to a journal file next to the image, and they are copied
+    /// into the image file only when the floppy is flushed. If the
+    /// emulator stops without flushing, the journal is replayed the next
+    /// time the image is opened.
+    /// </remarks>
     public class VirtualFloppyFile
     {
         // ReSharper disable once InconsistentNaming
@@ -23,6 +31,22 @@ namespace Spect.Net.SpectrumEmu.Devices.Floppy
         /// </summary>
         public const int HEADER_SIZE = 8;
 
+        /// <summary>
+        /// Extension appended to the image name to get the journal file name
+        /// </summary>
+        public const string JOURNAL_EXTENSION = ".journal";
+
+        /// <summary>
+        /// Size of a journal record header (position and length)
+        /// </summary>
+        private const int JOURNAL_RECORD_HEADER = 6;
+
+        private readonly object _writeLock = new object();
+        private readonly byte[] _image;
+        private readonly bool[] _dirtySectors;
+        private int _dirtyCount;
+        private FileStream _journal;
+
         /// <summary>
         /// Disk format
         /// </summary>
@@ -63,6 +87,16 @@ namespace Spect.Net.SpectrumEmu.Devices.Floppy
         /// </summary>
         public List<byte> FormatSpec { get; }
 
+        /// <summary>
+        /// The name of the write journal of the floppy file
+        /// </summary>
+        public string JournalFilename => Filename + JOURNAL_EXTENSION;
+
+        /// <summary>
+        /// Signs if there are written sectors not flushed to the image file yet
+        /// </summary>
+        public bool HasPendingWrites => _dirtyCount > 0;
+
         /// <summary>
         /// Checks if the current drive is Spectrum compatible
         /// </summary>
@@ -76,9 +110,11 @@ namespace Spect.Net.SpectrumEmu.Devices.Floppy
         /// We do not allow direct instantiation
         /// </summary>
         private VirtualFloppyFile(string filename, bool isWriteProtected, 
-            IReadOnlyList<byte> formatSpec, byte firsSectorIndex)
+            IReadOnlyList<byte> formatSpec, byte firsSectorIndex, byte[] image)
         {
             Filename = filename;
+            _image = image;
+            _dirtySectors = new bool[(image.Length - HEADER_SIZE) / SECTOR_SIZE];
             FormatSpec = new List<byte>(formatSpec);
             IsWriteProtected = isWriteProtected;
             IsDoubleSided = formatSpec[1] != 0;
@@ -115,33 +151,34 @@ namespace Spect.Net.SpectrumEmu.Devices.Floppy
             {
                 Directory.CreateDirectory(dir);
             }
-            using (var writer = new BinaryWriter(File.Create(filename)))
+            if (!s_FormatHeaders.TryGetValue(format, out var formatDesc))
             {
-                if (!s_FormatHeaders.TryGetValue(format, out var formatDesc))
-                {
-                    formatDesc = s_DefaultFormatDescriptor;
-                }
-                var formatBytes = formatDesc.Format;
-                var floppy = new VirtualFloppyFile(filename, false, formatBytes, formatDesc.SectorIndex);
-                writer.Write(HEADER);
-                writer.Write(floppy.IsWriteProtected ? (byte)0x01 : (byte)0x00);
-                writer.Write(floppy.IsDoubleSided ? (byte)0x01 : (byte)0x00);
-                writer.Write(floppy.Tracks);
-                writer.Write(floppy.SectorsPerTrack);
-                writer.Write(floppy.FirstSectorIndex);
-                var sectorData = new byte[512];
-                for (var i = 0; i < sectorData.Length; i++)
-                {
-                    sectorData[i] = 0xE5;
-                }
-                for (var i = 0; i < (floppy.IsDoubleSided ? 2 : 1) * floppy.Tracks * floppy.SectorsPerTrack; i++)
-                {
-                    writer.Write(sectorData);
-                }
-                writer.Seek(HEADER_SIZE, SeekOrigin.Begin);
-                writer.Write(formatBytes);
-                return floppy;
+                formatDesc = s_DefaultFormatDescriptor;
             }
+            var formatBytes = formatDesc.Format;
+            var isDoubleSided = formatBytes[1] != 0;
+            var sectors = (isDoubleSided ? 2 : 1) * formatBytes[2] * formatBytes[3];
+
+            // --- Compose the image: header, then the sectors filled with 0xE5
+            var image = new byte[HEADER_SIZE + sectors * SECTOR_SIZE];
+            for (var i = HEADER_SIZE; i < image.Length; i++)
+            {
+                image[i] = 0xE5;
+            }
+            HEADER.CopyTo(image, 0);
+            image[HEADER.Length] = 0x00;
+            image[HEADER.Length + 1] = isDoubleSided ? (byte)0x01 : (byte)0x00;
+            image[HEADER.Length + 2] = formatBytes[2];
+            image[HEADER.Length + 3] = formatBytes[3];
+            image[HEADER.Length + 4] = formatDesc.SectorIndex;
+
+            // --- The format specification overwrites the start of the first sector
+            formatBytes.CopyTo(image, HEADER_SIZE);
+            File.WriteAllBytes(filename, image);
+
+            // --- A journal of a former image with the same name must not be replayed
+            File.Delete(filename + JOURNAL_EXTENSION);
+            return new VirtualFloppyFile(filename, false, formatBytes, formatDesc.SectorIndex, image);
         }
 
         /// <summary>
@@ -151,39 +188,33 @@ namespace Spect.Net.SpectrumEmu.Devices.Floppy
         /// <returns>The opened floppy file</returns>
         public static VirtualFloppyFile OpenFloppyFile(string filename)
         {
-            using (var reader = new BinaryReader(File.OpenRead(filename)))
+            // --- Apply the writes a former session could not flush
+            RecoverJournal(filename);
+
+            var image = File.ReadAllBytes(filename);
+            if (image.Length < HEADER_SIZE || !image.Take(HEADER.Length).SequenceEqual(HEADER))
             {
-                var header = reader.ReadBytes(HEADER.Length);
-                if (!header.SequenceEqual(HEADER))
-                {
-                    throw new InvalidOperationException("Invalid floppy file header");
-                }
+                throw new InvalidOperationException("Invalid floppy file header");
+            }
 
-                var isWriteProtected = reader.ReadByte() != 0x00;
-                var isDoubleSided  = reader.ReadByte() != 0x00;
-                var tracks = reader.ReadByte();
-                var sectorsPerTrack = reader.ReadByte();
-                var firstSector = reader.ReadByte();
-                var lengthRead = 0;
-                for (var i = 0; i < (isDoubleSided ? 2 : 1) * tracks * sectorsPerTrack; i++)
-                {
-                    var sectorData = reader.ReadBytes(512);
-                    lengthRead += sectorData.Length;
-                    if (sectorData.Length < 512)
-                    {
-                        throw new InvalidOperationException(
-                            $"Floppy file is shorter then expected, its size is {lengthRead} bytes.");
-                    }
-                }
-                reader.BaseStream.Seek(HEADER_SIZE, SeekOrigin.Begin);
-                var formatSpec = reader.ReadBytes(10);
-                var floppy = new VirtualFloppyFile(filename, isWriteProtected, formatSpec, firstSector);
-                if (!floppy.IsSpectrumVmCompatible())
-                {
-                    throw new InvalidOperationException("Floppy file is not Spectrum compatible");
-                }
-                return floppy;
+            var isWriteProtected = image[HEADER.Length] != 0x00;
+            var isDoubleSided = image[HEADER.Length + 1] != 0x00;
+            var tracks = image[HEADER.Length + 2];
+            var sectorsPerTrack = image[HEADER.Length + 3];
+            var firstSector = image[HEADER.Length + 4];
+            var sectors = (isDoubleSided ? 2 : 1) * tracks * sectorsPerTrack;
+            if (image.Length < HEADER_SIZE + sectors * SECTOR_SIZE)
+            {
+                throw new InvalidOperationException(
+                    $"Floppy file is shorter then expected, its size is {image.Length - HEADER_SIZE} bytes.");
             }
+            var formatSpec = image.Skip(HEADER_SIZE).Take(10).ToArray();
+            var floppy = new VirtualFloppyFile(filename, isWriteProtected, formatSpec, firstSector, image);
+            if (!floppy.IsSpectrumVmCompatible())
+            {
+                throw new InvalidOperationException("Floppy file is not Spectrum compatible");
+            }
+            return floppy;
         }
 
         /// <summary>
@@ -262,10 +293,32 @@ namespace Spect.Net.SpectrumEmu.Devices.Floppy
                 throw new ArgumentException($"Data cannot be longer than {SECTOR_SIZE} bytes", nameof(data));
             }
 
-            using (var writer = new BinaryWriter(File.OpenWrite(Filename)))
+            var position = CalculateSectorPosition(head, track, sector);
+            lock (_writeLock)
             {
-                writer.Seek(CalculateSectorPosition(head, track, sector), SeekOrigin.Begin);
-                writer.Write(data);
+                // --- Journal the write first, so that it survives a crash
+                var record = new byte[JOURNAL_RECORD_HEADER + data.Length];
+                record[0] = (byte)position;
+                record[1] = (byte)(position >> 8);
+                record[2] = (byte)(position >> 16);
+                record[3] = (byte)(position >> 24);
+                record[4] = (byte)data.Length;
+                record[5] = (byte)(data.Length >> 8);
+                data.CopyTo(record, JOURNAL_RECORD_HEADER);
+                if (_journal == null)
+                {
+                    _journal = new FileStream(JournalFilename, FileMode.Append, FileAccess.Write, FileShare.Read);
+                }
+                _journal.Write(record, 0, record.Length);
+                _journal.Flush();
+
+                data.CopyTo(_image, position);
+                var sectorIndex = (position - HEADER_SIZE) / SECTOR_SIZE;
+                if (!_dirtySectors[sectorIndex])
+                {
+                    _dirtySectors[sectorIndex] = true;
+                    _dirtyCount++;
+                }
             }
         }
 
@@ -277,27 +330,137 @@ namespace Spect.Net.SpectrumEmu.Devices.Floppy
         /// <param name="sector">Sector parameter (starts from 1)</param>
         /// <param name="length">Number of bytes to read</param>
         public byte[] ReadData(int head, int track, int sector, int length)
+        {
+            if (length == 0)
+            {
+                throw new ArgumentException("Data must be at least one byte", nameof(length));
+            }
+            if (length > SECTOR_SIZE)
+            {
+                throw new ArgumentException($"Data cannot be longer than {SECTOR_SIZE} bytes", nameof(length));
+            }
+            var data = new byte[length];
+            ReadData(head, track, sector, data);
+            return data;
+        }
+
+        /// <summary>
+        /// Reads data from the file into the specified buffer
+        /// </summary>
+        /// <param name="head">Head parameter (0 or 1)</param>
+        /// <param name="track">Track parameter (starts from 0)</param>
+        /// <param name="sector">Sector parameter (starts from 1)</param>
+        /// <param name="buffer">Buffer to read the data into</param>
+        public void ReadData(int head, int track, int sector, byte[] buffer)
         {
             if (sector > 9)
             {
                 sector = sector - FirstSectorIndex + 1;
             }
             CheckPositionParameters(head, track, sector);
-            if (length == 0)
+            if (buffer.Length == 0)
             {
-                throw new ArgumentException("Data must be at least one byte", nameof(length));
+                throw new ArgumentException("Data must be at least one byte", nameof(buffer));
             }
-            if (length > SECTOR_SIZE)
+            if (buffer.Length > SECTOR_SIZE)
             {
-                throw new ArgumentException($"Data cannot be longer than {SECTOR_SIZE} bytes", nameof(length));
+                throw new ArgumentException($"Data cannot be longer than {SECTOR_SIZE} bytes", nameof(buffer));
             }
-            using (var reader = new BinaryReader(File.OpenRead(Filename)))
+            Buffer.BlockCopy(_image, CalculateSectorPosition(head, track, sector), buffer, 0, buffer.Length);
+        }
+
+        /// <summary>
+        /// Writes the sectors changed since the last flush into the image
+        /// file, and removes the journal
+        /// </summary>
+        public void Flush()
+        {
+            lock (_writeLock)
             {
-                reader.BaseStream.Seek(CalculateSectorPosition(head, track, sector), SeekOrigin.Begin);
-                return reader.ReadBytes(length);
+                CloseJournal();
+                if (_dirtyCount == 0) return;
+                using (var stream = new FileStream(Filename, FileMode.Open, FileAccess.Write))
+                {
+                    var index = 0;
+                    while (index < _dirtySectors.Length)
+                    {
+                        if (!_dirtySectors[index])
+                        {
+                            index++;
+                            continue;
+                        }
+
+                        // --- Write the adjacent changed sectors at once
+                        var first = index;
+                        while (index < _dirtySectors.Length && _dirtySectors[index])
+                        {
+                            _dirtySectors[index++] = false;
+                        }
+                        var position = HEADER_SIZE + first * SECTOR_SIZE;
+                        stream.Seek(position, SeekOrigin.Begin);
+                        stream.Write(_image, position, (index - first) * SECTOR_SIZE);
+                    }
+                }
+                _dirtyCount = 0;
+                File.Delete(JournalFilename);
             }
         }
 
+        /// <summary>
+        /// Closes the journal without flushing the image; the pending writes
+        /// are replayed the next time the image is opened
+        /// </summary>
+        public void Close()
+        {
+            lock (_writeLock)
+            {
+                CloseJournal();
+            }
+        }
+
+        /// <summary>
+        /// Closes the journal stream kept open for the writes
+        /// </summary>
+        private void CloseJournal()
+        {
+            _journal?.Dispose();
+            _journal = null;
+        }
+
+        /// <summary>
+        /// Applies the records of the journal that belongs to the specified
+        /// image file, and then removes the journal
+        /// </summary>
+        /// <param name="filename">Image file name</param>
+        private static void RecoverJournal(string filename)
+        {
+            var journalFile = filename + JOURNAL_EXTENSION;
+            if (!File.Exists(journalFile)) return;
+
+            var journal = File.ReadAllBytes(journalFile);
+            using (var stream = new FileStream(filename, FileMode.Open, FileAccess.ReadWrite))
+            {
+                var pos = 0;
+
+                // --- A record cut short by a crash is ignored
+                while (pos + JOURNAL_RECORD_HEADER <= journal.Length)
+                {
+                    var position = journal[pos] | journal[pos + 1] << 8 
+                        | journal[pos + 2] << 16 | journal[pos + 3] << 24;
+                    var length = journal[pos + 4] | journal[pos + 5] << 8;
+                    pos += JOURNAL_RECORD_HEADER;
+                    if (pos + length > journal.Length) break;
+                    if (position >= HEADER_SIZE && position + length <= stream.Length)
+                    {
+                        stream.Seek(position, SeekOrigin.Begin);
+                        stream.Write(journal, pos, length);
+                    }
+                    pos += length;
+                }
+            }
+            File.Delete(journalFile);
+        }
+
         /// <summary>
         /// Checks the range of the specified position parameters
         /// </summary>
@@ -307,6 +470,10 @@ namespace Spect.Net.SpectrumEmu.Devices.Floppy
             {
                 throw new ArgumentException("Head must be 0 or 1", nameof(head));
             }
+            if (head == 1 && !IsDoubleSided)
+            {
+                throw new ArgumentException("Head must be 0 on a single-sided floppy", nameof(head));
+            }
             if (track < 0 || track >= Tracks)
             {
                 throw new ArgumentException($"Track must be 0 and {Tracks - 1}", nameof(track));
@@ -0,0 +1,18 @@
+﻿using System;
+
+namespace Spect.Net.SpectrumEmu.Devices.Kempston
+{
+    /// <summary>
+    /// The buttons of the Kempston joystick, as the bits of the Kempston port
+    /// </summary>
+    [Flags]
+    public enum KempstonButtons : byte
+    {
+        None = 0x00,
+        Right = 0x01,
+        Left = 0x02,
+        Down = 0x04,
+        Up = 0x08,
+        Fire = 0x10
+    }
+}
@@ -9,12 +9,14 @@ namespace Spect.Net.SpectrumEmu.Devices.Kempston
     public class KempstonDevice: IKempstonDevice
     {
         private IKempstonProvider _kempstonProvider;
+        private KempstonButtons? _inputState;
 
         /// <summary>
         /// Resets this device
         /// </summary>
         public void Reset()
         {
+            _inputState = null;
         }
 
         /// <summary>
@@ -49,31 +51,51 @@ namespace Spect.Net.SpectrumEmu.Devices.Kempston
         /// <summary>
         /// Indicates if the Kempston device is present.
         /// </summary>
-        public bool IsPresent => _kempstonProvider?.IsPresent ?? false;
+        public bool IsPresent => _inputState.HasValue || (_kempstonProvider?.IsPresent ?? false);
 
         /// <summary>
         /// The flag that indicates if the left button is pressed.
         /// </summary>
-        public bool LeftPressed => _kempstonProvider?.LeftPressed ?? false;
+        public bool LeftPressed => _inputState.HasValue
+            ? (_inputState.Value & KempstonButtons.Left) != 0
+            : _kempstonProvider?.LeftPressed ?? false;
 
         /// <summary>
         /// The flag that indicates if the right button is pressed.
         /// </summary>
-        public bool RightPressed => _kempstonProvider?.RightPressed ?? false;
+        public bool RightPressed => _inputState.HasValue
+            ? (_inputState.Value & KempstonButtons.Right) != 0
+            : _kempstonProvider?.RightPressed ?? false;
 
         /// <summary>
         /// The flag that indicates if the up button is pressed.
         /// </summary>
-        public bool UpPressed => _kempstonProvider?.UpPressed ?? false;
+        public bool UpPressed => _inputState.HasValue
+            ? (_inputState.Value & KempstonButtons.Up) != 0
+            : _kempstonProvider?.UpPressed ?? false;
 
         /// <summary>
         /// The flag that indicates if the down button is pressed.
         /// </summary>
-        public bool DownPressed => _kempstonProvider?.DownPressed ?? false;
+        public bool DownPressed => _inputState.HasValue
+            ? (_inputState.Value & KempstonButtons.Down) != 0
+            : _kempstonProvider?.DownPressed ?? false;
 
         /// <summary>
         /// The flag that indicates if the fire button is pressed.
         /// </summary>
-        public bool FirePressed => _kempstonProvider?.FirePressed ?? false;
+        public bool FirePressed => _inputState.HasValue
+            ? (_inputState.Value & KempstonButtons.Fire) != 0
+            : _kempstonProvider?.FirePressed ?? false;
+
+        /// <summary>
+        /// Sets the joystick state from scheduled input. Until the next reset,
+        /// this state overrides the state of the Kempston provider.
+        /// </summary>
+        /// <param name="buttons">The pressed buttons</param>
+        public void SetInputState(KempstonButtons buttons)
+        {
+            _inputState = buttons;
+        }
     }
 }
\ No newline at end of file
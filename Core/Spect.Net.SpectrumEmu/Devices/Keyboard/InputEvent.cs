@@ -0,0 +1,69 @@
+﻿using Spect.Net.SpectrumEmu.Devices.Kempston;
+
+namespace Spect.Net.SpectrumEmu.Devices.Keyboard
+{
+    /// <summary>
+    /// This class represents an input event scheduled for a CPU tact
+    /// </summary>
+    public class InputEvent
+    {
+        /// <summary>
+        /// The CPU tact the event should be applied at
+        /// </summary>
+        public long Tact { get; set; }
+
+        /// <summary>
+        /// Type of the event
+        /// </summary>
+        public InputEventType Type { get; set; }
+
+        /// <summary>
+        /// The key of a KeyDown or KeyUp event
+        /// </summary>
+        public SpectrumKeyCode Key { get; set; }
+
+        /// <summary>
+        /// The pressed Kempston buttons of a Kempston event
+        /// </summary>
+        public KempstonButtons Buttons { get; set; }
+
+        /// <summary>
+        /// Parameterless constructor for serialization
+        /// </summary>
+        public InputEvent()
+        {
+        }
+
+        /// <summary>
+        /// Creates a keyboard event
+        /// </summary>
+        /// <param name="tact">CPU tact of the event</param>
+        /// <param name="key">Spectrum key</param>
+        /// <param name="isDown">True, if the key is pressed; otherwise, false</param>
+        public InputEvent(long tact, SpectrumKeyCode key, bool isDown)
+        {
+            Tact = tact;
+            Type = isDown ? InputEventType.KeyDown : InputEventType.KeyUp;
+            Key = key;
+        }
+
+        /// <summary>
+        /// Creates a Kempston joystick event
+        /// </summary>
+        /// <param name="tact">CPU tact of the event</param>
+        /// <param name="buttons">The pressed buttons</param>
+        public InputEvent(long tact, KempstonButtons buttons)
+        {
+            Tact = tact;
+            Type = InputEventType.Kempston;
+            Buttons = buttons;
+        }
+
+        /// <summary>Returns a string that represents the current object.</summary>
+        /// <returns>A string that represents the current object.</returns>
+        public override string ToString() =>
+            Type == InputEventType.Kempston
+                ? $"T:{Tact}, {Type}: {Buttons}"
+                : $"T:{Tact}, {Type}: {Key}";
+    }
+}
@@ -0,0 +1,23 @@
+﻿namespace Spect.Net.SpectrumEmu.Devices.Keyboard
+{
+    /// <summary>
+    /// Types of the scheduled input events
+    /// </summary>
+    public enum InputEventType
+    {
+        /// <summary>
+        /// A Spectrum key is pressed
+        /// </summary>
+        KeyDown,
+
+        /// <summary>
+        /// A Spectrum key is released
+        /// </summary>
+        KeyUp,
+
+        /// <summary>
+        /// The Kempston joystick changes its state
+        /// </summary>
+        Kempston
+    }
+}
@@ -0,0 +1,222 @@
+﻿using System;
+using System.Collections.Generic;
+using Spect.Net.SpectrumEmu.Abstraction.Devices;
+using Spect.Net.SpectrumEmu.Devices.Kempston;
+
+namespace Spect.Net.SpectrumEmu.Devices.Keyboard
+{
+    /// <summary>
+    /// This class stores the keyboard and Kempston events scheduled for
+    /// specific CPU tacts. The machine applies them when it reaches their tacts.
+    /// </summary>
+    /// <remarks>
+    /// The events are applied before the first instruction that starts at or
+    /// after their tact, independently of the wall clock, so the same schedule
+    /// produces the same machine state in normal and fast mode. Events can be
+    /// added from any thread. With RecordHistory set, the applied events are
+    /// kept so that they can be replayed later.
+    /// </remarks>
+    public class InputSchedule
+    {
+        private readonly object _locker = new object();
+        private readonly List<InputEvent> _events = new List<InputEvent>();
+        private readonly List<InputEvent> _history = new List<InputEvent>();
+        private int _head;
+        private long _nextTact = long.MaxValue;
+
+        /// <summary>
+        /// Number of CPU tacts in a frame, used to convert frame numbers to tacts
+        /// </summary>
+        public long TactsPerFrame { get; set; }
+
+        /// <summary>
+        /// The tact of the next event; long.MaxValue, if there is no event
+        /// </summary>
+        /// <remarks>
+        /// The machine reads this value before each instruction without locking.
+        /// A stale value only delays or repeats the check of ApplyDueEvents.
+        /// </remarks>
+        public long NextTact => _nextTact;
+
+        /// <summary>
+        /// Number of events waiting to be applied
+        /// </summary>
+        public int Count
+        {
+            get
+            {
+                lock (_locker)
+                {
+                    return _events.Count - _head;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Indicates if the applied events should be kept
+        /// </summary>
+        public bool RecordHistory { get; set; }
+
+        /// <summary>
+        /// Gets the tact of the start of the specified frame
+        /// </summary>
+        /// <param name="frame">Frame number, counted from the machine reset</param>
+        public long GetFrameTact(int frame) => frame * TactsPerFrame;
+
+        /// <summary>
+        /// Adds the specified event to the schedule
+        /// </summary>
+        /// <param name="inputEvent">Event to add</param>
+        /// <remarks>
+        /// Events with the same tact are applied in the order they have been added.
+        /// </remarks>
+        public void Add(InputEvent inputEvent)
+        {
+            if (inputEvent == null) throw new ArgumentNullException(nameof(inputEvent));
+            lock (_locker)
+            {
+                // --- Most events are added in order, so look for the position from the end
+                var index = _events.Count;
+                while (index > _head && _events[index - 1].Tact > inputEvent.Tact)
+                {
+                    index--;
+                }
+                _events.Insert(index, inputEvent);
+                _nextTact = _events[_head].Tact;
+            }
+        }
+
+        /// <summary>
+        /// Adds the specified events to the schedule (e.g. to replay a recording)
+        /// </summary>
+        /// <param name="inputEvents">Events to add</param>
+        public void AddRange(IEnumerable<InputEvent> inputEvents)
+        {
+            foreach (var inputEvent in inputEvents)
+            {
+                Add(inputEvent);
+            }
+        }
+
+        /// <summary>
+        /// Schedules pressing a key
+        /// </summary>
+        /// <param name="tact">CPU tact of the key press</param>
+        /// <param name="key">Spectrum key</param>
+        public void KeyDown(long tact, SpectrumKeyCode key)
+            => Add(new InputEvent(tact, key, true));
+
+        /// <summary>
+        /// Schedules releasing a key
+        /// </summary>
+        /// <param name="tact">CPU tact of the key release</param>
+        /// <param name="key">Spectrum key</param>
+        public void KeyUp(long tact, SpectrumKeyCode key)
+            => Add(new InputEvent(tact, key, false));
+
+        /// <summary>
+        /// Schedules a key stroke with an optional shift key
+        /// </summary>
+        /// <param name="tact">CPU tact of the key press</param>
+        /// <param name="holdTacts">Number of tacts the keys are held down</param>
+        /// <param name="primaryCode">Primary key code</param>
+        /// <param name="secondaryCode">Secondary key code</param>
+        public void KeyStroke(long tact, long holdTacts, SpectrumKeyCode primaryCode,
+            SpectrumKeyCode? secondaryCode = null)
+        {
+            if (secondaryCode.HasValue)
+            {
+                KeyDown(tact, secondaryCode.Value);
+            }
+            KeyDown(tact, primaryCode);
+            KeyUp(tact + holdTacts, primaryCode);
+            if (secondaryCode.HasValue)
+            {
+                KeyUp(tact + holdTacts, secondaryCode.Value);
+            }
+        }
+
+        /// <summary>
+        /// Schedules a new Kempston joystick state
+        /// </summary>
+        /// <param name="tact">CPU tact of the change</param>
+        /// <param name="buttons">The pressed buttons</param>
+        public void SetKempston(long tact, KempstonButtons buttons)
+            => Add(new InputEvent(tact, buttons));
+
+        /// <summary>
+        /// Applies the events with a tact not later than the specified one
+        /// </summary>
+        /// <param name="currentTact">Current CPU tact</param>
+        /// <param name="keyboard">Keyboard device to set</param>
+        /// <param name="kempston">Kempston device to set</param>
+        /// <returns>Number of events applied</returns>
+        public int ApplyDueEvents(long currentTact, IKeyboardDevice keyboard, IKempstonDevice kempston)
+        {
+            var applied = 0;
+            lock (_locker)
+            {
+                while (_head < _events.Count && _events[_head].Tact <= currentTact)
+                {
+                    var inputEvent = _events[_head++];
+                    switch (inputEvent.Type)
+                    {
+                        case InputEventType.KeyDown:
+                            keyboard?.SetScheduledStatus(inputEvent.Key, true);
+                            break;
+                        case InputEventType.KeyUp:
+                            keyboard?.SetScheduledStatus(inputEvent.Key, false);
+                            break;
+                        case InputEventType.Kempston:
+                            kempston?.SetInputState(inputEvent.Buttons);
+                            break;
+                    }
+                    if (RecordHistory)
+                    {
+                        _history.Add(inputEvent);
+                    }
+                    applied++;
+                }
+
+                // --- Drop the applied events
+                if (_head == _events.Count)
+                {
+                    _events.Clear();
+                    _head = 0;
+                }
+                else if (_head > 64 && _head > _events.Count / 2)
+                {
+                    _events.RemoveRange(0, _head);
+                    _head = 0;
+                }
+                _nextTact = _head < _events.Count ? _events[_head].Tact : long.MaxValue;
+            }
+            return applied;
+        }
+
+        /// <summary>
+        /// Gets the events applied since history recording has been turned on
+        /// </summary>
+        public IReadOnlyList<InputEvent> GetHistory()
+        {
+            lock (_locker)
+            {
+                return _history.ToArray();
+            }
+        }
+
+        /// <summary>
+        /// Removes the scheduled events and the history
+        /// </summary>
+        public void Clear()
+        {
+            lock (_locker)
+            {
+                _events.Clear();
+                _history.Clear();
+                _head = 0;
+                _nextTact = long.MaxValue;
+            }
+        }
+    }
+}
@@ -13,6 +13,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Keyboard
     {
         private IKeyboardProvider _keyboardProvider;
         private byte[] _lineStatus = new byte[8];
+        private readonly byte[] _scheduledStatus = new byte[8];
 
         /// <summary>
         /// The virtual machine that hosts the device
@@ -76,6 +77,25 @@ namespace Spect.Net.SpectrumEmu.Devices.Keyboard
 
         }
 
+        /// <summary>
+        /// Sets the status of a key from scheduled input
+        /// </summary>
+        /// <param name="key">Key code</param>
+        /// <param name="isDown">True, if the key is down; otherwise, false</param>
+        /// <remarks>
+        /// The scheduled keys are kept apart from the keys of the provider,
+        /// which sets all its keys at each scan, so a scheduled key stays
+        /// down until its scheduled release.
+        /// </remarks>
+        public void SetScheduledStatus(SpectrumKeyCode key, bool isDown)
+        {
+            var lineIndex = (byte)key / 5;
+            var lineMask = 1 << (byte)key % 5;
+            _scheduledStatus[lineIndex] = isDown
+                ? (byte)(_scheduledStatus[lineIndex] | lineMask)
+                : (byte)(_scheduledStatus[lineIndex] & ~lineMask);
+        }
+
         /// <summary>
         /// Gets the status of the specified Spectrum keyboard key.
         /// </summary>
@@ -85,7 +105,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Keyboard
         {
             var lineIndex = (byte)key / 5;
             var lineMask = 1 << (byte)key % 5;
-            return (_lineStatus[lineIndex] & lineMask) != 0;
+            return ((_lineStatus[lineIndex] | _scheduledStatus[lineIndex]) & lineMask) != 0;
         }
 
         /// <summary>
@@ -106,7 +126,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Keyboard
             {
                 if ((lines & 0x01) != 0)
                 {
-                    status |= _lineStatus[lineIndex];
+                    status |= (byte)(_lineStatus[lineIndex] | _scheduledStatus[lineIndex]);
                 }
                 lineIndex++;
                 lines >>= 1;
@@ -122,6 +142,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Keyboard
             for (var i = 0; i < _lineStatus.Length; i++)
             {
                 _lineStatus[i] = 0;
+                _scheduledStatus[i] = 0;
             }
         }
 
@@ -57,6 +57,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Memory
                 }
             }
             SelectedRomIndex = 0;
+            RebuildPageTable();
         }
 
         /// <summary>
@@ -132,6 +133,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Memory
                 romIndex = RomCount - 1;
             }
             SelectedRomIndex = romIndex;
+            RebuildPageTable();
         }
 
         /// <summary>
@@ -196,7 +198,23 @@ namespace Spect.Net.SpectrumEmu.Devices.Memory
         /// Sets the state of the device from the specified object
         /// </summary>
         /// <param name="state">Device state</param>
-        public override void RestoreState(IDeviceState state) => state.RestoreDeviceState(this);
+        public override void RestoreState(IDeviceState state)
+        {
+            state.RestoreDeviceState(this);
+            RebuildPageTable();
+        }
+
+        /// <summary>
+        /// Maps the two 8K pages of a 16K slot to the specified memory buffer
+        /// </summary>
+        /// <param name="slot">Slot index (0-3)</param>
+        /// <param name="memory">16K buffer of the ROM or RAM bank</param>
+        /// <param name="flags">Page flags</param>
+        protected void SetSlotPages(int slot, byte[] memory, MemoryPageFlags flags)
+        {
+            SetPage(slot * 2, memory, 0x0000, flags);
+            SetPage(slot * 2 + 1, memory, 0x2000, flags);
+        }
 
         /// <summary>
         /// State of the banked memory device
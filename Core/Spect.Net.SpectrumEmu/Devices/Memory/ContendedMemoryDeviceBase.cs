@@ -8,9 +8,44 @@ namespace Spect.Net.SpectrumEmu.Devices.Memory
     /// </summary>
     public abstract class ContendedMemoryDeviceBase : IMemoryDevice
     {
+        /// <summary>
+        /// Number of 8K pages in the 64K address space
+        /// </summary>
+        protected const int PAGE_COUNT = 8;
+
+        /// <summary>
+        /// The 8K page of the address space the ULA renders the screen from
+        /// </summary>
+        protected const int SCREEN_PAGE = 2;
+
+        /// <summary>
+        /// The address following the pixel and attribute memory of the screen
+        /// </summary>
+        protected const int SCREEN_END = 0x5B00;
+
+        /// <summary>
+        /// Value read from unavailable memory pages
+        /// </summary>
+        private static readonly byte[] s_UnavailablePage = CreateUnavailablePage();
+
         protected IZ80Cpu Cpu;
         protected IScreenDevice ScreenDevice;
 
+        /// <summary>
+        /// The memory buffers of the 8K pages of the address space
+        /// </summary>
+        protected readonly byte[][] PageMemory = new byte[PAGE_COUNT][];
+
+        /// <summary>
+        /// The offsets of the 8K pages within their memory buffers
+        /// </summary>
+        protected readonly int[] PageOffsets = new int[PAGE_COUNT];
+
+        /// <summary>
+        /// The flags of the 8K pages of the address space
+        /// </summary>
+        protected readonly MemoryPageFlags[] PageFlags = new MemoryPageFlags[PAGE_COUNT];
+
         /// <summary>
         /// Resets this device
         /// </summary>
@@ -79,11 +114,103 @@ namespace Spect.Net.SpectrumEmu.Devices.Memory
         protected void ApplyDelay()
         {
             if (HostVm == null) return;
-            var delay = ScreenDevice.GetContentionValue(HostVm.CurrentFrameTact);
+            var delay = ScreenDevice.ContentionTable.GetMemoryDelay(HostVm.CurrentFrameCpuTact);
             Cpu.Delay(delay);
             HostVm.ContentionAccumulated += delay;
         }
 
+        /// <summary>
+        /// Rebuilds the page table from the current paging state. Devices
+        /// that use the page table call this method whenever paging changes.
+        /// </summary>
+        protected virtual void RebuildPageTable()
+        {
+        }
+
+        /// <summary>
+        /// Maps the specified 8K page of the address space
+        /// </summary>
+        /// <param name="page">Page index (0-7)</param>
+        /// <param name="memory">Memory buffer that holds the page</param>
+        /// <param name="offset">Offset of the page within the buffer</param>
+        /// <param name="flags">Page flags</param>
+        protected void SetPage(int page, byte[] memory, int offset, MemoryPageFlags flags)
+        {
+            PageMemory[page] = memory;
+            PageOffsets[page] = offset;
+            PageFlags[page] = flags;
+        }
+
+        /// <summary>
+        /// Maps the specified 8K page of the address space to an unavailable
+        /// memory page that reads 0xFF and ignores writes
+        /// </summary>
+        /// <param name="page">Page index (0-7)</param>
+        /// <param name="flags">Additional page flags</param>
+        protected void SetUnavailablePage(int page, MemoryPageFlags flags = MemoryPageFlags.None)
+        {
+            SetPage(page, s_UnavailablePage, 0, flags | MemoryPageFlags.ReadOnly);
+        }
+
+        /// <summary>
+        /// Reads the memory through the page table
+        /// </summary>
+        /// <param name="addr">Memory address</param>
+        /// <param name="suppressContention">Indicates non-contended read operation</param>
+        /// <returns>Byte read from the memory</returns>
+        protected byte ReadPaged(ushort addr, bool suppressContention)
+        {
+            var page = addr >> 13;
+            if ((PageFlags[page] & MemoryPageFlags.Contended) != 0
+                && !suppressContention && ScreenDevice != null)
+            {
+                ApplyDelay();
+            }
+            return PageMemory[page][PageOffsets[page] + (addr & 0x1FFF)];
+        }
+
+        /// <summary>
+        /// Writes the memory through the page table
+        /// </summary>
+        /// <param name="addr">Memory address</param>
+        /// <param name="value">Memory value to write</param>
+        /// <param name="supressContention">
+        /// Indicates non-contended write operation
+        /// </param>
+        protected void WritePaged(ushort addr, byte value, bool supressContention)
+        {
+            var page = addr >> 13;
+            var flags = PageFlags[page];
+            if ((flags & MemoryPageFlags.ReadOnly) != 0) return;
+            if ((flags & MemoryPageFlags.Contended) != 0
+                && !supressContention && ScreenDevice != null)
+            {
+                ApplyDelay();
+            }
+            // --- The ULA renders the screen from the memory paged in at $4000
+            var memory = PageMemory[page];
+            var offset = PageOffsets[page] + (addr & 0x1FFF);
+            if (memory == PageMemory[SCREEN_PAGE] && offset >= PageOffsets[SCREEN_PAGE]
+                && offset < PageOffsets[SCREEN_PAGE] + SCREEN_END - 0x4000)
+            {
+                HostVm?.OnScreenChanging();
+            }
+            memory[offset] = value;
+        }
+
+        /// <summary>
+        /// Creates the buffer of unavailable memory pages
+        /// </summary>
+        private static byte[] CreateUnavailablePage()
+        {
+            var page = new byte[0x2000];
+            for (var i = 0; i < page.Length; i++)
+            {
+                page[i] = 0xFF;
+            }
+            return page;
+        }
+
         /// <summary>
         /// Gets the buffer that holds memory data
         /// </summary>
@@ -0,0 +1,31 @@
+﻿using System;
+
+namespace Spect.Net.SpectrumEmu.Devices.Memory
+{
+    /// <summary>
+    /// Flags that describe an 8K page of the memory page table
+    /// </summary>
+    [Flags]
+    public enum MemoryPageFlags : byte
+    {
+        /// <summary>
+        /// Readable and writable, non-contended page
+        /// </summary>
+        None = 0x00,
+
+        /// <summary>
+        /// The page cannot be written (ROM or unavailable RAM page)
+        /// </summary>
+        ReadOnly = 0x01,
+
+        /// <summary>
+        /// Accessing the page is subject to memory contention
+        /// </summary>
+        Contended = 0x02,
+
+        /// <summary>
+        /// The DivIDE device may map its own memory into this page
+        /// </summary>
+        DivIdeMapped = 0x04
+    }
+}
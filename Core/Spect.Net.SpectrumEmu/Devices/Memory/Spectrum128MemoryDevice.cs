@@ -23,6 +23,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Memory
         {
             base.Reset();
             _currentSlot3Bank = 0;
+            RebuildPageTable();
         }
 
         /// <summary>
@@ -35,7 +36,11 @@ namespace Spect.Net.SpectrumEmu.Devices.Memory
         /// Sets the state of the device from the specified object
         /// </summary>
         /// <param name="state">Device state</param>
-        public override void RestoreState(IDeviceState state) => state.RestoreDeviceState(this);
+        public override void RestoreState(IDeviceState state)
+        {
+            state.RestoreDeviceState(this);
+            RebuildPageTable();
+        }
 
         /// <summary>
         /// Signs that the device has been attached to the Spectrum virtual machine
@@ -44,6 +49,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Memory
         {
             base.OnAttachedToVm(hostVm);
             _currentSlot3Bank = 0;
+            RebuildPageTable();
         }
 
         /// <summary>
@@ -53,29 +59,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Memory
         /// <param name="suppressContention">Indicates non-contended read operation</param>
         /// <returns>Byte read from the memory</returns>
         public override byte Read(ushort addr, bool suppressContention = false)
-        {
-            var memIndex = addr & 0x3FFF;
-            byte memValue;
-            switch (addr & 0xC000)
-            {
-                case 0x0000:
-                    return Roms[SelectedRomIndex][memIndex];
-                case 0x4000:
-                    memValue = RamBanks[5][memIndex];
-                    if (suppressContention || ScreenDevice == null) return memValue;
-                    ApplyDelay();
-                    return memValue;
-                case 0x8000:
-                    return RamBanks[2][memIndex];
-                default:
-                    memValue = RamBanks[_currentSlot3Bank][memIndex];
-                    if ((_currentSlot3Bank & 0x01) == 0) return memValue;
-
-                    // --- Bank 1, 3, 5, and 7 are contended
-                    ApplyDelay();
-                    return memValue;
-            }
-        }
+            => ReadPaged(addr, suppressContention);
 
         /// <summary>
         /// Sets the memory value at the specified address
@@ -86,37 +70,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Memory
         /// Indicates non-contended write operation
         /// </param>
         public override void Write(ushort addr, byte value, bool supressContention = false)
-        {
-            // ReSharper disable once SwitchStatementMissingSomeCases
-            var memIndex = addr & 0x3FFF;
-            switch (addr & 0xC000)
-            {
-                case 0x0000:
-                    // --- ROM cannot be overwritten
-                    return;
-                case 0x4000:
-                    if (!supressContention)
-                    {
-                        ApplyDelay();
-                    }
-                    RamBanks[5][memIndex] = value;
-                    break;
-                case 0x8000:
-                    RamBanks[2][memIndex] = value;
-                    break;
-                default:
-                    if ((_currentSlot3Bank & 0x01) != 0)
-                    {
-                        // --- Bank 1, 3, 5, and 7 are contended
-                        if (!supressContention)
-                        {
-                            ApplyDelay();
-                        }
-                    }
-                    RamBanks[_currentSlot3Bank][memIndex] = value;
-                    break;
-            }
-        }
+            => WritePaged(addr, value, supressContention);
 
         /// <summary>
         /// Pages in the selected bank into the specified slot
@@ -130,6 +84,23 @@ namespace Spect.Net.SpectrumEmu.Devices.Memory
         {
             if (slot != 3) return;
             _currentSlot3Bank = bank & 0x07;
+            RebuildPageTable();
+        }
+
+        /// <summary>
+        /// Rebuilds the page table from the current paging state
+        /// </summary>
+        protected override void RebuildPageTable()
+        {
+            if (Roms == null || RamBanks == null) return;
+
+            SetSlotPages(0, Roms[SelectedRomIndex], MemoryPageFlags.ReadOnly);
+            SetSlotPages(1, RamBanks[5], MemoryPageFlags.Contended);
+            SetSlotPages(2, RamBanks[2], MemoryPageFlags.None);
+
+            // --- Bank 1, 3, 5, and 7 are contended
+            SetSlotPages(3, RamBanks[_currentSlot3Bank],
+                (_currentSlot3Bank & 0x01) != 0 ? MemoryPageFlags.Contended : MemoryPageFlags.None);
         }
 
         /// <summary>
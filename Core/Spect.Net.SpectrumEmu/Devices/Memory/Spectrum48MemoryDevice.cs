@@ -78,6 +78,10 @@ namespace Spect.Net.SpectrumEmu.Devices.Memory
                     {
                         ApplyDelay();
                     }
+                    if (addr < SCREEN_END)
+                    {
+                        HostVm?.OnScreenChanging();
+                    }
                     break;
             }
             _memory[addr] = value;
@@ -101,6 +101,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Memory
             _isInAllRamMode = false;
             _isIn8KMode = false;
             _selectedRomIndex = 0;
+            RebuildPageTable();
         }
 
         /// <summary>
@@ -111,67 +112,12 @@ namespace Spect.Net.SpectrumEmu.Devices.Memory
         /// <returns>Byte read from the memory</returns>
         public override byte Read(ushort addr, bool suppressContention = false)
         {
-            var memIndex = addr & 0x1FFF;
-            var slotOffset = (addr >> 13) & 0x01;
-            int slotIndex;
-            var romIndex = _selectedRomIndex * 2 + slotOffset;
-            var isRam = IsInAllRamMode;
-
-            if (IsInAllRamMode || !IsIn8KMode)
+            // --- The DivIDE memory can be mapped in without a paging operation
+            if ((PageFlags[addr >> 13] & MemoryPageFlags.DivIdeMapped) != 0 && _divIdeDevice.ConMem)
             {
-                // --- We use 16K banks
-                slotIndex = 2 * _slots16[(byte) (addr >> 14)] + slotOffset;
-            }
-            else
-            {
-                // --- We use 8K banks
-                slotIndex = _slots8[(byte) (addr >> 13)];
-                isRam = slotIndex != 0xFF;
-            }
-
-            switch (addr & 0xE000)
-            {
-                case 0x0000:
-                    return isRam
-                        ? (slotIndex >= _ramPages.Length
-                            ? (byte) 0xFF
-                            : _ramPages[slotIndex][memIndex])
-                        : ((_divIdeDevice?.ConMem ?? false)
-                            ? _romPages[DIVIDE_ROM_PAGE_INDEX][memIndex]
-                            : _romPages[romIndex][memIndex]);
-
-                case 0x02000:
-                    return isRam
-                        ? (slotIndex >= _ramPages.Length
-                            ? (byte) 0xFF
-                            : _ramPages[slotIndex][memIndex])
-                        : _romPages[romIndex][memIndex];
-
-                case 0x4000:
-                case 0x0600:
-                    if (!suppressContention && ScreenDevice != null)
-                    {
-                        ApplyDelay();
-                    }
-
-                    if (slotIndex >= _ramPages.Length) return 0xFF;
-                    return _ramPages[slotIndex][memIndex];
-
-                case 0x8000:
-                case 0xA000:
-                    if (slotIndex >= _ramPages.Length) return 0xFF;
-                    return _ramPages[slotIndex][memIndex];
-
-                default:
-                    // --- Bank 4, 5, 6, and 7 are contended
-                    if (_slots16[3] >= 4 && ScreenDevice != null)
-                    {
-                        ApplyDelay();
-                    }
-
-                    if (slotIndex >= _ramPages.Length) return 0xFF;
-                    return _ramPages[slotIndex][memIndex];
+                return _romPages[DIVIDE_ROM_PAGE_INDEX][addr & 0x1FFF];
             }
+            return ReadPaged(addr, suppressContention);
         }
 
         /// <summary>
@@ -183,63 +129,44 @@ namespace Spect.Net.SpectrumEmu.Devices.Memory
         /// Indicates non-contended write operation
         /// </param>
         public override void Write(ushort addr, byte value, bool supressContention = false)
-        {
-            var memIndex = addr & 0x1FFF;
-            var slotOffset = (addr >> 13) & 0x01;
-            int slotIndex;
-            var isRam = IsInAllRamMode;
+            => WritePaged(addr, value, supressContention);
 
-            if (IsInAllRamMode || !IsIn8KMode)
-            {
-                // --- We use 16K banks
-                slotIndex = 2 * _slots16[(byte)(addr >> 14)] + slotOffset;
-            }
-            else
-            {
-                // --- We use 8K banks
-                slotIndex = _slots8[(byte)(addr >> 13)];
-                isRam = slotIndex != 0xFF;
-            }
+        /// <summary>
+        /// Rebuilds the page table from the current paging state
+        /// </summary>
+        protected override void RebuildPageTable()
+        {
+            if (_ramPages == null || _romPages == null || _slots16 == null) return;
 
-            switch (addr & 0xC000)
+            var use16KBanks = IsInAllRamMode || !IsIn8KMode;
+            for (var page = 0; page < PAGE_COUNT; page++)
             {
-                case 0x0000:
-                    if (isRam && slotIndex < _ramPages.Length)
-                    {
-                        _ramPages[slotIndex][memIndex] = value;
-                    }
+                // --- Bank 4, 5, 6, and 7 are contended in the top slot
+                var flags = MemoryPageFlags.None;
+                if (page == 2 || page == 3 || page >= 6 && _slots16[3] >= 4)
+                {
+                    flags = MemoryPageFlags.Contended;
+                }
 
-                    return;
-                case 0x4000:
-                    if (!supressContention)
-                    {
-                        ApplyDelay();
-                    }
-                    if (slotIndex < _ramPages.Length)
-                    {
-                        _ramPages[slotIndex][memIndex] = value;
-                    }
-                    return;
-                case 0x8000:
-                    if (slotIndex < _ramPages.Length)
-                    {
-                        _ramPages[slotIndex][memIndex] = value;
-                    }
-                    return;
-                default:
-                    // --- Bank 4, 5, 6, and 7 are contended
-                    if (_slots16[3] >= 4 && ScreenDevice != null)
-                    {
-                        if (!supressContention)
-                        {
-                            ApplyDelay();
-                        }
-                    }
-                    if (slotIndex < _ramPages.Length)
-                    {
-                        _ramPages[slotIndex][memIndex] = value;
-                    }
-                    return;
+                var slotIndex = use16KBanks
+                    ? 2 * _slots16[page >> 1] + (page & 0x01)
+                    : _slots8[page];
+                var isRam = page >= 2 || (use16KBanks ? IsInAllRamMode : slotIndex != 0xFF);
+                if (!isRam)
+                {
+                    SetPage(page, _romPages[_selectedRomIndex * 2 + (page & 0x01)], 0,
+                        page == 0 && _divIdeDevice != null
+                            ? MemoryPageFlags.ReadOnly | MemoryPageFlags.DivIdeMapped
+                            : MemoryPageFlags.ReadOnly);
+                }
+                else if (slotIndex >= _ramPages.Length)
+                {
+                    SetUnavailablePage(page, flags);
+                }
+                else
+                {
+                    SetPage(page, _ramPages[slotIndex], 0, flags);
+                }
             }
         }
 
@@ -331,6 +258,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Memory
             }
             _selectedRomIndex = romIndex;
             _isInAllRamMode = false;
+            RebuildPageTable();
         }
 
         /// <summary>
@@ -368,6 +296,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Memory
                 slot &= 0x07;
                 _slots8[slot] = bank;
             }
+            RebuildPageTable();
         }
 
         /// <summary>
@@ -37,6 +37,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Memory
                 0, 5, 2, 0
             };
             _isInAllRamMode = false;
+            RebuildPageTable();
         }
 
         /// <summary>
@@ -49,7 +50,11 @@ namespace Spect.Net.SpectrumEmu.Devices.Memory
         /// Sets the state of the device from the specified object
         /// </summary>
         /// <param name="state">Device state</param>
-        public override void RestoreState(IDeviceState state) => state.RestoreDeviceState(this);
+        public override void RestoreState(IDeviceState state)
+        {
+            state.RestoreDeviceState(this);
+            RebuildPageTable();
+        }
 
         /// <summary>
         /// Signs that the device has been attached to the Spectrum virtual machine
@@ -62,6 +67,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Memory
                 0, 5, 2, 0
             };
             _isInAllRamMode = false;
+            RebuildPageTable();
         }
 
         /// <summary>
@@ -73,8 +79,8 @@ namespace Spect.Net.SpectrumEmu.Devices.Memory
         /// </remarks>
         public override void SelectRom(int romIndex)
         {
-            base.SelectRom(romIndex);
             _isInAllRamMode = false;
+            base.SelectRom(romIndex);
         }
 
         /// <summary>
@@ -85,32 +91,15 @@ namespace Spect.Net.SpectrumEmu.Devices.Memory
         /// <returns>Byte read from the memory</returns>
         public override byte Read(ushort addr, bool suppressContention = false)
         {
-            var memIndex = addr & 0x3FFF;
-            var memValue = RamBanks[_slots[(byte)(addr >> 14)]][memIndex];
-            switch (addr & 0xC000)
+            var page = addr >> 13;
+            var memValue = PageMemory[page][PageOffsets[page] + (addr & 0x1FFF)];
+            if ((PageFlags[page] & MemoryPageFlags.Contended) != 0
+                && !suppressContention && ScreenDevice != null)
             {
-                case 0x0000:
-                    return IsInAllRamMode
-                        ? memValue
-                        : Roms[SelectedRomIndex][memIndex];
-                case 0x4000:
-                    if (!suppressContention && ScreenDevice != null)
-                    {
-                        ApplyDelay();
-                        LastContendedReadValue = memValue;
-                    }
-                    return memValue;
-                case 0x8000:
-                    return memValue;
-                default:
-                    // --- Bank 4, 5, 6, and 7 are contended
-                    if (_slots[3] >= 4 && ScreenDevice != null)
-                    {
-                        ApplyDelay();
-                        LastContendedReadValue = memValue;
-                    }
-                    return memValue;
+                ApplyDelay();
+                LastContendedReadValue = memValue;
             }
+            return memValue;
         }
 
         /// <summary>
@@ -122,41 +111,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Memory
         /// Indicates non-contended write operation
         /// </param>
         public override void Write(ushort addr, byte value, bool supressContention = false)
-        {
-            // ReSharper disable once SwitchStatementMissingSomeCases
-            var memIndex = addr & 0x3FFF;
-            switch (addr & 0xC000)
-            {
-                case 0x0000:
-                    if (IsInAllRamMode)
-                    {
-                        RamBanks[_slots[0]][memIndex] = value;
-                    }
-                    return;
-                case 0x4000:
-                    if (!supressContention)
-                    {
-                        ApplyDelay();
-                    }
-                    RamBanks[_slots[1]][memIndex] = value;
-                    break;
-                case 0x8000:
-                    RamBanks[_slots[2]][memIndex] = value;
-                    break;
-                default:
-                    var bankIndex = _slots[3];
-                    if (bankIndex >= 4)
-                    {
-                        // --- Bank 4, 5, 6, and 7 are contended
-                        if (!supressContention)
-                        {
-                            ApplyDelay();
-                        }
-                    }
-                    RamBanks[bankIndex][memIndex] = value;
-                    break;
-            }
-        }
+            => WritePaged(addr, value, supressContention);
 
         /// <summary>
         /// Pages in the selected bank into the specified slot
@@ -173,6 +128,30 @@ namespace Spect.Net.SpectrumEmu.Devices.Memory
             {
                 _isInAllRamMode = true;
             }
+            RebuildPageTable();
+        }
+
+        /// <summary>
+        /// Rebuilds the page table from the current paging state
+        /// </summary>
+        protected override void RebuildPageTable()
+        {
+            if (Roms == null || RamBanks == null || _slots == null) return;
+
+            if (IsInAllRamMode)
+            {
+                SetSlotPages(0, RamBanks[_slots[0]], MemoryPageFlags.None);
+            }
+            else
+            {
+                SetSlotPages(0, Roms[SelectedRomIndex], MemoryPageFlags.ReadOnly);
+            }
+            SetSlotPages(1, RamBanks[_slots[1]], MemoryPageFlags.Contended);
+            SetSlotPages(2, RamBanks[_slots[2]], MemoryPageFlags.None);
+
+            // --- Bank 4, 5, 6, and 7 are contended
+            SetSlotPages(3, RamBanks[_slots[3]],
+                _slots[3] >= 4 ? MemoryPageFlags.Contended : MemoryPageFlags.None);
         }
 
         /// <summary>
@@ -7,6 +7,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Ports
     {
         protected IZ80Cpu Cpu;
         protected IScreenDevice ScreenDevice;
+        private PortHandlerDispatchTable _dispatchTable;
 
         /// <summary>
         /// List of available handlers
@@ -36,6 +37,36 @@ namespace Spect.Net.SpectrumEmu.Devices.Ports
                 handler.OnAttachedToVm(hostVm);
                 handler.Reset();
             }
+            RebuildDispatchTable();
+        }
+
+        /// <summary>
+        /// Rebuilds the port dispatch table from the current handlers
+        /// </summary>
+        /// <remarks>
+        /// The table is rebuilt automatically when the number of handlers
+        /// changes. Call this method explicitly when handlers are replaced.
+        /// </remarks>
+        public void RebuildDispatchTable()
+        {
+            _dispatchTable = Handlers.Count <= PortHandlerDispatchTable.MAX_HANDLERS
+                ? new PortHandlerDispatchTable(Handlers)
+                : null;
+        }
+
+        /// <summary>
+        /// Gets the up-to-date dispatch table
+        /// </summary>
+        /// <returns>
+        /// The dispatch table, or null, if there are too many handlers to use a table
+        /// </returns>
+        private PortHandlerDispatchTable GetDispatchTable()
+        {
+            if (_dispatchTable == null || _dispatchTable.HandlerCount != Handlers.Count)
+            {
+                RebuildDispatchTable();
+            }
+            return _dispatchTable;
         }
 
         /// <summary>
@@ -49,13 +80,28 @@ namespace Spect.Net.SpectrumEmu.Devices.Ports
             ContentionWait(addr);
 
             // --- Find and invoke the handler
-            foreach (var handler in Handlers)
+            var table = GetDispatchTable();
+            if (table != null)
+            {
+                foreach (var handler in table.GetReadHandlers(addr))
+                {
+                    if (handler.HandleRead(addr, out var readValue))
+                    {
+                        PortAccessLogger?.PortRead(addr, readValue, true);
+                        return readValue;
+                    }
+                }
+            }
+            else
             {
-                if (!handler.CanRead || (addr & handler.PortMask) != handler.Port) continue;
-                if (handler.HandleRead(addr, out var readValue))
+                foreach (var handler in Handlers)
                 {
-                    PortAccessLogger?.PortRead(addr, readValue, true);
-                    return readValue;
+                    if (!handler.CanRead || (addr & handler.PortMask) != handler.Port) continue;
+                    if (handler.HandleRead(addr, out var readValue))
+                    {
+                        PortAccessLogger?.PortRead(addr, readValue, true);
+                        return readValue;
+                    }
                 }
             }
             var ur = UnhandledRead(addr);
@@ -75,14 +121,26 @@ namespace Spect.Net.SpectrumEmu.Devices.Ports
 
             // --- Find and invoke the handler
             var handled = false;
-            foreach (var handler in Handlers)
+            var table = GetDispatchTable();
+            if (table != null)
             {
-                if (handler.CanWrite && (addr & handler.PortMask) == handler.Port)
+                foreach (var handler in table.GetWriteHandlers(addr))
                 {
                     handler.HandleWrite(addr, data);
                     handled = true;
                 }
             }
+            else
+            {
+                foreach (var handler in Handlers)
+                {
+                    if (handler.CanWrite && (addr & handler.PortMask) == handler.Port)
+                    {
+                        handler.HandleWrite(addr, data);
+                        handled = true;
+                    }
+                }
+            }
             PortAccessLogger?.PortWritten(addr, data, handled);
         }
 
@@ -99,22 +157,12 @@ namespace Spect.Net.SpectrumEmu.Devices.Ports
                 if (lowBit)
                 {
                     // --- C:1 x 4 contention scheme
-                    Cpu.Delay(ScreenDevice.GetContentionValue(HostVm.CurrentFrameTact));
-                    Cpu.Delay(1);
-                    Cpu.Delay(ScreenDevice.GetContentionValue(HostVm.CurrentFrameTact));
-                    Cpu.Delay(1);
-                    Cpu.Delay(ScreenDevice.GetContentionValue(HostVm.CurrentFrameTact));
-                    Cpu.Delay(1);
-                    Cpu.Delay(ScreenDevice.GetContentionValue(HostVm.CurrentFrameTact));
-                    Cpu.Delay(1);
+                    Cpu.Delay(ScreenDevice.ContentionTable.GetIoC1X4Delay(HostVm.CurrentFrameCpuTact));
                 }
                 else
                 {
                     // --- C:1, C:3 contention scheme
-                    Cpu.Delay(ScreenDevice.GetContentionValue(HostVm.CurrentFrameTact));
-                    Cpu.Delay(1);
-                    Cpu.Delay(ScreenDevice.GetContentionValue(HostVm.CurrentFrameTact));
-                    Cpu.Delay(3);
+                    Cpu.Delay(ScreenDevice.ContentionTable.GetIoC1C3Delay(HostVm.CurrentFrameCpuTact));
                 }
             }
             else
@@ -127,9 +175,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Ports
                 else
                 {
                     // --- N:1, C:3 contention scheme
-                    Cpu.Delay(1);
-                    Cpu.Delay(ScreenDevice.GetContentionValue(HostVm.CurrentFrameTact));
-                    Cpu.Delay(3);
+                    Cpu.Delay(ScreenDevice.ContentionTable.GetIoN1C3Delay(HostVm.CurrentFrameCpuTact));
                 }
             }
         }
@@ -0,0 +1,99 @@
+﻿using System;
+using System.Collections.Generic;
+using Spect.Net.SpectrumEmu.Abstraction.Devices;
+
+namespace Spect.Net.SpectrumEmu.Devices.Ports
+{
+    /// <summary>
+    /// This class stores a precomputed port address to handler table, so that
+    /// routing a port access needs only a single lookup.
+    /// </summary>
+    /// <remarks>
+    /// Every port handler declares its decoding with its PortMask and Port
+    /// values. The table assigns each of the 64K port addresses to an index
+    /// of a distinct handler set. Handlers keep their registration order
+    /// within the set, as that order determines the read priority.
+    /// </remarks>
+    public class PortHandlerDispatchTable
+    {
+        /// <summary>
+        /// The maximum number of handlers the table can manage
+        /// </summary>
+        public const int MAX_HANDLERS = 64;
+
+        private static readonly IPortHandler[] s_NoHandlers = new IPortHandler[0];
+
+        private readonly ushort[] _readIndexes = new ushort[0x1_0000];
+        private readonly ushort[] _writeIndexes = new ushort[0x1_0000];
+        private readonly IPortHandler[][] _readSets;
+        private readonly IPortHandler[][] _writeSets;
+
+        /// <summary>
+        /// Number of handlers the table has been built from
+        /// </summary>
+        public int HandlerCount { get; }
+
+        /// <summary>
+        /// Builds the dispatch table from the specified handlers
+        /// </summary>
+        /// <param name="handlers">Port handlers in their priority order</param>
+        public PortHandlerDispatchTable(IReadOnlyList<IPortHandler> handlers)
+        {
+            HandlerCount = handlers.Count;
+            _readSets = BuildSets(handlers, _readIndexes, h => h.CanRead);
+            _writeSets = BuildSets(handlers, _writeIndexes, h => h.CanWrite);
+        }
+
+        /// <summary>
+        /// Gets the handlers that can read the specified port
+        /// </summary>
+        /// <param name="addr">Port address</param>
+        /// <returns>Handlers in priority order</returns>
+        public IPortHandler[] GetReadHandlers(ushort addr) => _readSets[_readIndexes[addr]];
+
+        /// <summary>
+        /// Gets the handlers that can write the specified port
+        /// </summary>
+        /// <param name="addr">Port address</param>
+        /// <returns>Handlers in priority order</returns>
+        public IPortHandler[] GetWriteHandlers(ushort addr) => _writeSets[_writeIndexes[addr]];
+
+        /// <summary>
+        /// Assigns every port address with the index of the handler set that
+        /// decodes that address
+        /// </summary>
+        private static IPortHandler[][] BuildSets(IReadOnlyList<IPortHandler> handlers,
+            ushort[] indexes, Func<IPortHandler, bool> filter)
+        {
+            // --- Set index 0 is the empty set
+            var sets = new List<IPortHandler[]> { s_NoHandlers };
+            var setIndexes = new Dictionary<ulong, ushort> { { 0UL, 0 } };
+            var members = new List<IPortHandler>();
+            for (var addr = 0; addr < 0x1_0000; addr++)
+            {
+                var key = 0UL;
+                for (var i = 0; i < handlers.Count; i++)
+                {
+                    var handler = handlers[i];
+                    if (filter(handler) && (addr & handler.PortMask) == handler.Port)
+                    {
+                        key |= 1UL << i;
+                    }
+                }
+                if (!setIndexes.TryGetValue(key, out var setIndex))
+                {
+                    members.Clear();
+                    for (var i = 0; i < handlers.Count; i++)
+                    {
+                        if ((key & (1UL << i)) != 0) members.Add(handlers[i]);
+                    }
+                    setIndex = (ushort)sets.Count;
+                    sets.Add(members.ToArray());
+                    setIndexes.Add(key, setIndex);
+                }
+                indexes[addr] = setIndex;
+            }
+            return sets.ToArray();
+        }
+    }
+}
@@ -95,7 +95,12 @@ namespace Spect.Net.SpectrumEmu.Devices.Ports
         /// <param name="writeValue">Value to write to the port</param>
         public override void HandleWrite(ushort addr, byte writeValue)
         {
-            _screenDevice.BorderColor = writeValue & 0x07;
+            var borderColor = writeValue & 0x07;
+            if (borderColor != _screenDevice.BorderColor)
+            {
+                HostVm.OnScreenChanging();
+                _screenDevice.BorderColor = borderColor;
+            }
             _beeperDevice.ProcessEarBitValue(false, (writeValue & 0x10) != 0);
             _tapeDevice.ProcessMicBit((writeValue & 0x08) != 0);
 
@@ -38,6 +38,16 @@ namespace Spect.Net.SpectrumEmu.Devices.Rom
         /// The SAVE_BYTES routine address in the ROM
         /// </summary>
         public const string SAVE_BYTES_ROUTINE_ADDRESS = "$SaveBytesRoutineAddress";
+
+        /// <summary>
+        /// The +3DOS DD_READ_SECTOR routine address in the ROM
+        /// </summary>
+        public const string DD_READ_SECTOR_ADDRESS = "$DdReadSectorAddress";
+
+        /// <summary>
+        /// The +3DOS DD_WRITE_SECTOR routine address in the ROM
+        /// </summary>
+        public const string DD_WRITE_SECTOR_ADDRESS = "$DdWriteSectorAddress";
         
         /// <summary>
         /// The start address of the token table
@@ -119,6 +129,28 @@ namespace Spect.Net.SpectrumEmu.Devices.Rom
             _knownAddresses.Clear();
             _properties.Clear();
             ProcessSpectrum48Props(romBytes, romAnnotations);
+            ProcessPlus3DosProps(romAnnotations);
+        }
+
+        /// <summary>
+        /// Process the +3DOS routine addresses of the ROM pages that have them
+        /// </summary>
+        /// <param name="romAnnotations">ROM annotations</param>
+        protected void ProcessPlus3DosProps(DisassemblyAnnotation[] romAnnotations)
+        {
+            for (var romPage = 0; romPage < romAnnotations.Length; romPage++)
+            {
+                var annotations = romAnnotations[romPage];
+                if (annotations == null) continue;
+                foreach (var key in new[] { DD_READ_SECTOR_ADDRESS, DD_WRITE_SECTOR_ADDRESS })
+                {
+                    var literal = annotations.Literals.FirstOrDefault(kvp => kvp.Value.Contains(key));
+                    if (literal.Value != null)
+                    {
+                        _knownAddresses.Add((key, romPage), literal.Key);
+                    }
+                }
+            }
         }
 
         /// <summary>
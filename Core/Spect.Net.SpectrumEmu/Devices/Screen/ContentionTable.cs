@@ -0,0 +1,115 @@
+﻿namespace Spect.Net.SpectrumEmu.Devices.Screen
+{
+    /// <summary>
+    /// This class stores the precomputed total contention delays of memory
+    /// and I/O accesses for every CPU tact within a frame.
+    /// </summary>
+    /// <remarks>
+    /// The tables are indexed by the number of CPU tacts elapsed since the
+    /// start of the frame. This way the clock multiplier is taken into
+    /// account, and an I/O access that evaluates the contention value
+    /// several times costs only a single lookup.
+    /// </remarks>
+    public class ContentionTable
+    {
+        private readonly int _length;
+        private readonly byte[] _memory;
+        private readonly byte[] _ioC1X4;
+        private readonly byte[] _ioC1C3;
+        private readonly byte[] _ioN1C3;
+
+        /// <summary>
+        /// Number of screen rendering tacts in a frame
+        /// </summary>
+        public int FrameTactCount { get; }
+
+        /// <summary>
+        /// The clock multiplier the table has been built for
+        /// </summary>
+        public int ClockMultiplier { get; }
+
+        /// <summary>
+        /// Creates the contention table
+        /// </summary>
+        /// <param name="renderingTactTable">Screen rendering tact table</param>
+        /// <param name="clockMultiplier">CPU clock multiplier</param>
+        public ContentionTable(RenderingTact[] renderingTactTable, int clockMultiplier)
+        {
+            FrameTactCount = renderingTactTable.Length;
+            ClockMultiplier = clockMultiplier < 1 ? 1 : clockMultiplier;
+            _length = FrameTactCount * ClockMultiplier;
+            _memory = new byte[_length];
+            _ioC1X4 = new byte[_length];
+            _ioC1C3 = new byte[_length];
+            _ioN1C3 = new byte[_length];
+
+            for (var cpuTact = 0; cpuTact < _length; cpuTact++)
+            {
+                _memory[cpuTact] = Contention(renderingTactTable, cpuTact);
+
+                // --- C:1 x 4 contention scheme
+                var delay = 0;
+                for (var i = 0; i < 4; i++)
+                {
+                    delay += Contention(renderingTactTable, cpuTact + delay);
+                    delay += 1;
+                }
+                _ioC1X4[cpuTact] = (byte)delay;
+
+                // --- C:1, C:3 contention scheme
+                delay = Contention(renderingTactTable, cpuTact);
+                delay += 1;
+                delay += Contention(renderingTactTable, cpuTact + delay);
+                delay += 3;
+                _ioC1C3[cpuTact] = (byte)delay;
+
+                // --- N:1, C:3 contention scheme
+                delay = 1;
+                delay += Contention(renderingTactTable, cpuTact + delay);
+                delay += 3;
+                _ioN1C3[cpuTact] = (byte)delay;
+            }
+        }
+
+        /// <summary>
+        /// Gets the contention delay of a memory access
+        /// </summary>
+        /// <param name="cpuTact">CPU tacts elapsed since the start of the frame</param>
+        public byte GetMemoryDelay(int cpuTact) => _memory[Normalize(cpuTact)];
+
+        /// <summary>
+        /// Gets the total delay of the C:1 x 4 I/O contention scheme
+        /// </summary>
+        /// <param name="cpuTact">CPU tacts elapsed since the start of the frame</param>
+        public byte GetIoC1X4Delay(int cpuTact) => _ioC1X4[Normalize(cpuTact)];
+
+        /// <summary>
+        /// Gets the total delay of the C:1, C:3 I/O contention scheme
+        /// </summary>
+        /// <param name="cpuTact">CPU tacts elapsed since the start of the frame</param>
+        public byte GetIoC1C3Delay(int cpuTact) => _ioC1C3[Normalize(cpuTact)];
+
+        /// <summary>
+        /// Gets the total delay of the N:1, C:3 I/O contention scheme
+        /// </summary>
+        /// <param name="cpuTact">CPU tacts elapsed since the start of the frame</param>
+        public byte GetIoN1C3Delay(int cpuTact) => _ioN1C3[Normalize(cpuTact)];
+
+        /// <summary>
+        /// Brings the CPU tact into the table range. Accesses after the frame
+        /// end (overflow) wrap around, as screen rendering tacts do.
+        /// </summary>
+        private int Normalize(int cpuTact)
+        {
+            if ((uint)cpuTact < (uint)_length) return cpuTact;
+            cpuTact %= _length;
+            return cpuTact < 0 ? cpuTact + _length : cpuTact;
+        }
+
+        /// <summary>
+        /// Gets the contention value of the specified CPU tact
+        /// </summary>
+        private byte Contention(RenderingTact[] renderingTactTable, int cpuTact)
+            => renderingTactTable[cpuTact / ClockMultiplier % FrameTactCount].ContentionDelay;
+    }
+}
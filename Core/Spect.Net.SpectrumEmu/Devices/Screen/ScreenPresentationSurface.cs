@@ -0,0 +1,177 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Threading;
+
+namespace Spect.Net.SpectrumEmu.Devices.Screen
+{
+    /// <summary>
+    /// This class converts the palette indexes of the rendered frames into
+    /// 32-bit ARGB pixels, and passes the completed frames to the UI thread.
+    /// </summary>
+    /// <remarks>
+    /// The emulation thread converts each frame into its back buffer, and then
+    /// swaps it with the ready buffer in a single atomic operation. The UI
+    /// thread takes the ready buffer with another atomic swap. Neither of the
+    /// threads waits for the other, and the UI never sees a half-converted
+    /// frame. Three buffers are used, so the thread that completes a frame
+    /// always has a free buffer, even while the UI still displays the previous
+    /// one.
+    /// </remarks>
+    public class ScreenPresentationSurface
+    {
+        /// <summary>
+        /// Flag in the ready state that signs a frame not yet taken by the UI
+        /// </summary>
+        private const int NEW_FRAME = 0x100;
+
+        /// <summary>
+        /// Mask of the buffer index in the ready state
+        /// </summary>
+        private const int BUFFER_MASK = 0xFF;
+
+        private readonly uint[][] _buffers;
+        private readonly uint[] _colors = new uint[256];
+        private int _backIndex;
+        private int _readyState;
+        private int _frontIndex;
+        private long _presentedFrames;
+
+        /// <summary>
+        /// Width of the surface in pixels
+        /// </summary>
+        public int Width { get; }
+
+        /// <summary>
+        /// Height of the surface in pixels
+        /// </summary>
+        public int Height { get; }
+
+        /// <summary>
+        /// Number of frames converted since the surface has been created
+        /// </summary>
+        public long PresentedFrames => Interlocked.Read(ref _presentedFrames);
+
+        /// <summary>
+        /// Creates a surface with the specified dimensions
+        /// </summary>
+        /// <param name="width">Width of the screen in pixels</param>
+        /// <param name="height">Height of the screen in pixels</param>
+        /// <param name="palette">Palette to use (null: Spectrum colors)</param>
+        public ScreenPresentationSurface(int width, int height, IReadOnlyList<uint> palette = null)
+        {
+            if (width <= 0) throw new ArgumentOutOfRangeException(nameof(width));
+            if (height <= 0) throw new ArgumentOutOfRangeException(nameof(height));
+            Width = width;
+            Height = height;
+            _buffers = new uint[3][];
+            for (var i = 0; i < _buffers.Length; i++)
+            {
+                _buffers[i] = new uint[width * height];
+            }
+            _backIndex = 0;
+            _readyState = 1;
+            _frontIndex = 2;
+            SetPalette(palette ?? Spectrum48ScreenDevice.SpectrumColors);
+        }
+
+        /// <summary>
+        /// Sets the palette used by the next conversions
+        /// </summary>
+        /// <param name="palette">Colors by palette index (up to 256 entries)</param>
+        /// <remarks>
+        /// Indexes above the palette length use the colors of the palette
+        /// repeatedly, as the Spectrum screen uses only the lowest four bits.
+        /// </remarks>
+        public void SetPalette(IReadOnlyList<uint> palette)
+        {
+            if (palette == null) throw new ArgumentNullException(nameof(palette));
+            if (palette.Count == 0 || palette.Count > _colors.Length)
+            {
+                throw new ArgumentException("The palette must have 1 to 256 colors.", nameof(palette));
+            }
+            var colors = new uint[_colors.Length];
+            for (var i = 0; i < colors.Length; i++)
+            {
+                colors[i] = palette[i % palette.Count];
+            }
+            lock (_colors)
+            {
+                Array.Copy(colors, _colors, colors.Length);
+            }
+        }
+
+        /// <summary>
+        /// Converts the specified frame into the back buffer and makes it
+        /// the next frame to display. Call it on the emulation thread.
+        /// </summary>
+        /// <param name="pixels">Palette indexes of the frame</param>
+        public void Present(byte[] pixels)
+        {
+            if (pixels == null) throw new ArgumentNullException(nameof(pixels));
+            var back = _buffers[_backIndex];
+            lock (_colors)
+            {
+                var lines = Math.Min(Height, pixels.Length / Width);
+                for (var line = 0; line < lines; line++)
+                {
+                    ConvertScanline(pixels, line * Width, back, line * Width, Width, _colors);
+                }
+            }
+
+            // --- Publish the frame and take the previous ready buffer as the new back buffer
+            var previous = Interlocked.Exchange(ref _readyState, _backIndex | NEW_FRAME);
+            _backIndex = previous & BUFFER_MASK;
+            Interlocked.Increment(ref _presentedFrames);
+        }
+
+        /// <summary>
+        /// Gets the buffer with the most recent completed frame. Call it on the
+        /// UI thread. The buffer can be used until the next call.
+        /// </summary>
+        /// <param name="isNew">True, if the frame has not been taken before</param>
+        /// <returns>ARGB pixels of the frame, in top-down rows</returns>
+        public uint[] AcquireFrame(out bool isNew)
+        {
+            isNew = (Volatile.Read(ref _readyState) & NEW_FRAME) != 0;
+            if (isNew)
+            {
+                var ready = Interlocked.Exchange(ref _readyState, _frontIndex);
+                _frontIndex = ready & BUFFER_MASK;
+            }
+            return _buffers[_frontIndex];
+        }
+
+        /// <summary>
+        /// Converts a scanline of palette indexes into ARGB pixels
+        /// </summary>
+        /// <param name="source">Palette indexes</param>
+        /// <param name="sourceIndex">Start index in the source</param>
+        /// <param name="target">ARGB pixels</param>
+        /// <param name="targetIndex">Start index in the target</param>
+        /// <param name="count">Number of pixels to convert</param>
+        /// <param name="colors">256-entry color lookup table</param>
+        public static void ConvertScanline(byte[] source, int sourceIndex, uint[] target, int targetIndex,
+            int count, uint[] colors)
+        {
+            // --- Eight pixels (a screen byte) in each iteration
+            var i = 0;
+            for (; i <= count - 8; i += 8)
+            {
+                var s = sourceIndex + i;
+                var t = targetIndex + i;
+                target[t] = colors[source[s]];
+                target[t + 1] = colors[source[s + 1]];
+                target[t + 2] = colors[source[s + 2]];
+                target[t + 3] = colors[source[s + 3]];
+                target[t + 4] = colors[source[s + 4]];
+                target[t + 5] = colors[source[s + 5]];
+                target[t + 6] = colors[source[s + 6]];
+                target[t + 7] = colors[source[s + 7]];
+            }
+            for (; i < count; i++)
+            {
+                target[targetIndex + i] = colors[source[sourceIndex + i]];
+            }
+        }
+    }
+}
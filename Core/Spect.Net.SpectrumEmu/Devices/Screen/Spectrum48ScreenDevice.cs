@@ -51,6 +51,11 @@ namespace Spect.Net.SpectrumEmu.Devices.Screen
         /// </summary>
         public RenderingTact[] RenderingTactTable { get; private set; }
 
+        /// <summary>
+        /// Gets the precomputed memory and I/O contention delays of the frame
+        /// </summary>
+        public ContentionTable ContentionTable { get; private set; }
+
         /// <summary>
         /// Indicates the refresh rate calculated from the base clock frequency
         /// of the CPU and the screen configuration (total #of screen rendering tacts per frame)
@@ -105,6 +110,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Screen
             _memoryDevice = hostVm.MemoryDevice;
             _contentionType = hostVm.MemoryConfiguration.ContentionType;
             InitializeScreenRenderingTactTable();
+            ContentionTable = new ContentionTable(RenderingTactTable, hostVm.ClockMultiplier);
             _flashPhase = false;
             FrameCount = 0;
 
@@ -0,0 +1,175 @@
+﻿using System;
+using Spect.Net.SpectrumEmu.Abstraction.Devices;
+
+namespace Spect.Net.SpectrumEmu.Devices.Sound
+{
+    /// <summary>
+    /// This class represents an input channel of the audio mixer. It resamples
+    /// the frame blocks of its source to the output rate of the mixer.
+    /// </summary>
+    /// <remarks>
+    /// Both rates are expressed in CPU tacts per sample, so the conversion ratio
+    /// is exact, and the channels do not drift from each other. The resampler
+    /// uses linear interpolation with a 32.32 fixed-point phase.
+    /// </remarks>
+    public class AudioMixerChannel
+    {
+        /// <summary>
+        /// The maximum number of resampled samples a channel may keep for the
+        /// next frame
+        /// </summary>
+        public const int MAX_BACKLOG = 16;
+
+        private const long ONE = 1L << 32;
+
+        private readonly long _step;
+        private long _phase;
+        private float _prev;
+        private float _next;
+        private float[] _pending = new float[1024];
+        private int _pendingCount;
+
+        /// <summary>
+        /// The name of the channel
+        /// </summary>
+        public string Name { get; }
+
+        /// <summary>
+        /// The device that provides the samples of the channel
+        /// </summary>
+        public IAudioSamplesDevice Source { get; }
+
+        /// <summary>
+        /// CPU tacts per source sample
+        /// </summary>
+        public int SourceTactsPerSample { get; }
+
+        /// <summary>
+        /// CPU tacts per output sample
+        /// </summary>
+        public int OutputTactsPerSample { get; }
+
+        /// <summary>
+        /// The gain of the channel
+        /// </summary>
+        public float Gain { get; set; }
+
+        /// <summary>
+        /// Indicates that the channel is muted
+        /// </summary>
+        public bool Muted { get; set; }
+
+        /// <summary>
+        /// The number of resampled samples waiting to be mixed
+        /// </summary>
+        public int PendingCount => _pendingCount;
+
+        /// <summary>
+        /// Creates a mixer channel
+        /// </summary>
+        /// <param name="name">Channel name</param>
+        /// <param name="source">Sample source</param>
+        /// <param name="sourceTactsPerSample">CPU tacts per source sample</param>
+        /// <param name="outputTactsPerSample">CPU tacts per output sample</param>
+        /// <param name="gain">Channel gain</param>
+        public AudioMixerChannel(string name, IAudioSamplesDevice source, 
+            int sourceTactsPerSample, int outputTactsPerSample, float gain = 1.0f)
+        {
+            if (sourceTactsPerSample <= 0)
+            {
+                throw new ArgumentOutOfRangeException(nameof(sourceTactsPerSample));
+            }
+            if (outputTactsPerSample <= 0)
+            {
+                throw new ArgumentOutOfRangeException(nameof(outputTactsPerSample));
+            }
+            Name = name;
+            Source = source;
+            SourceTactsPerSample = sourceTactsPerSample;
+            OutputTactsPerSample = outputTactsPerSample;
+            Gain = gain;
+            _step = ((long)outputTactsPerSample << 32) / sourceTactsPerSample;
+            Reset();
+        }
+
+        /// <summary>
+        /// Resets the channel state
+        /// </summary>
+        public void Reset()
+        {
+            _phase = 0;
+            _prev = _next = 0.0f;
+            _pendingCount = 0;
+        }
+
+        /// <summary>
+        /// Resamples the samples the source created in the last frame
+        /// </summary>
+        public void ConsumeSource()
+        {
+            var samples = Source?.AudioSamples;
+            if (samples == null) return;
+            Consume(samples, Math.Min(Source.NextSampleIndex, samples.Length));
+        }
+
+        /// <summary>
+        /// Resamples the specified source samples
+        /// </summary>
+        /// <param name="samples">Source samples</param>
+        /// <param name="count">Number of samples to use</param>
+        public void Consume(float[] samples, int count)
+        {
+            // --- Make room for the resampled block
+            var maxOutput = (int)((count * ONE + _phase) / _step) + 2;
+            if (_pending.Length < _pendingCount + maxOutput)
+            {
+                Array.Resize(ref _pending, (_pendingCount + maxOutput) * 2);
+            }
+
+            for (var i = 0; i < count; i++)
+            {
+                _prev = _next;
+                _next = samples[i];
+                while (_phase < ONE)
+                {
+                    _pending[_pendingCount++] = _prev + (_next - _prev) * (float)((double)_phase / ONE);
+                    _phase += _step;
+                }
+                _phase -= ONE;
+            }
+        }
+
+        /// <summary>
+        /// Adds the next resampled samples of the channel to the output. If
+        /// there are fewer samples than requested, the last sample is held.
+        /// </summary>
+        /// <param name="output">Output buffer</param>
+        /// <param name="count">Number of output samples</param>
+        public void MixInto(float[] output, int count)
+        {
+            var available = Math.Min(count, _pendingCount);
+            if (!Muted && Gain != 0.0f)
+            {
+                for (var i = 0; i < available; i++)
+                {
+                    output[i] += _pending[i] * Gain;
+                }
+                var hold = _next * Gain;
+                for (var i = available; i < count; i++)
+                {
+                    output[i] += hold;
+                }
+            }
+
+            // --- Keep the remaining samples, but do not let them pile up
+            var remaining = _pendingCount - available;
+            var drop = remaining > MAX_BACKLOG ? remaining - MAX_BACKLOG : 0;
+            remaining -= drop;
+            if (remaining > 0)
+            {
+                Array.Copy(_pending, available + drop, _pending, 0, remaining);
+            }
+            _pendingCount = remaining;
+        }
+    }
+}
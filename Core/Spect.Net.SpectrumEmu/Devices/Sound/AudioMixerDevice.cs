@@ -0,0 +1,193 @@
+﻿using System;
+using System.Collections.Generic;
+using Spect.Net.SpectrumEmu.Abstraction.Devices;
+using Spect.Net.SpectrumEmu.Abstraction.Providers;
+
+#pragma warning disable 67
+
+namespace Spect.Net.SpectrumEmu.Devices.Sound
+{
+    /// <summary>
+    /// This device mixes the audio sources of the Spectrum VM into a single
+    /// output stream with the sample rate of the beeper.
+    /// </summary>
+    /// <remarks>
+    /// The device is the last frame-bound device of the VM, so it completes
+    /// its frame after the beeper and the PSG created their samples. Tape
+    /// loading noise arrives through the EAR bit, so it is part of the
+    /// beeper channel. Each channel gets an equal share of the output range
+    /// by default, so the channels cannot clip even at their full level.
+    /// </remarks>
+    public class AudioMixerDevice: IAudioMixerDevice
+    {
+        /// <summary>
+        /// Name of the beeper channel
+        /// </summary>
+        public const string BEEPER_CHANNEL = "Beeper";
+
+        /// <summary>
+        /// Name of the PSG channel
+        /// </summary>
+        public const string PSG_CHANNEL = "Psg";
+
+        private IAudioMixerProvider _mixerProvider;
+        private readonly List<AudioMixerChannel> _channels = new List<AudioMixerChannel>();
+        private readonly Dictionary<int, float[]> _sampleBuffers = new Dictionary<int, float[]>();
+
+        /// <summary>
+        /// The virtual machine that hosts the device
+        /// </summary>
+        public ISpectrumVm HostVm { get; private set; }
+
+        /// <summary>
+        /// The mixed samples of the last frame
+        /// </summary>
+        public float[] AudioSamples { get; private set; } = new float[0];
+
+        /// <summary>
+        /// Index of the next audio sample
+        /// </summary>
+        public int NextSampleIndex { get; private set; }
+
+        /// <summary>
+        /// The number of CPU tacts per output sample
+        /// </summary>
+        public int TactsPerSample { get; private set; }
+
+        /// <summary>
+        /// The channels of the mixer
+        /// </summary>
+        public IReadOnlyList<AudioMixerChannel> Channels => _channels;
+
+        /// <summary>
+        /// #of frames rendered
+        /// </summary>
+        public int FrameCount { get; private set; }
+
+        /// <summary>
+        /// Overflow from the previous frame, given in #of tacts 
+        /// </summary>
+        public int Overflow { get; set; }
+
+        /// <summary>
+        /// Signs that the device has been attached to the Spectrum virtual machine
+        /// </summary>
+        public void OnAttachedToVm(ISpectrumVm hostVm)
+        {
+            HostVm = hostVm;
+            _mixerProvider = hostVm.AudioMixerProvider;
+            TactsPerSample = hostVm.AudioConfiguration.TactsPerSample;
+            _channels.Clear();
+            _channels.Add(new AudioMixerChannel(BEEPER_CHANNEL, hostVm.BeeperDevice,
+                hostVm.AudioConfiguration.TactsPerSample, TactsPerSample));
+            if (hostVm.SoundDevice != null && hostVm.SoundConfiguration != null)
+            {
+                _channels.Add(new AudioMixerChannel(PSG_CHANNEL, hostVm.SoundDevice,
+                    hostVm.SoundConfiguration.TactsPerSample, TactsPerSample));
+            }
+            foreach (var channel in _channels)
+            {
+                channel.Gain = 1.0f / _channels.Count;
+            }
+            Reset();
+        }
+
+        /// <summary>
+        /// Resets this device
+        /// </summary>
+        public void Reset()
+        {
+            foreach (var channel in _channels)
+            {
+                channel.Reset();
+            }
+            FrameCount = 0;
+            Overflow = 0;
+            NextSampleIndex = 0;
+            _mixerProvider?.Reset();
+        }
+
+        /// <summary>
+        /// Gets the state of the device so that the state can be saved
+        /// </summary>
+        /// <returns>The object that describes the state of the device</returns>
+        IDeviceState IDevice.GetState() => null;
+
+        /// <summary>
+        /// Sets the state of the device from the specified object
+        /// </summary>
+        /// <param name="state">Device state</param>
+        public void RestoreState(IDeviceState state)
+        {
+        }
+
+        /// <summary>
+        /// Gets the channel with the specified name
+        /// </summary>
+        /// <param name="name">Channel name</param>
+        /// <returns>The channel, if found; otherwise, null</returns>
+        public AudioMixerChannel GetChannel(string name)
+        {
+            foreach (var channel in _channels)
+            {
+                if (channel.Name == name) return channel;
+            }
+            return null;
+        }
+
+        /// <summary>
+        /// Allow the device to react to the start of a new frame
+        /// </summary>
+        public void OnNewFrame()
+        {
+            FrameCount++;
+            Overflow = 0;
+        }
+
+        /// <summary>
+        /// Allow the device to react to the completion of a frame
+        /// </summary>
+        public void OnFrameCompleted()
+        {
+            if (_channels.Count == 0) return;
+
+            // --- Resample the frame blocks of the sources
+            foreach (var channel in _channels)
+            {
+                channel.ConsumeSource();
+            }
+
+            // --- The first channel runs at the output rate, it sets the length
+            var count = _channels[0].PendingCount;
+            if (!_sampleBuffers.TryGetValue(count, out var samples))
+            {
+                samples = new float[count];
+                _sampleBuffers[count] = samples;
+            }
+            else
+            {
+                Array.Clear(samples, 0, count);
+            }
+
+            // --- Mix the channels
+            foreach (var channel in _channels)
+            {
+                channel.MixInto(samples, count);
+            }
+            for (var i = 0; i < count; i++)
+            {
+                if (samples[i] > 1.0f) samples[i] = 1.0f;
+                else if (samples[i] < -1.0f) samples[i] = -1.0f;
+            }
+
+            AudioSamples = samples;
+            NextSampleIndex = count;
+            _mixerProvider?.AddSoundFrame(samples);
+        }
+
+        /// <summary>
+        /// Allow external entities respond to frame completion
+        /// </summary>
+        public event EventHandler FrameCompleted;
+    }
+}
@@ -11,15 +11,18 @@ namespace Spect.Net.SpectrumEmu.Devices.Sound
         private readonly int _numTaps;
         private readonly double[] _taps;
         private readonly double[] _sr;
+        private int _head;
 
         public BandPassFilter(int numTaps, double freqSamplig, double freqLow, double freqHigh)
         {
             _numTaps = numTaps;
             _taps = new double[numTaps];
-            _sr = new double[numTaps];
+
+            // --- The shift register is a ring buffer stored twice, so that the
+            // --- taps can be applied to a contiguous range
+            _sr = new double[2 * numTaps];
             var lambda = Math.PI * freqLow / (freqSamplig / 2);
             var phi = Math.PI * freqHigh / (freqSamplig / 2);
-            for (var i = 0; i < _numTaps; i++) _sr[i] = 0.0;
 
             for (var n = 0; n < _numTaps; n++)
             {
@@ -37,15 +40,28 @@ namespace Spect.Net.SpectrumEmu.Devices.Sound
 
         public double DoSample(double sample)
         {
-            for (var i = _numTaps - 1; i >= 1; i--)
-            {
-                _sr[i] = _sr[i - 1];
-            }
-            _sr[0] = sample;
+            if (--_head < 0) _head = _numTaps - 1;
+            _sr[_head] = sample;
+            _sr[_head + _numTaps] = sample;
 
             double result = 0;
-            for (var i = 0; i < _numTaps; i++) result += _sr[i] * _taps[i];
+            for (var i = 0; i < _numTaps; i++) result += _sr[_head + i] * _taps[i];
             return result;
         }
+
+        /// <summary>
+        /// Filters a block of samples in place
+        /// </summary>
+        /// <param name="samples">Sample buffer</param>
+        /// <param name="index">Index of the first sample to filter</param>
+        /// <param name="count">Number of samples to filter</param>
+        public void DoBlock(float[] samples, int index, int count)
+        {
+            var end = index + count;
+            for (var i = index; i < end; i++)
+            {
+                samples[i] = (float)DoSample(samples[i]);
+            }
+        }
     }
 }
\ No newline at end of file
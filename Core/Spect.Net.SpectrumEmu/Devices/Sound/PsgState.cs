@@ -504,13 +504,39 @@ namespace Spect.Net.SpectrumEmu.Devices.Sound
         public float GetNoiseSample(long tact)
         {
             if (Register6 == 0) return 0.0f;
-            var noiseIndex = (ushort)((tact - NoisePeriodModified) / 32 / Register6);
-            while (noiseIndex > _lastNoiseIndex)
+            CatchUpNoise((ushort)((tact - NoisePeriodModified) / 32 / Register6));
+            return NoiseValue;
+        }
+
+        /// <summary>
+        /// The current output of the noise generator
+        /// </summary>
+        private float NoiseValue => ((_noiseSeed >> 16) & 1) == 0 ? 0.0f : 1.0f;
+
+        /// <summary>
+        /// Steps the noise generator until it reaches the specified period index.
+        /// </summary>
+        /// <param name="noiseIndex">Index of the noise period since the last period change</param>
+        /// <remarks>
+        /// The index is counted modulo 64K, so the generator keeps running after
+        /// the index wraps around
+        /// </remarks>
+        private void CatchUpNoise(ushort noiseIndex)
+        {
+            var steps = (ushort)(noiseIndex - _lastNoiseIndex);
+            for (var i = 0; i < steps; i++)
             {
-                _noiseSeed = (_noiseSeed * 2 + 1) ^ (((_noiseSeed >> 16) ^ (_noiseSeed >> 13)) & 1);
-                _lastNoiseIndex++;
+                StepNoise();
             }
-            return ((_noiseSeed >> 16) & 1) == 0 ? 0.0f : 1.0f;
+        }
+
+        /// <summary>
+        /// Moves the noise generator to its next period
+        /// </summary>
+        private void StepNoise()
+        {
+            _noiseSeed = (_noiseSeed * 2 + 1) ^ (((_noiseSeed >> 16) ^ (_noiseSeed >> 13)) & 1);
+            _lastNoiseIndex++;
         }
 
         /// <summary>
@@ -560,7 +586,17 @@ namespace Spect.Net.SpectrumEmu.Devices.Sound
 
             // --- index of amplitude (0-15) within the current period
             var periodPhase = (tact - EnvelopePeriodModified) % periodLength * 16 / periodLength;
+            return GetEnvelopeValue(periodCount, (int)periodPhase);
+        }
 
+        /// <summary>
+        /// Gets the value of envelope multiplier at the specified envelope position
+        /// </summary>
+        /// <param name="periodCount">Number of envelope periods elapsed</param>
+        /// <param name="periodPhase">Index of amplitude (0-15) within the current period</param>
+        /// <returns>Envelope aplitude</returns>
+        private float GetEnvelopeValue(long periodCount, int periodPhase)
+        {
             // --- We're in the very first period
             if (periodCount == 0)
             {
@@ -577,6 +613,127 @@ namespace Spect.Net.SpectrumEmu.Devices.Sound
                 : (periodCount % 2 == 1 ? s_Amplitudes[periodPhase] : s_Amplitudes[15 - periodPhase]);
         }
 
+        /// <summary>
+        /// Renders a block of mixed PSG samples
+        /// </summary>
+        /// <param name="buffer">Buffer to store the samples</param>
+        /// <param name="index">Index of the first sample within the buffer</param>
+        /// <param name="count">Number of samples to render</param>
+        /// <param name="tact">CPU tact of the first sample</param>
+        /// <param name="tactsPerSample">Number of CPU tacts between two samples</param>
+        /// <remarks>
+        /// The registers do not change within a block. The tone, noise, and envelope
+        /// positions are calculated once for the first sample, and then they are
+        /// advanced with running counters.
+        /// </remarks>
+        public void RenderSamples(float[] buffer, int index, int count, long tact, int tactsPerSample)
+        {
+            if (count <= 0) return;
+
+            // --- Step of the tone counters, in 32-tact units and tacts
+            var toneUnits = tactsPerSample >> 5;
+            var toneTacts = tactsPerSample & 0x1F;
+            var toneA = new ToneCounter(ToneAEnabled ? ChannelA : 0, tact - ChannelAModified);
+            var toneB = new ToneCounter(ToneBEnabled ? ChannelB : 0, tact - ChannelBModified);
+            var toneC = new ToneCounter(ToneCEnabled ? ChannelC : 0, tact - ChannelCModified);
+
+            // --- Set up the noise generator
+            var noisePeriod = Register6 << 5;
+            var noiseTact = 0;
+            if (noisePeriod != 0)
+            {
+                var elapsed = Elapsed(tact, NoisePeriodModified);
+                CatchUpNoise((ushort)(elapsed / noisePeriod));
+                noiseTact = (int)(elapsed % noisePeriod);
+            }
+            var noiseA = NoiseAEnabled;
+            var noiseB = NoiseBEnabled;
+            var noiseC = NoiseCEnabled;
+
+            // --- Set up the envelope
+            var useEnvelopeA = UseEnvelopeA;
+            var useEnvelopeB = UseEnvelopeB;
+            var useEnvelopeC = UseEnvelopeC;
+            var amplitudeA = s_Amplitudes[AmplitudeA];
+            var amplitudeB = s_Amplitudes[AmplitudeB];
+            var amplitudeC = s_Amplitudes[AmplitudeC];
+            var stepLength = EnvelopePeriod << 5;
+            var useEnvelope = (useEnvelopeA || useEnvelopeB || useEnvelopeC) && stepLength != 0;
+            var envelopeCount = 0L;
+            var envelopePhase = 0;
+            var envelopeTact = 0;
+            if (useEnvelope)
+            {
+                var elapsed = Elapsed(tact, EnvelopePeriodModified);
+                var periodLength = stepLength << 4;
+                envelopeCount = elapsed / periodLength;
+                var periodTact = (int)(elapsed % periodLength);
+                envelopePhase = periodTact / stepLength;
+                envelopeTact = periodTact % stepLength;
+            }
+
+            var end = index + count;
+            for (var i = index; i < end; i++)
+            {
+                // --- Mix the tone and noise of each channel
+                var noise = noisePeriod == 0 ? 0.0f : NoiseValue;
+                var channelA = toneA.Sample;
+                if (noiseA && noise > channelA)
+                {
+                    channelA = noise;
+                }
+                var channelB = toneB.Sample;
+                if (noiseB && noise > channelB)
+                {
+                    channelB = noise;
+                }
+                var channelC = toneC.Sample;
+                if (noiseC && noise > channelC)
+                {
+                    channelC = noise;
+                }
+
+                // --- Mix channels
+                var envelope = useEnvelope ? GetEnvelopeValue(envelopeCount, envelopePhase) : 0.0f;
+                buffer[i] = (channelA * (useEnvelopeA ? envelope : amplitudeA)
+                    + channelB * (useEnvelopeB ? envelope : amplitudeB)
+                    + channelC * (useEnvelopeC ? envelope : amplitudeC)) / 3;
+
+                // --- Move to the next sample
+                toneA.Advance(toneUnits, toneTacts);
+                toneB.Advance(toneUnits, toneTacts);
+                toneC.Advance(toneUnits, toneTacts);
+                if (noisePeriod != 0)
+                {
+                    noiseTact += tactsPerSample;
+                    while (noiseTact >= noisePeriod)
+                    {
+                        noiseTact -= noisePeriod;
+                        StepNoise();
+                    }
+                }
+                if (useEnvelope)
+                {
+                    envelopeTact += tactsPerSample;
+                    while (envelopeTact >= stepLength)
+                    {
+                        envelopeTact -= stepLength;
+                        if (++envelopePhase == 16)
+                        {
+                            envelopePhase = 0;
+                            envelopeCount++;
+                        }
+                    }
+                }
+            }
+        }
+
+        /// <summary>
+        /// Gets the number of tacts elapsed since a register modification
+        /// </summary>
+        private static long Elapsed(long tact, long modified)
+            => tact > modified ? tact - modified : 0;
+
         /// <summary>
         /// Gest the state of the PSG
         /// </summary>
@@ -605,5 +762,59 @@ namespace Spect.Net.SpectrumEmu.Devices.Sound
             public byte Value;
             public long ModifiedTact;
         }
+
+        /// <summary>
+        /// This structure keeps the running position of a tone channel
+        /// </summary>
+        private struct ToneCounter
+        {
+            private readonly int _period;
+            private int _position;
+            private int _tacts;
+
+            /// <summary>
+            /// Initializes the counter
+            /// </summary>
+            /// <param name="period">Tone period in 32-tact units (0: no tone)</param>
+            /// <param name="elapsed">CPU tacts elapsed since the tone was set</param>
+            public ToneCounter(int period, long elapsed)
+            {
+                _period = period;
+                if (period == 0 || elapsed < 0)
+                {
+                    _position = 0;
+                    _tacts = 0;
+                    return;
+                }
+                _position = (int)(elapsed / 32 % period);
+                _tacts = (int)(elapsed % 32);
+            }
+
+            /// <summary>
+            /// The tone sample at the current position
+            /// </summary>
+            public float Sample => _period == 0 ? 0.0f : s_WaveForm[_position * 16 / _period];
+
+            /// <summary>
+            /// Advances the position of the tone
+            /// </summary>
+            /// <param name="units">Number of 32-tact units to advance</param>
+            /// <param name="tacts">Number of remaining tacts to advance</param>
+            public void Advance(int units, int tacts)
+            {
+                if (_period == 0) return;
+                _tacts += tacts;
+                if (_tacts >= 32)
+                {
+                    _tacts -= 32;
+                    units++;
+                }
+                _position += units;
+                if (_position >= _period)
+                {
+                    _position %= _period;
+                }
+            }
+        }
     }
 }
\ No newline at end of file
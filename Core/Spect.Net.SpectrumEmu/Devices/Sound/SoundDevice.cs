@@ -1,4 +1,5 @@
 ﻿using System;
+using System.Collections.Generic;
 using Spect.Net.SpectrumEmu.Abstraction.Configuration;
 using Spect.Net.SpectrumEmu.Abstraction.Devices;
 using Spect.Net.SpectrumEmu.Abstraction.Providers;
@@ -19,6 +20,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Sound
         private readonly float[] _delay = new float[DC_FITER_SIZE];
         private int _filterIndex;
         private BandPassFilter _lpf;
+        private readonly Dictionary<int, float[]> _sampleBuffers = new Dictionary<int, float[]>();
 
         /// <summary>
         /// The virtual machine that hosts the device
@@ -182,8 +184,18 @@ namespace Spect.Net.SpectrumEmu.Devices.Sound
                 : _frameBegins + _tactsPerSample - (_frameBegins + _tactsPerSample) % _tactsPerSample;
             var samplesInFrame = (_frameBegins + _frameTacts - LastSampleTact - 1) / _tactsPerSample + 1;
 
-            // --- Empty the samples array
-            AudioSamples = new float[samplesInFrame];
+            // --- Reuse the samples array of the same length. The number of samples
+            // --- may vary by one between frames, so we keep a buffer for each length.
+            if (!_sampleBuffers.TryGetValue((int)samplesInFrame, out var samples))
+            {
+                samples = new float[samplesInFrame];
+                _sampleBuffers[(int)samplesInFrame] = samples;
+            }
+            else
+            {
+                Array.Clear(samples, 0, samples.Length);
+            }
+            AudioSamples = samples;
             NextSampleIndex = 0;
         }
 
@@ -191,61 +203,48 @@ namespace Spect.Net.SpectrumEmu.Devices.Sound
         /// Create samples according the current PSG state
         /// </summary>
         /// <param name="cpuTacts"></param>
+        /// <remarks>
+        /// The PSG registers do not change until cpuTacts, so the samples
+        /// are rendered and filtered as a single block
+        /// </remarks>
         private void CreateSamples(long cpuTacts)
         {
-            var nextSampleOffset = LastSampleTact;
             if (cpuTacts > _frameBegins + _frameTacts)
             {
                 cpuTacts = _frameBegins + _frameTacts;
             }
-            while (nextSampleOffset < cpuTacts)
-            {
-                AudioSamples[NextSampleIndex++] = CreateSampleFor(nextSampleOffset);
-                nextSampleOffset += _tactsPerSample;
-            }
-            LastSampleTact = nextSampleOffset;
+            if (LastSampleTact >= cpuTacts) return;
 
+            var count = (int)((cpuTacts - LastSampleTact - 1) / _tactsPerSample + 1);
+            PsgState.RenderSamples(AudioSamples, NextSampleIndex, count, LastSampleTact, _tactsPerSample);
+            FilterSamples(NextSampleIndex, count);
+            NextSampleIndex += count;
+            LastSampleTact += (long)count * _tactsPerSample;
         }
 
         /// <summary>
-        /// Create the PSG sample for the specified tact
+        /// Removes the DC component of the specified samples, and applies the
+        /// band-pass filter on them
         /// </summary>
-        /// <param name="tact">CPU tact to create the sample for</param>
-        /// <returns></returns>
-        private float CreateSampleFor(long tact)
+        /// <param name="index">Index of the first sample</param>
+        /// <param name="count">Number of samples</param>
+        private void FilterSamples(int index, int count)
         {
-            var noise = PsgState.GetNoiseSample(tact);
-            var channelA = PsgState.GetChannelASample(tact);
-            if (PsgState.NoiseAEnabled && noise > channelA)
-            {
-                channelA = noise;
-            }
-            var channelB = PsgState.GetChannelBSample(tact);
-            if (PsgState.NoiseBEnabled && noise > channelB)
-            {
-                channelB = noise;
-            }
-            var channelC = PsgState.GetChannelCSample(tact);
-            if (PsgState.NoiseCEnabled && noise > channelC)
-            {
-                channelC = noise;
-            }
-
-            // --- Mix channels
-            var sample = (channelA * PsgState.GetAmplitudeA(tact) + 
-                channelB * PsgState.GetAmplitudeB(tact) + 
-                channelC * PsgState.GetAmplitudeC(tact)) / 3;
-
-            // --- Remove DC
-            _filtSum += -_delay[_filterIndex] + sample;
-            _delay[_filterIndex] = sample;
-            sample = sample - _filtSum / DC_FITER_SIZE;
-            _filterIndex++;
-            if (_filterIndex >= DC_FITER_SIZE)
+            var samples = AudioSamples;
+            var end = index + count;
+            for (var i = index; i < end; i++)
             {
-                _filterIndex = 0;
+                var sample = samples[i];
+                _filtSum += -_delay[_filterIndex] + sample;
+                _delay[_filterIndex] = sample;
+                samples[i] = sample - _filtSum / DC_FITER_SIZE;
+                _filterIndex++;
+                if (_filterIndex >= DC_FITER_SIZE)
+                {
+                    _filterIndex = 0;
+                }
             }
-            return (float)_lpf.DoSample(sample);
+            _lpf.DoBlock(samples, index, count);
         }
 
         /// <summary>
@@ -272,7 +271,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Sound
             {
                 FrameBegins = device._frameBegins;
                 FilterIndex = device._filterIndex;
-                AudioSamples = device.AudioSamples;
+                AudioSamples = (float[])device.AudioSamples?.Clone();
                 SamplesIndex = device.NextSampleIndex;
                 (var psgRegs, var noiseSeed, var lastNoiseIndex) = device.PsgState.GetState();
                 PsgRegs = psgRegs;
@@ -293,7 +292,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Sound
 
                 sound._frameBegins = FrameBegins;
                 sound._filterIndex = FilterIndex;
-                sound.AudioSamples = AudioSamples;
+                sound.AudioSamples = (float[])AudioSamples?.Clone();
                 sound.NextSampleIndex = SamplesIndex;
                 sound.PsgState.SetState(PsgRegs, NoiseSeed, LastNoiseIndex);
                 sound.LastSampleTact = LastSampleTact;
@@ -183,7 +183,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Tape
                 && HostVm.ExecuteCycleOptions.FastTapeMode
                 && TapeFilePlayer != null
                 && TapeFilePlayer.PlayPhase != PlayPhase.Completed
-                && _cpu.Registers.PC == LoadBytesRoutineAddress)
+                && _cpu.PC == LoadBytesRoutineAddress)
             {
                 if (FastLoadFromTzx())
                 {
@@ -209,24 +209,24 @@ namespace Spect.Net.SpectrumEmu.Devices.Tape
             switch (_currentMode)
             {
                 case TapeOperationMode.Passive:
-                    if (_cpu.Registers.PC == LoadBytesRoutineAddress)
+                    if (_cpu.PC == LoadBytesRoutineAddress)
                     {
                         EnterLoadMode();
                     }
-                    else if (_cpu.Registers.PC == SaveBytesRoutineAddress)
+                    else if (_cpu.PC == SaveBytesRoutineAddress)
                     {
                         EnterSaveMode();
                     }
                     return;
                 case TapeOperationMode.Save:
-                    if (_cpu.Registers.PC == ERROR_ROM_ADDRESS 
+                    if (_cpu.PC == ERROR_ROM_ADDRESS 
                         || (int)(_cpu.Tacts - _lastMicBitActivityTact) > SAVE_STOP_SILENCE)
                     {
                         LeaveSaveMode();
                     }
                     return;
                 case TapeOperationMode.Load:
-                    if ((_tapePlayer?.Eof ?? false) || _cpu.Registers.PC == ERROR_ROM_ADDRESS) 
+                    if ((_tapePlayer?.Eof ?? false) || _cpu.PC == ERROR_ROM_ADDRESS) 
                     {
                         LeaveLoadMode();
                         LoadCompleted?.Invoke(this, EventArgs.Empty);
@@ -250,7 +250,7 @@ namespace Spect.Net.SpectrumEmu.Devices.Tape
                 return false;
             }
 
-            var regs = HostVm.Cpu.Registers;
+            ref var regs = ref HostVm.Cpu.Registers;
             regs.AF = regs._AF_;
 
             // --- Check if the operation is LOAD or VERIFY
@@ -0,0 +1,260 @@
+﻿using System;
+using System.Collections.Generic;
+using Spect.Net.SpectrumEmu.Cpu;
+
+namespace Spect.Net.SpectrumEmu.Disassembler
+{
+    /// <summary>
+    /// This class separates code from data by following the control flow
+    /// of the Z80 code from a set of entry points.
+    /// </summary>
+    /// <remarks>
+    /// Every instruction reached from an entry point is code. Jumps, calls,
+    /// restarts and relative jumps add their targets to the analysis; returns,
+    /// unconditional and indirect jumps end the current path. Addresses the CPU
+    /// has executed (see Z80Cpu.ExecutionFlowStatus) are also taken as entry
+    /// points, so the analysis finds code reached through indirect jumps, too.
+    /// Bytes not reached are data.
+    /// </remarks>
+    public class CodeFlowAnalyzer
+    {
+        /// <summary>
+        /// The addresses of the RST instructions and the NMI handler
+        /// </summary>
+        public static readonly ushort[] RestartVectors =
+        {
+            0x0000, 0x0008, 0x0010, 0x0018, 0x0020, 0x0028, 0x0030, 0x0038, 0x0066
+        };
+
+        // --- Address classification values
+        private const byte UNKNOWN = 0;
+        private const byte INSTRUCTION_START = 1;
+        private const byte INSTRUCTION_BODY = 2;
+
+        private readonly Z80Disassembler _disassembler;
+        private readonly byte[] _classes;
+        private readonly Stack<ushort> _pending = new Stack<ushort>();
+
+        /// <summary>
+        /// The disassembler used to decode the instructions
+        /// </summary>
+        public Z80Disassembler Disassembler => _disassembler;
+
+        /// <summary>
+        /// Optional execution coverage. Executed addresses are code.
+        /// </summary>
+        public MemoryStatusArray ExecutionCoverage { get; set; }
+
+        /// <summary>
+        /// Creates the analyzer for the specified memory
+        /// </summary>
+        /// <param name="memoryContents">The contents of the memory to analyze</param>
+        /// <param name="disasmFlags">
+        /// Optional Spectrum-specific flags. RST instructions handled in
+        /// Spectrum-specific mode are followed by data, so they end the path.
+        /// </param>
+        /// <param name="extendedSet">
+        /// True, if NEXT operation disassembly is allowed; otherwise, false
+        /// </param>
+        public CodeFlowAnalyzer(byte[] memoryContents,
+            Dictionary<int, SpectrumSpecificDisassemblyFlags> disasmFlags = null, bool extendedSet = false)
+        {
+            _disassembler = new Z80Disassembler(new MemoryMap(), memoryContents, disasmFlags, extendedSet);
+            _classes = new byte[memoryContents.Length];
+        }
+
+        /// <summary>
+        /// Analyzes the code flow within the specified range
+        /// </summary>
+        /// <param name="entryPoints">Entry points of the analysis</param>
+        /// <param name="startAddress">The start address of the range</param>
+        /// <param name="endAddress">The end address of the range (inclusive)</param>
+        /// <returns>Memory map with code, byte and word array sections</returns>
+        public MemoryMap Analyze(IEnumerable<ushort> entryPoints,
+            ushort startAddress = 0x0000, ushort endAddress = 0xFFFF)
+        {
+            var memory = _disassembler.MemoryContents;
+            if (endAddress >= memory.Length)
+            {
+                endAddress = (ushort)(memory.Length - 1);
+            }
+            Array.Clear(_classes, 0, _classes.Length);
+            _pending.Clear();
+
+            // --- Collect the entry points
+            if (entryPoints != null)
+            {
+                foreach (var entry in entryPoints)
+                {
+                    AddTarget(entry, startAddress, endAddress);
+                }
+            }
+            if (ExecutionCoverage != null)
+            {
+                // --- The first executed byte after a non-executed one is an
+                // --- instruction start
+                var prevExecuted = false;
+                for (var addr = startAddress; addr <= endAddress; addr++)
+                {
+                    var executed = ExecutionCoverage[addr];
+                    if (executed && !prevExecuted)
+                    {
+                        AddTarget(addr, startAddress, endAddress);
+                    }
+                    prevExecuted = executed;
+                    if (addr == endAddress) break;
+                }
+            }
+
+            // --- Follow the flow
+            while (_pending.Count > 0)
+            {
+                FollowPath(_pending.Pop(), startAddress, endAddress);
+            }
+            return CreateMap(startAddress, endAddress);
+        }
+
+        /// <summary>
+        /// Marks the instructions of a path as code until the path ends
+        /// </summary>
+        private void FollowPath(ushort address, ushort startAddress, ushort endAddress)
+        {
+            while (address >= startAddress && address <= endAddress)
+            {
+                // --- Stop at already visited code
+                if (_classes[address] != UNKNOWN) return;
+
+                var decoded = _disassembler.DecodeAt(address);
+                if (decoded == null || decoded.LastAddress > endAddress) return;
+
+                // --- Do not overlap with an already known instruction
+                for (var i = 1; i < decoded.Length; i++)
+                {
+                    if (_classes[address + i] != UNKNOWN) return;
+                }
+                _classes[address] = INSTRUCTION_START;
+                for (var i = 1; i < decoded.Length; i++)
+                {
+                    _classes[address + i] = INSTRUCTION_BODY;
+                }
+
+                var continues = GetFlow(decoded, out var target);
+                if (target.HasValue) AddTarget(target.Value, startAddress, endAddress);
+                if (!continues || decoded.LastAddress == 0xFFFF) return;
+                address = (ushort)(decoded.LastAddress + 1);
+            }
+        }
+
+        /// <summary>
+        /// Gets the control flow of the specified instruction
+        /// </summary>
+        /// <param name="decoded">Decoded instruction</param>
+        /// <param name="target">Jump or call target, if the instruction has any</param>
+        /// <returns>
+        /// True, if the execution may continue with the next instruction; otherwise, false
+        /// </returns>
+        private bool GetFlow(DecodedInstruction decoded, out ushort? target)
+        {
+            // --- Jumps, relative jumps and calls
+            target = decoded.HasLabelSymbol ? decoded.LabelAddress : (ushort?)null;
+            var prefix = decoded[0];
+            if (prefix == 0xED)
+            {
+                // --- RETN, RETI
+                return decoded.OpInfo == null || (decoded.OpCode & 0xC7) != 0x45;
+            }
+            if (prefix == 0xCB || decoded.Length > 1 && decoded[1] == 0xCB
+                && (prefix == 0xDD || prefix == 0xFD))
+            {
+                // --- Bit operations
+                return true;
+            }
+
+            // --- Index prefixes do not change the flow of standard instructions
+            var opCode = decoded.OpCode;
+            switch (opCode)
+            {
+                case 0xC3: // --- JP nn
+                case 0x18: // --- JR e
+                case 0xC9: // --- RET
+                case 0xE9: // --- JP (HL), JP (IX), JP (IY)
+                    return false;
+            }
+
+            if ((opCode & 0xC7) != 0xC7) return true;
+
+            // --- RST n
+            target = (ushort)(opCode & 0x38);
+            var flags = GetSpectrumFlags(decoded.Address);
+            if (opCode == 0xCF && (flags & SpectrumSpecificDisassemblyFlags.Spectrum48Rst08) != 0
+                || opCode == 0xEF && (flags & (SpectrumSpecificDisassemblyFlags.Spectrum48Rst28
+                    | SpectrumSpecificDisassemblyFlags.Spectrum128Rst28)) != 0)
+            {
+                // --- Data bytes follow the restart
+                return false;
+            }
+            return true;
+        }
+
+        /// <summary>
+        /// Gets the Spectrum-specific flags of the bank of the specified address
+        /// </summary>
+        private SpectrumSpecificDisassemblyFlags GetSpectrumFlags(ushort address)
+        {
+            return _disassembler.DisassemblyFlags.TryGetValue(address >> 14, out var flags)
+                ? flags
+                : SpectrumSpecificDisassemblyFlags.None;
+        }
+
+        /// <summary>
+        /// Adds a new path to the analysis, provided the address is in range
+        /// </summary>
+        private void AddTarget(ushort address, ushort startAddress, ushort endAddress)
+        {
+            if (address < startAddress || address > endAddress
+                || _classes[address] != UNKNOWN) return;
+            _pending.Push(address);
+        }
+
+        /// <summary>
+        /// Creates the memory map from the address classification
+        /// </summary>
+        private MemoryMap CreateMap(ushort startAddress, ushort endAddress)
+        {
+            var map = new MemoryMap();
+            var sectionStart = (int)startAddress;
+            var isCode = _classes[startAddress] != UNKNOWN;
+            for (var addr = startAddress + 1; addr <= endAddress + 1; addr++)
+            {
+                var addrIsCode = addr <= endAddress && _classes[addr] != UNKNOWN;
+                if (addr <= endAddress && addrIsCode == isCode) continue;
+
+                var sectionType = isCode
+                    ? MemorySectionType.Disassemble
+                    : IsVectorTable(sectionStart, addr - 1)
+                        ? MemorySectionType.WordArray
+                        : MemorySectionType.ByteArray;
+                map.Add(new MemorySection((ushort)sectionStart, (ushort)(addr - 1), sectionType));
+                sectionStart = addr;
+                isCode = addrIsCode;
+            }
+            return map;
+        }
+
+        /// <summary>
+        /// Checks if the specified data range is a table of code addresses
+        /// </summary>
+        private bool IsVectorTable(int start, int end)
+        {
+            var length = end - start + 1;
+            if (length < 4 || length % 2 != 0) return false;
+            var memory = _disassembler.MemoryContents;
+            for (var addr = start; addr < end; addr += 2)
+            {
+                var vector = memory[addr] | memory[addr + 1] << 8;
+                if (vector >= _classes.Length || _classes[vector] != INSTRUCTION_START) return false;
+            }
+            return true;
+        }
+    }
+}
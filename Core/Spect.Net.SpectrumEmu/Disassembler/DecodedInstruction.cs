@@ -0,0 +1,180 @@
+﻿namespace Spect.Net.SpectrumEmu.Disassembler
+{
+    /// <summary>
+    /// This class stores the compact record of a decoded Z80 instruction.
+    /// </summary>
+    /// <remarks>
+    /// The record keeps the instruction bytes and the decoding information
+    /// only. The operation codes and the instruction text are formatted on
+    /// first use, and then kept with the record, so a cached instruction
+    /// is formatted at most once, and only if it is displayed.
+    /// </remarks>
+    public sealed class DecodedInstruction
+    {
+        /// <summary>
+        /// The maximum number of bytes a record can store
+        /// </summary>
+        public const int MAX_LENGTH = 8;
+
+        private readonly ulong _bytes;
+        private bool _formatted;
+        private string _opCodes;
+        private string _instruction;
+        private int _tokenPosition;
+        private int _tokenLength;
+
+        /// <summary>
+        /// The address of the instruction
+        /// </summary>
+        public ushort Address { get; }
+
+        /// <summary>
+        /// The last address that belongs to the instruction
+        /// </summary>
+        public ushort LastAddress { get; }
+
+        /// <summary>
+        /// The number of instruction bytes
+        /// </summary>
+        public int Length { get; }
+
+        /// <summary>
+        /// The decoding information, or null, if the bytes do not form a
+        /// valid instruction
+        /// </summary>
+        public OperationMapBase OpInfo { get; }
+
+        /// <summary>
+        /// The operation code byte used to decode the instruction
+        /// </summary>
+        public byte OpCode { get; }
+
+        /// <summary>
+        /// Index mode (0: none, 1: IX, 2: IY)
+        /// </summary>
+        public int IndexMode { get; }
+
+        /// <summary>
+        /// Index displacement, if the instruction has any
+        /// </summary>
+        public byte? Displacement { get; }
+
+        /// <summary>
+        /// The offset of the first operand byte
+        /// </summary>
+        public int OperandOffset { get; }
+
+        /// <summary>
+        /// Indicates if the ZX Spectrum Next instructions were allowed during decoding
+        /// </summary>
+        public bool ExtendedSet { get; }
+
+        /// <summary>
+        /// Signs that the instruction has a symbol that can be associated with a literal
+        /// </summary>
+        public bool HasSymbol { get; }
+
+        /// <summary>
+        /// The symbol value
+        /// </summary>
+        public ushort SymbolValue { get; }
+
+        /// <summary>
+        /// Indicates if the instruction refers to a label
+        /// </summary>
+        public bool HasLabelSymbol { get; }
+
+        /// <summary>
+        /// The address of the label the instruction refers to
+        /// </summary>
+        public ushort LabelAddress { get; }
+
+        /// <summary>
+        /// Optional absolute target address
+        /// </summary>
+        public ushort TargetAddress { get; }
+
+        /// <summary>
+        /// Creates the decoded instruction record
+        /// </summary>
+        public DecodedInstruction(ushort address, ushort lastAddress, ulong bytes, int length,
+            OperationMapBase opInfo, byte opCode, int indexMode, byte? displacement, 
+            int operandOffset, bool extendedSet, bool hasSymbol, ushort symbolValue, 
+            bool hasLabelSymbol, ushort labelAddress, ushort targetAddress)
+        {
+            Address = address;
+            LastAddress = lastAddress;
+            _bytes = bytes;
+            Length = length;
+            OpInfo = opInfo;
+            OpCode = opCode;
+            IndexMode = indexMode;
+            Displacement = displacement;
+            OperandOffset = operandOffset;
+            ExtendedSet = extendedSet;
+            HasSymbol = hasSymbol;
+            SymbolValue = symbolValue;
+            HasLabelSymbol = hasLabelSymbol;
+            LabelAddress = labelAddress;
+            TargetAddress = targetAddress;
+        }
+
+        /// <summary>
+        /// Gets the instruction byte with the specified index
+        /// </summary>
+        /// <param name="index">Byte index</param>
+        public byte this[int index] => (byte)(_bytes >> (index << 3));
+
+        /// <summary>
+        /// Checks if the specified memory contains the bytes of this instruction
+        /// </summary>
+        /// <param name="memory">Memory contents</param>
+        /// <returns>True, if the memory holds the same bytes; otherwise, false</returns>
+        public bool Matches(byte[] memory)
+        {
+            if (Address + Length > memory.Length) return false;
+            for (var i = 0; i < Length; i++)
+            {
+                if (memory[Address + i] != this[i]) return false;
+            }
+            return true;
+        }
+
+        /// <summary>
+        /// Checks if the instruction consists of the specified bytes
+        /// </summary>
+        /// <param name="bytes">Bytes to check</param>
+        /// <returns>True, if the instruction has the same bytes; otherwise, false</returns>
+        public bool HasBytes(params byte[] bytes)
+        {
+            if (bytes.Length != Length) return false;
+            for (var i = 0; i < Length; i++)
+            {
+                if (bytes[i] != this[i]) return false;
+            }
+            return true;
+        }
+
+        /// <summary>
+        /// Gets the formatted operation codes and instruction text
+        /// </summary>
+        /// <param name="opCodes">Operation codes</param>
+        /// <param name="instruction">Instruction text</param>
+        /// <param name="tokenPosition">The start position of the symbol token</param>
+        /// <param name="tokenLength">The length of the symbol token</param>
+        public void GetFormatted(out string opCodes, out string instruction, 
+            out int tokenPosition, out int tokenLength)
+        {
+            if (!_formatted)
+            {
+                Z80Disassembler.FormatInstruction(this, out _opCodes, out _instruction,
+                    out _tokenPosition, out _tokenLength);
+                _formatted = true;
+            }
+            opCodes = _opCodes;
+            instruction = _instruction;
+            tokenPosition = _tokenPosition;
+            tokenLength = _tokenLength;
+        }
+    }
+}
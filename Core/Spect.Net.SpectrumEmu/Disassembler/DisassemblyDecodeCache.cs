@@ -0,0 +1,109 @@
+﻿using System.Collections.Generic;
+
+namespace Spect.Net.SpectrumEmu.Disassembler
+{
+    /// <summary>
+    /// This class caches decoded instructions by their bank and address, so
+    /// that repeated disassembly of the same memory does not decode the
+    /// unchanged instructions again.
+    /// </summary>
+    /// <remarks>
+    /// A cached record is used only if the memory still holds the same
+    /// instruction bytes. This way any memory change (code injection, tape
+    /// load, or code running in the VM) invalidates only the instructions it
+    /// touched, without tracking the memory writes. Invalidate can be used to
+    /// drop the records of a known range in advance.
+    /// </remarks>
+    public class DisassemblyDecodeCache
+    {
+        private readonly Dictionary<int, DecodedInstruction> _records = 
+            new Dictionary<int, DecodedInstruction>();
+
+        /// <summary>
+        /// The number of cached records
+        /// </summary>
+        public int Count => _records.Count;
+
+        /// <summary>
+        /// The number of successful lookups
+        /// </summary>
+        public long Hits { get; private set; }
+
+        /// <summary>
+        /// The number of failed lookups
+        /// </summary>
+        public long Misses { get; private set; }
+
+        /// <summary>
+        /// Gets the key of an address within a bank
+        /// </summary>
+        /// <param name="bankKey">Bank key</param>
+        /// <param name="address">Memory address</param>
+        public static int GetKey(int bankKey, ushort address) => (bankKey << 16) | address;
+
+        /// <summary>
+        /// Gets the decoded instruction of the specified key, provided the
+        /// memory still contains the same instruction
+        /// </summary>
+        /// <param name="key">Cache key</param>
+        /// <param name="memory">Current memory contents</param>
+        /// <param name="extendedSet">Are ZX Spectrum Next instructions allowed?</param>
+        /// <param name="decoded">The decoded instruction</param>
+        /// <returns>True, if a valid record is found; otherwise, false</returns>
+        public bool TryGet(int key, byte[] memory, bool extendedSet, out DecodedInstruction decoded)
+        {
+            if (_records.TryGetValue(key, out decoded)
+                && decoded.ExtendedSet == extendedSet
+                && decoded.Matches(memory))
+            {
+                Hits++;
+                return true;
+            }
+            Misses++;
+            decoded = null;
+            return false;
+        }
+
+        /// <summary>
+        /// Stores the specified decoded instruction
+        /// </summary>
+        /// <param name="key">Cache key</param>
+        /// <param name="decoded">Decoded instruction</param>
+        public void Set(int key, DecodedInstruction decoded)
+        {
+            _records[key] = decoded;
+        }
+
+        /// <summary>
+        /// Removes the records of the instructions that overlap the specified range
+        /// </summary>
+        /// <param name="bankKey">Bank key</param>
+        /// <param name="startAddress">Start address</param>
+        /// <param name="endAddress">End address (inclusive)</param>
+        public void Invalidate(int bankKey, ushort startAddress, ushort endAddress)
+        {
+            // --- Instructions may start a few bytes before the range
+            var first = startAddress - (DecodedInstruction.MAX_LENGTH - 1);
+            if (first < 0) first = 0;
+            for (var addr = first; addr <= endAddress; addr++)
+            {
+                var key = GetKey(bankKey, (ushort)addr);
+                if (_records.TryGetValue(key, out var decoded)
+                    && addr + decoded.Length > startAddress)
+                {
+                    _records.Remove(key);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Removes all records
+        /// </summary>
+        public void Clear()
+        {
+            _records.Clear();
+            Hits = 0;
+            Misses = 0;
+        }
+    }
+}
@@ -7,6 +7,12 @@ namespace Spect.Net.SpectrumEmu.Disassembler
     /// </summary>
     public class DisassemblyItem
     {
+        private bool _formatted = true;
+        private string _opCodes;
+        private string _instruction;
+        private int _tokenPosition;
+        private int _tokenLength;
+
         /// <summary>
         /// The memory address of the disassembled instruction
         /// </summary>
@@ -20,7 +26,19 @@ namespace Spect.Net.SpectrumEmu.Disassembler
         /// <summary>
         /// Operation codes used for the disassembly
         /// </summary>
-        public string OpCodes { get; set; }
+        public string OpCodes
+        {
+            get
+            {
+                EnsureFormatted();
+                return _opCodes;
+            }
+            set
+            {
+                EnsureFormatted();
+                _opCodes = value;
+            }
+        }
 
         /// <summary>
         /// Indicates that the disassembly instruction has an associated label
@@ -30,7 +48,19 @@ namespace Spect.Net.SpectrumEmu.Disassembler
         /// <summary>
         /// The Z80 assembly instruction
         /// </summary>
-        public string Instruction { get; set; }
+        public string Instruction
+        {
+            get
+            {
+                EnsureFormatted();
+                return _instruction;
+            }
+            set
+            {
+                EnsureFormatted();
+                _instruction = value;
+            }
+        }
 
         /// <summary>
         /// Disassembler-generated comment
@@ -45,12 +75,36 @@ namespace Spect.Net.SpectrumEmu.Disassembler
         /// <summary>
         /// The start position of token to replace
         /// </summary>
-        public int TokenPosition { get; set; }
+        public int TokenPosition
+        {
+            get
+            {
+                EnsureFormatted();
+                return _tokenPosition;
+            }
+            set
+            {
+                EnsureFormatted();
+                _tokenPosition = value;
+            }
+        }
 
         /// <summary>
         /// The lenght of token to replace
         /// </summary>
-        public int TokenLength { get; set; }
+        public int TokenLength
+        {
+            get
+            {
+                EnsureFormatted();
+                return _tokenLength;
+            }
+            set
+            {
+                EnsureFormatted();
+                _tokenLength = value;
+            }
+        }
 
         /// <summary>
         /// Signs that this item has a symbol that can be associated with a literal
@@ -78,6 +132,38 @@ namespace Spect.Net.SpectrumEmu.Disassembler
             HardComment = null;
         }
 
+        /// <summary>
+        /// Creates an item from a decoded instruction. The operation codes and
+        /// the instruction text are formatted only when first queried.
+        /// </summary>
+        /// <param name="decoded">Decoded instruction</param>
+        internal DisassemblyItem(DecodedInstruction decoded)
+        {
+            Address = decoded.Address;
+            LastAddress = decoded.LastAddress;
+            TargetAddress = decoded.TargetAddress;
+            HasSymbol = decoded.HasSymbol;
+            SymbolValue = decoded.SymbolValue;
+            HasLabelSymbol = decoded.HasLabelSymbol;
+            Decoded = decoded;
+            _formatted = false;
+        }
+
+        /// <summary>
+        /// Gets the decoded instruction this item has been created from, if any
+        /// </summary>
+        internal DecodedInstruction Decoded { get; }
+
+        /// <summary>
+        /// Takes over the formatted texts of the decoded instruction
+        /// </summary>
+        private void EnsureFormatted()
+        {
+            if (_formatted) return;
+            _formatted = true;
+            Decoded.GetFormatted(out _opCodes, out _instruction, out _tokenPosition, out _tokenLength);
+        }
+
         /// <summary>
         /// Returns a string that represents the current object.
         /// </summary>
@@ -18,7 +18,8 @@ namespace Spect.Net.SpectrumEmu.Disassembler
         private DisassemblyOutput _output;
         private int _offset;
         private int _opOffset;
-        private StringBuilder _currentOpCodes;
+        private ulong _opBytes;
+        private int _opLength;
         private byte? _displacement;
         private byte _opCode;
         private int _indexMode;
@@ -71,6 +72,18 @@ namespace Spect.Net.SpectrumEmu.Disassembler
         /// </summary>
         public bool ExtendedInstructionsAllowed { get; }
 
+        /// <summary>
+        /// Optional cache of decoded instructions shared among disassemblies
+        /// </summary>
+        public DisassemblyDecodeCache DecodeCache { get; set; }
+
+        /// <summary>
+        /// Optional keys of the memory banks paged into the 16K slots. Cached
+        /// instructions of different banks at the same address are kept apart
+        /// by these keys.
+        /// </summary>
+        public int[] BankKeys { get; set; }
+
         /// <summary>
         /// Initializes a new instance of the <see cref="T:System.Object" /> class.
         /// </summary>
@@ -321,9 +334,62 @@ namespace Spect.Net.SpectrumEmu.Disassembler
         /// Disassembles a single instruction
         /// </summary>
         private DisassemblyItem DisassembleOperation()
+        {
+            return CreateItem(GetDecodedOperation());
+        }
+
+        /// <summary>
+        /// Decodes the instruction at the specified address without creating
+        /// disassembly output
+        /// </summary>
+        /// <param name="address">Instruction address</param>
+        /// <returns>
+        /// The decoded instruction, or null, if it runs over the end of the memory
+        /// </returns>
+        internal DecodedInstruction DecodeAt(ushort address)
+        {
+            _offset = address;
+            _overflow = false;
+            var decoded = GetDecodedOperation();
+            return _overflow ? null : decoded;
+        }
+
+        /// <summary>
+        /// Gets the decoded instruction at the current offset, either from the
+        /// decode cache or by decoding it
+        /// </summary>
+        private DecodedInstruction GetDecodedOperation()
+        {
+            var address = (ushort)_offset;
+            var cache = DecodeCache;
+            var key = 0;
+            if (cache != null)
+            {
+                key = DisassemblyDecodeCache.GetKey(GetBankKey(address), address);
+                if (cache.TryGet(key, MemoryContents, ExtendedInstructionsAllowed, out var cached))
+                {
+                    _opOffset = _offset;
+                    _offset += cached.Length;
+                    return cached;
+                }
+            }
+
+            var decoded = DecodeOperation();
+            if (cache != null && !_overflow)
+            {
+                cache.Set(key, decoded);
+            }
+            return decoded;
+        }
+
+        /// <summary>
+        /// Decodes the instruction at the current offset into a compact record
+        /// </summary>
+        private DecodedInstruction DecodeOperation()
         {
             _opOffset = _offset;
-            _currentOpCodes = new StringBuilder(16);
+            _opBytes = 0;
+            _opLength = 0;
             _displacement = null;
             _indexMode = 0; // No index
             OperationMapBase decodeInfo;
@@ -395,7 +461,11 @@ namespace Spect.Net.SpectrumEmu.Disassembler
             }
             var value = MemoryContents[(ushort)_offset];
             _offset++;
-            _currentOpCodes.AppendFormat("{0:X2} ", value);
+            if (_opLength < DecodedInstruction.MAX_LENGTH)
+            {
+                _opBytes |= (ulong)value << (_opLength << 3);
+                _opLength++;
+            }
             return value;
         }
 
@@ -406,140 +476,222 @@ namespace Spect.Net.SpectrumEmu.Disassembler
             return (ushort)(h << 8 | l);
         }
 
-        private DisassemblyItem DecodeInstruction(ushort address, OperationMapBase opInfo)
+        /// <summary>
+        /// Fetches the operand bytes of the instruction, and collects the
+        /// symbol information. The texts are formatted later, on demand.
+        /// </summary>
+        private DecodedInstruction DecodeInstruction(ushort address, OperationMapBase opInfo)
         {
+            var operandOffset = _opLength;
+            var hasSymbol = false;
+            var symbolValue = (ushort)0;
+            var hasLabelSymbol = false;
+            var labelAddress = (ushort)0;
+            var targetAddress = (ushort)0;
+            if (opInfo != null)
+            {
+                // --- Operands are fetched in the order of their pragmas
+                var pattern = opInfo.InstructionPattern;
+                var pragmaCount = 0;
+                var pragmaIndex = pattern.IndexOf('^');
+                while (pragmaIndex >= 0 && pragmaIndex + 1 < pattern.Length && pragmaCount < 4)
+                {
+                    pragmaCount++;
+                    switch (pattern[pragmaIndex + 1])
+                    {
+                        case 'r':
+                            var distance = Fetch();
+                            labelAddress = (ushort)(_opOffset + 2 + (sbyte)distance);
+                            hasLabelSymbol = true;
+                            hasSymbol = true;
+                            symbolValue = labelAddress;
+                            break;
+                        case 'L':
+                            targetAddress = labelAddress = FetchWord();
+                            hasLabelSymbol = true;
+                            hasSymbol = true;
+                            symbolValue = labelAddress;
+                            break;
+                        case 'B':
+                            symbolValue = Fetch();
+                            hasSymbol = true;
+                            break;
+                        case 'W':
+                            symbolValue = FetchWord();
+                            hasSymbol = true;
+                            break;
+                    }
+                    pragmaIndex = pattern.IndexOf('^', pragmaIndex + 2);
+                }
+            }
+
+            return new DecodedInstruction(address, (ushort)(_offset - 1), _opBytes, _opLength,
+                opInfo, _opCode, _indexMode, _displacement, operandOffset, ExtendedInstructionsAllowed,
+                hasSymbol, symbolValue, hasLabelSymbol, labelAddress, targetAddress);
+        }
+
+        /// <summary>
+        /// Creates the disassembly item of a decoded instruction
+        /// </summary>
+        private DisassemblyItem CreateItem(DecodedInstruction decoded)
+        {
+            if (decoded.HasLabelSymbol)
+            {
+                _output.CreateLabel(decoded.LabelAddress, decoded.Address);
+            }
+            return new DisassemblyItem(decoded);
+        }
+
+        /// <summary>
+        /// Gets the bank key of the specified address
+        /// </summary>
+        private int GetBankKey(ushort address)
+        {
+            var slot = address >> 14;
+            return BankKeys != null && slot < BankKeys.Length ? BankKeys[slot] : slot;
+        }
+
+        /// <summary>
+        /// Formats the operation codes and the instruction text of a decoded
+        /// instruction
+        /// </summary>
+        /// <param name="decoded">Decoded instruction</param>
+        /// <param name="opCodes">Operation codes</param>
+        /// <param name="instruction">Instruction text</param>
+        /// <param name="tokenPosition">The start position of the symbol token</param>
+        /// <param name="tokenLength">The length of the symbol token</param>
+        internal static void FormatInstruction(DecodedInstruction decoded, out string opCodes,
+            out string instruction, out int tokenPosition, out int tokenLength)
+        {
+            var sb = new StringBuilder(3 * decoded.Length);
+            for (var i = 0; i < decoded.Length; i++)
+            {
+                sb.AppendFormat("{0:X2} ", decoded[i]);
+            }
+            opCodes = sb.ToString();
+            tokenPosition = 0;
+            tokenLength = 0;
+
             // --- By default, unknown codes are NOP operations
-            var disassemblyItem = new DisassemblyItem(address)
+            if (decoded.OpInfo == null)
             {
-                OpCodes = _currentOpCodes.ToString(),
-                Instruction = "nop",
-                LastAddress = (ushort)(_offset - 1)
-            };
-            if (opInfo == null) return disassemblyItem;
+                instruction = "nop";
+                return;
+            }
 
-            // --- We have a real operation, it's time to decode it
+            // --- We have a real operation, it's time to format it
             var pragmaCount = 0;
-            disassemblyItem.Instruction = opInfo.InstructionPattern;
+            var operandIndex = decoded.OperandOffset;
+            instruction = decoded.OpInfo.InstructionPattern;
             do
             {
-                var pragmaIndex = disassemblyItem.Instruction.IndexOf("^", StringComparison.Ordinal);
+                var pragmaIndex = instruction.IndexOf("^", StringComparison.Ordinal);
                 if (pragmaIndex < 0) break;
                 pragmaCount++;
-                ProcessPragma(disassemblyItem, pragmaIndex);
+                ProcessPragma(decoded, ref instruction, pragmaIndex, ref operandIndex,
+                    ref tokenPosition, ref tokenLength);
             } while (pragmaCount < 4);
-
-            // --- We've fully processed the instruction
-            disassemblyItem.OpCodes = _currentOpCodes.ToString();
-            disassemblyItem.LastAddress = (ushort)(_offset - 1);
-            return disassemblyItem;
         }
 
-        private void ProcessPragma(DisassemblyItem disassemblyItem, int pragmaIndex)
+        private static void ProcessPragma(DecodedInstruction decoded, ref string instruction, 
+            int pragmaIndex, ref int operandIndex, ref int tokenPosition, ref int tokenLength)
         {
-            var instruction = disassemblyItem.Instruction;
             if (pragmaIndex >= instruction.Length) return;
 
+            var opCode = decoded.OpCode;
+            var indexMode = decoded.IndexMode;
             var pragma = instruction[pragmaIndex + 1];
             var replacement = "";
             var symbolPresent = false;
-            var symbolValue = (ushort) 0x000;
             switch (pragma)
             {
                 case '8':
                     // --- #8: 8-bit value defined on bit 3, 4 and 5 ($00, $10, ..., $38)
-                    var val = (byte)(_opCode & 0x38);
+                    var val = (byte)(opCode & 0x38);
                     replacement = ByteToString(val);
                     break;
                 case 'b':
                     // --- #b: bit index defined on bit 3, 4 and 5 in bit operations
-                    var bit = (byte)((_opCode & 0x38) >> 3);
+                    var bit = (byte)((opCode & 0x38) >> 3);
                     replacement = bit.ToString();
                     break;
                 case 'r':
                     // --- #r: relative label (8 bit offset)
-                    var distance = Fetch();
-                    var labelAddr = (ushort) (_opOffset + 2 + (sbyte) distance);
-                    _output.CreateLabel(labelAddr, (ushort)_opOffset);
+                    var distance = decoded[operandIndex++];
+                    var labelAddr = (ushort) (decoded.Address + 2 + (sbyte) distance);
                     replacement = GetLabelName(labelAddr);
                     symbolPresent = true;
-                    disassemblyItem.HasLabelSymbol = true;
-                    symbolValue = labelAddr;
                     break;
                 case 'L':
                     // --- #L: absolute label (16 bit address)
-                    var target = FetchWord();
-                    disassemblyItem.TargetAddress = target;
-                    _output.CreateLabel(target, (ushort)_opOffset);
+                    var target = (ushort)(decoded[operandIndex] | decoded[operandIndex + 1] << 8);
+                    operandIndex += 2;
                     replacement = GetLabelName(target);
                     symbolPresent = true;
-                    disassemblyItem.HasLabelSymbol = true;
-                    symbolValue = target;
                     break;
                 case 'q':
                     // --- #q: 8-bit registers named on bit 3, 4 and 5 (B, C, ..., (HL), A)
-                    var regqIndex = (_opCode & 0x38) >> 3;
+                    var regqIndex = (opCode & 0x38) >> 3;
                     replacement = s_Q8Regs[regqIndex];
                     break;
                 case 's':
                     // --- #q: 8-bit registers named on bit 0, 1 and 2 (B, C, ..., (HL), A)
-                    var regsIndex = _opCode & 0x07;
+                    var regsIndex = opCode & 0x07;
                     replacement = s_Q8Regs[regsIndex];
                     break;
                 case 'Q':
                     // --- #Q: 16-bit register pair named on bit 4 and 5 (BC, DE, HL, SP)
-                    var regQIndex = (_opCode & 0x30) >> 4;
+                    var regQIndex = (opCode & 0x30) >> 4;
                     replacement = s_Q16Regs[regQIndex];
                     break;
                 case 'R':
                     // --- #Q: 16-bit register pair named on bit 4 and 5 (BC, DE, HL, AF)
-                    var regRIndex = (_opCode & 0x30) >> 4;
+                    var regRIndex = (opCode & 0x30) >> 4;
                     replacement = s_R16Regs[regRIndex];
                     break;
                 case 'B':
                     // --- #B: 8-bit value from the code
-                    var value = Fetch();
+                    var value = decoded[operandIndex++];
                     replacement = ByteToString(value);
                     symbolPresent = true;
-                    symbolValue = value;
                     break;
                 case 'W':
                     // --- #W: 16-bit word from the code
-                    var word = FetchWord();
+                    var word = (ushort)(decoded[operandIndex] | decoded[operandIndex + 1] << 8);
+                    operandIndex += 2;
                     replacement = WordToString(word);
                     symbolPresent = true;
-                    symbolValue = word;
                     break;
                 case 'X':
                     // --- #X: Index register (IX or IY) according to current index mode
-                    replacement = _indexMode == 1 ? "ix": "iy";
+                    replacement = indexMode == 1 ? "ix": "iy";
                     break;
                 case 'l':
                     // --- #l: Lowest 8 bit index register (XL or YL) according to current index mode
-                    replacement = _indexMode == 1 ? "xl" : "yl";
+                    replacement = indexMode == 1 ? "xl" : "yl";
                     break;
                 case 'h':
                     // --- #h: Highest 8 bit index register (XH or YH) according to current index mode
-                    replacement = _indexMode == 1 ? "xh" : "yh";
+                    replacement = indexMode == 1 ? "xh" : "yh";
                     break;
                 case 'D':
                     // --- #D: Index operation displacement
-                    if (_displacement.HasValue)
+                    var displacement = decoded.Displacement;
+                    if (displacement.HasValue)
                     {
-                        replacement = (sbyte) _displacement < 0 
-                            ? $"-{ByteToString((byte) (0x100 - _displacement.Value))}" 
-                            : $"+{ByteToString(_displacement.Value)}";
+                        replacement = (sbyte) displacement < 0 
+                            ? $"-{ByteToString((byte) (0x100 - displacement.Value))}" 
+                            : $"+{ByteToString(displacement.Value)}";
                     }
                     break;
             }
 
             if (symbolPresent && !string.IsNullOrEmpty(replacement))
             {
-                disassemblyItem.TokenPosition = pragmaIndex;
-                disassemblyItem.TokenLength = replacement.Length;
-                disassemblyItem.HasSymbol = true;
-                disassemblyItem.SymbolValue = symbolValue;
+                tokenPosition = pragmaIndex;
+                tokenLength = replacement.Length;
             }
-            disassemblyItem.Instruction = instruction.Substring(0, pragmaIndex)
+            instruction = instruction.Substring(0, pragmaIndex)
                           + (replacement ?? "")
                           + instruction.Substring(pragmaIndex + 2);
         }
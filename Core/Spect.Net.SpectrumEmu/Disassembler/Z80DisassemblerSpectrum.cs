@@ -1,6 +1,5 @@
 ﻿using System.Collections.Generic;
 using System.Linq;
-using System.Text;
 using Spect.Net.SpectrumEmu.Abstraction.Providers;
 using Spect.Net.SpectrumEmu.Utility;
 
@@ -19,11 +18,11 @@ namespace Spect.Net.SpectrumEmu.Disassembler
         {
             _spectMode = SpectrumSpecificMode.Spectrum48Rst28;
             _seriesCount = 0;
-            _currentOpCodes = new StringBuilder(16);
             var addr = _offset = section.StartAddress;
             while (addr <= section.EndAddress)
             {
-                _currentOpCodes.Clear();
+                _opBytes = 0;
+                _opLength = 0;
                 var opCode = Fetch();
                 // ReSharper disable once UnusedVariable
                 var item = DisassembleCalculatorEntry((ushort)addr, opCode, out var carryOn);
@@ -47,9 +46,13 @@ namespace Spect.Net.SpectrumEmu.Disassembler
             if (!DisassemblyFlags.TryGetValue(bank, out var flags) 
                 || flags == SpectrumSpecificDisassemblyFlags.None) return false;
 
+            // --- Compare the decoded bytes, so the item need not be formatted
+            var decoded = item.Decoded;
+            if (decoded == null) return false;
+
             // --- Check for Spectrum 48K RST #08
             if ((flags & SpectrumSpecificDisassemblyFlags.Spectrum48Rst08) != 0 
-                && item.OpCodes.Trim() == "CF")
+                && decoded.HasBytes(0xCF))
             {
                 _spectMode = SpectrumSpecificMode.Spectrum48Rst08;
                 item.HardComment = "(Report error)";
@@ -58,9 +61,9 @@ namespace Spect.Net.SpectrumEmu.Disassembler
 
             // --- Check for Spectrum 48K RST #28
             if ((flags & SpectrumSpecificDisassemblyFlags.Spectrum48Rst28) != 0
-                && (item.OpCodes.Trim() == "EF"            // --- RST #28
-                    || item.OpCodes.Trim() == "CD 5E 33"   // --- CALL 335E
-                    || item.OpCodes.Trim() == "CD 62 33")) // --- CALL 3362
+                && (decoded.HasBytes(0xEF)                 // --- RST #28
+                    || decoded.HasBytes(0xCD, 0x5E, 0x33)  // --- CALL 335E
+                    || decoded.HasBytes(0xCD, 0x62, 0x33))) // --- CALL 3362
             {
                 _spectMode = SpectrumSpecificMode.Spectrum48Rst28;
                 _seriesCount = 0;
@@ -70,7 +73,7 @@ namespace Spect.Net.SpectrumEmu.Disassembler
 
             // --- Check for Spectrum 128K RST #28
             if ((flags & SpectrumSpecificDisassemblyFlags.Spectrum128Rst28) != 0
-                && item.OpCodes.Trim() == "EF")
+                && decoded.HasBytes(0xEF))
             {
                 _spectMode = SpectrumSpecificMode.Spectrum128Rst8;
                 item.HardComment = "(Call Spectrum 48 ROM)";
@@ -55,6 +55,25 @@
         /// </summary>
         public long TimeoutTacts { get; }
 
+        /// <summary>
+        /// This flag shows that the virtual machine should run in turbo mode
+        /// </summary>
+        /// <remarks>
+        /// In turbo mode the screen is rendered once per scanline instead of
+        /// after every instruction. Screen memory changes within a scanline
+        /// become visible at the next scanline boundary.
+        /// </remarks>
+        public bool TurboMode { get; }
+
+        /// <summary>
+        /// Indicates if fast disk mode is allowed
+        /// </summary>
+        /// <remarks>
+        /// In fast disk mode the +3DOS sector read and write routines are
+        /// serviced directly from the virtual floppy files.
+        /// </remarks>
+        public bool FastDiskMode { get; }
+
         /// <summary>
         /// Initializes the options
         /// </summary>
@@ -69,6 +88,8 @@
         /// <param name="fastVmMode">The VM should run in hidden mode</param>
         /// <param name="timeoutTacts">Run time out in CPU tacts</param>
         /// <param name="disableScreenRendering">Screen rendering mode</param>
+        /// <param name="turboMode">Batch screen rendering per scanline</param>
+        /// <param name="fastDiskMode">Fast disk mode</param>
         public ExecuteCycleOptions(EmulationMode emulationMode = EmulationMode.Continuous, 
             DebugStepMode debugStepMode = DebugStepMode.StopAtBreakpoint, 
             bool fastTapeMode = false,
@@ -77,7 +98,9 @@
             bool skipInterruptRoutine = false,
             bool fastVmMode = false,
             long timeoutTacts = 0,
-            bool disableScreenRendering = false)
+            bool disableScreenRendering = false,
+            bool turboMode = false,
+            bool fastDiskMode = false)
         {
             EmulationMode = emulationMode;
             DebugStepMode = debugStepMode;
@@ -88,6 +111,8 @@
             FastVmMode = fastVmMode;
             TimeoutTacts = timeoutTacts;
             DisableScreenRendering = disableScreenRendering;
+            TurboMode = turboMode;
+            FastDiskMode = fastDiskMode;
         }
     }
 }
\ No newline at end of file
@@ -5,6 +5,7 @@ using System.Threading;
 using Newtonsoft.Json;
 using Newtonsoft.Json.Linq;
 using Spect.Net.EvalParser.SyntaxTree;
+using Spect.Net.EvalParser.Watch;
 using Spect.Net.SpectrumEmu.Abstraction.Configuration;
 using Spect.Net.SpectrumEmu.Abstraction.Devices;
 using Spect.Net.SpectrumEmu.Abstraction.Providers;
@@ -20,6 +21,8 @@ using Spect.Net.SpectrumEmu.Devices.Rom;
 using Spect.Net.SpectrumEmu.Devices.Screen;
 using Spect.Net.SpectrumEmu.Devices.Sound;
 using Spect.Net.SpectrumEmu.Devices.Tape;
+using Spect.Net.SpectrumEmu.Recording;
+using Spect.Net.SpectrumEmu.Utility;
 // ReSharper disable IdentifierTypo
 
 #pragma warning disable 67
@@ -37,6 +40,11 @@ namespace Spect.Net.SpectrumEmu.Machine
         ISpectrumVmRunCodeSupport
     {
         private int _frameTacts;
+        private int _clockShift;
+        private int _screenLineTime;
+        private int _nextRenderTact;
+        private bool _turboRendering;
+        private long _instructionStartTacts;
         private bool _frameCompleted;
         private readonly List<ISpectrumBoundDevice> _spectrumDevices = new List<ISpectrumBoundDevice>();
         private readonly List<IFrameBoundDevice> _frameBoundDevices;
@@ -190,6 +198,16 @@ namespace Spect.Net.SpectrumEmu.Machine
         /// </summary>
         public IAudioConfiguration SoundConfiguration { get; }
 
+        /// <summary>
+        /// The optional device that mixes the audio sources
+        /// </summary>
+        public IAudioMixerDevice AudioMixerDevice { get; }
+
+        /// <summary>
+        /// The provider that renders the mixed audio stream
+        /// </summary>
+        public IAudioMixerProvider AudioMixerProvider { get; }
+
         /// <summary>
         /// The tape device attached to the VM
         /// </summary>
@@ -230,6 +248,21 @@ namespace Spect.Net.SpectrumEmu.Machine
         /// </summary>
         public IExpressionEvaluationContext DebugExpressionContext { get; set; }
 
+        /// <summary>
+        /// Watch expressions evaluated while the machine runs
+        /// </summary>
+        public WatchEngine WatchEngine { get; set; }
+
+        /// <summary>
+        /// The recorder that captures the completed frames
+        /// </summary>
+        public FrameRecorder FrameRecorder { get; set; }
+
+        /// <summary>
+        /// Keyboard and Kempston events scheduled for specific CPU tacts
+        /// </summary>
+        public InputSchedule InputSchedule { get; }
+
         /// <summary>
         /// #of frames rendered
         /// </summary>
@@ -243,7 +276,15 @@ namespace Spect.Net.SpectrumEmu.Machine
         /// <summary>
         /// Gets the current frame tact according to the CPU tick count
         /// </summary>
-        public virtual int CurrentFrameTact => (int)(Cpu.Tacts - LastFrameStartCpuTick)/ClockMultiplier;
+        /// <remarks>
+        /// The clock multiplier is always a power of two, so a shift replaces the division
+        /// </remarks>
+        public virtual int CurrentFrameTact => (int)(Cpu.Tacts - LastFrameStartCpuTick) >> _clockShift;
+
+        /// <summary>
+        /// Gets the number of CPU tacts elapsed since the start of the current frame
+        /// </summary>
+        public int CurrentFrameCpuTact => (int)(Cpu.Tacts - LastFrameStartCpuTick);
 
         /// <summary>
         /// Overflow from the previous frame, given in #of tacts 
@@ -310,6 +351,10 @@ namespace Spect.Net.SpectrumEmu.Machine
                 else if (mult > 8) mult = 8;
             }
             ClockMultiplier = mult;
+            while (1 << _clockShift < mult)
+            {
+                _clockShift++;
+            }
             Cpu = new Z80Cpu(MemoryDevice, 
                 PortDevice, 
                 cpuConfig?.SupportsNextOperations ?? false,
@@ -381,9 +426,18 @@ namespace Spect.Net.SpectrumEmu.Machine
                 FloppyConfiguration = (IFloppyConfiguration)floppyInfo.ConfigurationData ?? new FloppyConfiguration();
             }
 
+            // --- Init the audio mixer device
+            var mixerInfo = GetDeviceInfo<IAudioMixerDevice>();
+            AudioMixerProvider = (IAudioMixerProvider)mixerInfo?.Provider;
+            AudioMixerDevice = mixerInfo == null
+                ? null
+                : mixerInfo.Device ?? new AudioMixerDevice();
+
             // --- Carry out frame calculations
             ResetUlaTact();
             _frameTacts = ScreenConfiguration.ScreenRenderingFrameTactCount;
+            InputSchedule = new InputSchedule { TactsPerFrame = (long)_frameTacts * ClockMultiplier };
+            _screenLineTime = ScreenConfiguration.ScreenLineTime;
             PhysicalFrameClockCount = Clock.GetFrequency() / (double)BaseClockFrequency * _frameTacts;
             FrameCount = 0;
             Overflow = 0;
@@ -406,6 +460,10 @@ namespace Spect.Net.SpectrumEmu.Machine
             {
                 AttachProvider(SoundProvider);
             }
+            if (AudioMixerProvider != null)
+            {
+                AttachProvider(AudioMixerProvider);
+            }
 
             // --- Collect Spectrum devices
             _spectrumDevices.Add(RomDevice);
@@ -424,6 +482,9 @@ namespace Spect.Net.SpectrumEmu.Machine
             if (DivIdeDevice != null) _spectrumDevices.Add(DivIdeDevice);
             if (FloppyDevice != null) _spectrumDevices.Add(FloppyDevice);
 
+            // --- The mixer must complete the frame after the audio sources
+            if (AudioMixerDevice != null) _spectrumDevices.Add(AudioMixerDevice);
+
             // --- Now, prepare devices to find each other
             foreach (var device in _spectrumDevices)
             {
@@ -496,6 +557,7 @@ namespace Spect.Net.SpectrumEmu.Machine
             Cpu.Reset();
             Cpu.ReleaseResetSignal();
             RunsInMaskableInterrupt = false;
+            InputSchedule.Clear();
             foreach (var device in _spectrumDevices)
             {
                 device.Reset();
@@ -543,6 +605,15 @@ namespace Spect.Net.SpectrumEmu.Machine
 
         public event EventHandler FrameCompleted;
 
+        /// <summary>
+        /// Signs that the screen memory or the border color is about to change
+        /// </summary>
+        public void OnScreenChanging()
+        {
+            if (!_turboRendering) return;
+            RenderScreenUntil((int)(_instructionStartTacts - LastFrameStartCpuTick) >> _clockShift);
+        }
+
         /// <summary>
         /// Resets the ULA tact to start screen rendering from the beginning
         /// </summary>
@@ -570,6 +641,7 @@ namespace Spect.Net.SpectrumEmu.Machine
         {
             ExecuteCycleOptions = options;
             ExecutionCompletionReason = ExecutionCompletionReason.None;
+            _turboRendering = options.TurboMode;
             LastExecutionStartTact = Cpu.Tacts;
             LastExecutionContentionValue = ContentionAccumulated;
 
@@ -582,6 +654,10 @@ namespace Spect.Net.SpectrumEmu.Machine
             var executedInstructionCount = -1;
             var entryStepOutDepth = Cpu.StackDebugSupport.StepOutStackDepth;
 
+            // --- Watch expressions are evaluated at frame boundaries or at a tact interval
+            var watchEngine = WatchEngine;
+            var inputSchedule = InputSchedule;
+
             // --- Loop #1: The main cycle that goes on until cancelled
             while (!token.IsCancellationRequested)
             {
@@ -594,9 +670,13 @@ namespace Spect.Net.SpectrumEmu.Machine
                     // --- Notify devices to start a new frame
                     OnNewFrame();
                     LastRenderedUlaTact = Overflow;
+                    _nextRenderTact = 0;
                     _frameCompleted = false;
                 }
 
+                // --- The frame tact is calculated once per instruction slice
+                var frameTact = CurrentFrameTact;
+
                 // --- Loop #2: The physical frame cycle that goes on while CPU and ULA 
                 // --- processes everything within a physical frame (0.019968 second)
                 while (!_frameCompleted)
@@ -604,7 +684,7 @@ namespace Spect.Net.SpectrumEmu.Machine
                     // --- Check for leaving maskable interrupt mode
                     if (RunsInMaskableInterrupt)
                     {
-                        if (Cpu.Registers.PC == 0x0052)
+                        if (Cpu.PC == 0x0052)
                         {
                             // --- We leave the maskable interrupt mode when the
                             // --- current instruction completes
@@ -618,6 +698,7 @@ namespace Spect.Net.SpectrumEmu.Machine
                         // --- Check for cancellation
                         if (token.IsCancellationRequested)
                         {
+                            RenderScreenUntil(CurrentFrameTact);
                             ExecutionCompletionReason = ExecutionCompletionReason.Cancelled;
                             return false;
                         }
@@ -629,6 +710,7 @@ namespace Spect.Net.SpectrumEmu.Machine
                         if (options.TimeoutTacts > 0 
                             && cycleStartTact + options.TimeoutTacts < Cpu.Tacts)
                         {
+                            RenderScreenUntil(CurrentFrameTact);
                             ExecutionCompletionReason = ExecutionCompletionReason.Timeout;
                             return false;
                         }
@@ -640,16 +722,18 @@ namespace Spect.Net.SpectrumEmu.Machine
                             {
                                 // --- ROM & address must match
                                 if (options.TerminationRom == MemoryDevice.GetSelectedRomIndex()
-                                    && options.TerminationPoint == Cpu.Registers.PC)
+                                    && options.TerminationPoint == Cpu.PC)
                                 {
                                     // --- We reached the termination point within ROM
+                                    RenderScreenUntil(CurrentFrameTact);
                                     ExecutionCompletionReason = ExecutionCompletionReason.TerminationPointReached;
                                     return true;
                                 }
                             }
-                            else if (options.TerminationPoint == Cpu.Registers.PC)
+                            else if (options.TerminationPoint == Cpu.PC)
                             {
                                 // --- We reached the termination point within RAM
+                                RenderScreenUntil(CurrentFrameTact);
                                 ExecutionCompletionReason = ExecutionCompletionReason.TerminationPointReached;
                                 return true;
                             }
@@ -669,6 +753,7 @@ namespace Spect.Net.SpectrumEmu.Machine
                             {
                                 // --- At this point, the cycle should be stopped because of debugging reasons
                                 // --- The screen should be refreshed
+                                RenderScreenUntil(frameTact);
                                 ScreenDevice.OnFrameCompleted();
                                 ExecutionCompletionReason = ExecutionCompletionReason.BreakpointReached;
                                 return true;
@@ -676,22 +761,33 @@ namespace Spect.Net.SpectrumEmu.Machine
                         }
                     }
 
+                    // --- Apply the scheduled input before the next instruction
+                    if (!Cpu.IsInOpExecution && Cpu.Tacts >= inputSchedule.NextTact)
+                    {
+                        inputSchedule.ApplyDueEvents(Cpu.Tacts, KeyboardDevice, KempstonDevice);
+                    }
+
                     // --- Check for interrupt signal generation
-                    InterruptDevice.CheckForInterrupt(CurrentFrameTact);
+                    InterruptDevice.CheckForInterrupt(frameTact);
 
                     // --- Run a single Z80 instruction
+                    _instructionStartTacts = Cpu.Tacts;
                     Cpu.ExecuteCpuCycle();
                     _lastBreakpoint = null;
 
-                    // --- Run a rendering cycle according to the current CPU tact count
+                    // --- Run a rendering cycle according to the current CPU tact count.
+                    // --- In turbo mode, we render only when a scanline has been completed.
                     var lastTact = CurrentFrameTact;
-                    ScreenDevice.RenderScreen(LastRenderedUlaTact + 1, lastTact);
-                    LastRenderedUlaTact = lastTact;
+                    if (!options.TurboMode || lastTact >= _nextRenderTact)
+                    {
+                        RenderScreenUntil(lastTact);
+                    }
 
                     // --- Exit if the emulation mode specifies so
                     if (options.EmulationMode == EmulationMode.UntilHalt 
                         && (Cpu.StateFlags & Z80StateFlags.Halted) != 0)
                     {
+                        RenderScreenUntil(CurrentFrameTact);
                         ExecutionCompletionReason = ExecutionCompletionReason.Halted;
                         return true;
                     }
@@ -702,17 +798,30 @@ namespace Spect.Net.SpectrumEmu.Machine
                         device.OnCpuOperationCompleted();
                     }
 
+                    // --- Evaluate the watch expressions when the tact interval has elapsed
+                    if (watchEngine != null && !Cpu.IsInOpExecution
+                        && Cpu.Tacts >= watchEngine.NextEvaluationTact)
+                    {
+                        watchEngine.Evaluate(Cpu.Tacts);
+                    }
+
                     // --- Decide whether this frame has been completed
-                    _frameCompleted = !Cpu.IsInOpExecution && CurrentFrameTact >= _frameTacts;
+                    frameTact = CurrentFrameTact;
+                    _frameCompleted = !Cpu.IsInOpExecution && frameTact >= _frameTacts;
 
                 } // -- End Loop #2
 
+                // --- Render the rest of a scanline batched in turbo mode
+                RenderScreenUntil(frameTact);
+
                 // --- A physical frame has just been completed. Take care about screen refresh
                 cycleFrameCount++;
                 FrameCount++;
 
                 // --- Notify devices that the current frame completed
                 OnFrameCompleted();
+                watchEngine?.OnFrameCompleted(Cpu.Tacts);
+                FrameRecorder?.OnFrameCompleted();
 
                 // --- Exit if the emulation mode specifies so
                 if (options.EmulationMode == EmulationMode.UntilFrameEnds)
@@ -729,7 +838,7 @@ namespace Spect.Net.SpectrumEmu.Machine
                 }
 
                 // --- Start a new frame and carry on
-                Overflow = CurrentFrameTact % _frameTacts;
+                Overflow = frameTact % _frameTacts;
 
             } // --- End Loop #1
 
@@ -738,6 +847,20 @@ namespace Spect.Net.SpectrumEmu.Machine
             return false;
         }
 
+        /// <summary>
+        /// Renders the screen from the last rendered tact up to the specified one,
+        /// and sets the next scanline boundary for turbo mode rendering
+        /// </summary>
+        /// <param name="tact">Last frame tact to render</param>
+        private void RenderScreenUntil(int tact)
+        {
+            if (tact <= LastRenderedUlaTact) return;
+
+            ScreenDevice.RenderScreen(LastRenderedUlaTact + 1, tact);
+            LastRenderedUlaTact = tact;
+            _nextRenderTact = (tact / _screenLineTime + 1) * _screenLineTime;
+        }
+
         /// <summary>
         /// Checks whether the execution cycle should be stopped for debugging
         /// </summary>
@@ -771,15 +894,15 @@ namespace Spect.Net.SpectrumEmu.Machine
             // --- In Stop-At-Breakpoint mode we stop only if a predefined
             // --- breakpoint is reached
             if (options.DebugStepMode == DebugStepMode.StopAtBreakpoint
-                && DebugInfoProvider.ShouldBreakAtAddress(Cpu.Registers.PC))
+                && DebugInfoProvider.ShouldBreakAtAddress(Cpu.PC))
             {
                 if (executedInstructionCount > 0
                     || _lastBreakpoint == null
-                    || _lastBreakpoint != Cpu.Registers.PC)
+                    || _lastBreakpoint != Cpu.PC)
                 {
                     // --- If we are paused at a breakpoint, we do not want
                     // --- to pause again and again, unless we step through
-                    _lastBreakpoint = Cpu.Registers.PC;
+                    _lastBreakpoint = Cpu.PC;
                     return true;
                 }
             }
@@ -791,7 +914,7 @@ namespace Spect.Net.SpectrumEmu.Machine
                 {
                     // --- We also stop, if an imminent breakpoint is reached, and also remove
                     // --- this breakpoint
-                    if (DebugInfoProvider.ImminentBreakpoint == Cpu.Registers.PC)
+                    if (DebugInfoProvider.ImminentBreakpoint == Cpu.PC)
                     {
                         DebugInfoProvider.ImminentBreakpoint = null;
                         return true;
@@ -806,7 +929,7 @@ namespace Spect.Net.SpectrumEmu.Machine
                     if (length > 0)
                     {
                         // --- Its a CALL-like instruction, create an imminent breakpoint
-                        DebugInfoProvider.ImminentBreakpoint = (ushort)(Cpu.Registers.PC + length);
+                        DebugInfoProvider.ImminentBreakpoint = (ushort)(Cpu.PC + length);
                         imminentJustCreated = true;
                     }
 
@@ -825,7 +948,7 @@ namespace Spect.Net.SpectrumEmu.Machine
                     && executedInstructionCount > 0 
                     && entryStepOutStackDepth == Cpu.StackDebugSupport.StepOutStackDepth + 1)
                 {
-                    if (Cpu.Registers.PC != Cpu.StackDebugSupport.StepOutAddress)
+                    if (Cpu.PC != Cpu.StackDebugSupport.StepOutAddress)
                     {
                         Cpu.StackDebugSupport.ClearStepOutStack();
                     }
@@ -850,7 +973,7 @@ namespace Spect.Net.SpectrumEmu.Machine
                 // --- We always stop at imminent breakpoints
                 return true;
             }
-            if (!DebugInfoProvider.Breakpoints.TryGetValue(Cpu.Registers.PC, out var breakpoint))
+            if (!DebugInfoProvider.Breakpoints.TryGetValue(Cpu.PC, out var breakpoint))
             {
                 // --- No registered breakpoint, no stop
                 return false;
@@ -1023,11 +1146,7 @@ namespace Spect.Net.SpectrumEmu.Machine
         {
             var state = JObject.Parse(json);
             var storedModelName = state[nameof(Spectrum48DeviceState.ModelName)].ToString();
-            if (storedModelName != modelName)
-            {
-                throw new InvalidVmStateException(
-                $"The stored model ({storedModelName}) is not compatible with the current virtual machine model ({modelName})");
-            }
+            CheckStoredModel(storedModelName, modelName);
 
             // --- Read main device elements
             // ReSharper disable once UseObjectOrCollectionInitializer
@@ -1061,6 +1180,42 @@ namespace Spect.Net.SpectrumEmu.Machine
             spState.RestoreDeviceState(this);
         }
 
+        /// <summary>
+        /// Takes an in-memory snapshot of the virtual machine's state
+        /// </summary>
+        /// <param name="modelName">Current virtual machine model name</param>
+        /// <returns>The snapshot of the VM's state</returns>
+        public VmStateSnapshot CreateSnapshot(string modelName)
+        {
+            // --- The device states may share arrays with the devices
+            var state = StateCloner.DeepClone(new Spectrum48DeviceState(this, modelName));
+            return new VmStateSnapshot(modelName, state);
+        }
+
+        /// <summary>
+        /// Restores the virtual machine's state from the specified snapshot
+        /// </summary>
+        /// <param name="snapshot">Snapshot to restore</param>
+        /// <param name="modelName">Current virtual machine model name</param>
+        public void RestoreSnapshot(VmStateSnapshot snapshot, string modelName)
+        {
+            if (snapshot == null) throw new ArgumentNullException(nameof(snapshot));
+            CheckStoredModel(snapshot.ModelName, modelName);
+            snapshot.GetStateCopy().RestoreDeviceState(this);
+        }
+
+        /// <summary>
+        /// Checks if the stored state can be restored into the current model
+        /// </summary>
+        private static void CheckStoredModel(string storedModelName, string modelName)
+        {
+            if (storedModelName != modelName)
+            {
+                throw new InvalidVmStateException(
+                $"The stored model ({storedModelName}) is not compatible with the current virtual machine model ({modelName})");
+            }
+        }
+
         /// <summary>
         /// Gets the device state from the deserialized JSON state
         /// </summary>
@@ -40,7 +40,7 @@ namespace Spect.Net.SpectrumEmu.Machine
         public ExpressionValue GetZ80RegisterValue(string registerName, out bool is8Bit)
         {
             is8Bit = true;
-            var regs = SpectrumVm.Cpu.Registers;
+            ref var regs = ref SpectrumVm.Cpu.Registers;
             switch (registerName.ToLower())
             {
                 case "a":
@@ -126,7 +126,7 @@ namespace Spect.Net.SpectrumEmu.Machine
         /// <returns>Z80 register value</returns>
         public ExpressionValue GetZ80FlagValue(string flagName)
         {
-            var regs = SpectrumVm.Cpu.Registers;
+            ref var regs = ref SpectrumVm.Cpu.Registers;
             switch (flagName.Substring(1).ToLower())
             {
                 case "z":
@@ -13,6 +13,7 @@ using Spect.Net.SpectrumEmu.Devices.Memory;
 using Spect.Net.SpectrumEmu.Devices.Next;
 using Spect.Net.SpectrumEmu.Devices.Ports;
 using Spect.Net.SpectrumEmu.Devices.Rom;
+using Spect.Net.SpectrumEmu.Devices.Sound;
 using Spect.Net.SpectrumEmu.Providers;
 using Spect.Net.SpectrumEmu.Scripting;
 
@@ -191,6 +192,13 @@ namespace Spect.Net.SpectrumEmu.Machine
                     break;
             }
 
+            // --- Mix the audio sources into a single stream, provided there is a mixer provider
+            var mixerProvider = GetProvider<IAudioMixerProvider>();
+            if (mixerProvider != null)
+            {
+                devices.Add(new AudioMixerDeviceInfo(mixerProvider, new AudioMixerDevice()));
+            }
+
             // --- Setup the machine
             var machine = new SpectrumMachine
             {
@@ -382,6 +390,11 @@ namespace Spect.Net.SpectrumEmu.Machine
         {
             var oldState = VmState;
             VmState = newState;
+            if (newState == VmState.Paused || newState == VmState.Stopped)
+            {
+                // --- The disk images are up to date while the machine does not run
+                SpectrumVm?.FloppyDevice?.Flush();
+            }
             VmStateChanged?.Invoke(this, new VmStateChangedEventArgs(oldState, newState));
         }
 
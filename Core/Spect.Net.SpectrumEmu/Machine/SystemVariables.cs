@@ -16,7 +16,6 @@ namespace Spect.Net.SpectrumEmu.Machine
             new SystemVariableInfo("LAST_K", 0x5C08, 1, "Stores newly pressed key"),
             new SystemVariableInfo("REPDEL", 0x5C09, 1, "Time that a key must be held down before it repeats: initially 35"),
             new SystemVariableInfo("REPPER", 0x5C0A, 1, "Delay between successive repeats of a key held down: initially 5"),
-            new SystemVariableInfo("REPPER", 0x5C0A, 1, "Delay between successive repeats of a key held down: initially 5"),
             new SystemVariableInfo("DEFADD", 0x5C0B, 2, "Address of arguments of user defined function if one is being evaluated; otherwise 0"),
             new SystemVariableInfo("K_DATA", 0x5C0D, 1, "Stores 2nd byte of colur controls entered from keyboard"),
             new SystemVariableInfo("TVDATA", 0x5C0E, 2, "Stores bytes of color, AT and TAB controls going to television"),
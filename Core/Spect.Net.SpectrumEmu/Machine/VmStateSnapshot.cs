@@ -0,0 +1,40 @@
+﻿using Spect.Net.SpectrumEmu.Abstraction.Devices;
+using Spect.Net.SpectrumEmu.Utility;
+
+namespace Spect.Net.SpectrumEmu.Machine
+{
+    /// <summary>
+    /// This class stores the state of a virtual machine in memory, so that
+    /// the state can be restored any number of times without parsing JSON.
+    /// </summary>
+    /// <remarks>
+    /// The snapshot keeps its own copy of the device states. Each restore
+    /// hands a new copy to the machine, so the machine never modifies the
+    /// snapshot.
+    /// </remarks>
+    public class VmStateSnapshot
+    {
+        private readonly IDeviceState _state;
+
+        /// <summary>
+        /// The model the state has been taken from
+        /// </summary>
+        public string ModelName { get; }
+
+        /// <summary>
+        /// Creates a snapshot from the specified state
+        /// </summary>
+        /// <param name="modelName">Model the state has been taken from</param>
+        /// <param name="state">Machine state, owned by the snapshot from now on</param>
+        internal VmStateSnapshot(string modelName, IDeviceState state)
+        {
+            ModelName = modelName;
+            _state = state;
+        }
+
+        /// <summary>
+        /// Gets a copy of the stored state
+        /// </summary>
+        internal IDeviceState GetStateCopy() => StateCloner.DeepClone(_state);
+    }
+}
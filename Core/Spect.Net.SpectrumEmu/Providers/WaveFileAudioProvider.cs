@@ -0,0 +1,228 @@
+﻿using System;
+using System.IO;
+using System.Text;
+using Spect.Net.SpectrumEmu.Abstraction.Devices;
+using Spect.Net.SpectrumEmu.Abstraction.Providers;
+
+namespace Spect.Net.SpectrumEmu.Providers
+{
+    /// <summary>
+    /// The format of the files the WaveFileAudioProvider writes
+    /// </summary>
+    public enum AudioFileFormat
+    {
+        /// <summary>
+        /// RIFF WAVE file with 16-bit mono PCM samples
+        /// </summary>
+        Wav,
+
+        /// <summary>
+        /// Raw 16-bit little-endian mono PCM samples without a header
+        /// </summary>
+        RawPcm16
+    }
+
+    /// <summary>
+    /// This headless provider writes the audio samples into a WAV or raw PCM
+    /// stream instead of playing them. It is intended for automated audio
+    /// regression tests.
+    /// </summary>
+    /// <remarks>
+    /// Samples are clamped to the [-1.0, 1.0] range. The WAV header is
+    /// completed when the provider is flushed or disposed, provided the
+    /// stream is seekable.
+    /// </remarks>
+    public class WaveFileAudioProvider: VmComponentProviderBase, IAudioMixerProvider, ISoundProvider, IDisposable
+    {
+        private const int HEADER_LENGTH = 44;
+        private const short BITS_PER_SAMPLE = 16;
+
+        private readonly Stream _stream;
+        private readonly bool _ownsStream;
+        private readonly bool _useSoundConfiguration;
+        private byte[] _byteBuffer = new byte[2048];
+        private bool _headerWritten;
+        private long _headerPosition;
+
+        /// <summary>
+        /// The format of the output
+        /// </summary>
+        public AudioFileFormat Format { get; }
+
+        /// <summary>
+        /// The sample rate written into the WAV header
+        /// </summary>
+        public int SampleRate { get; private set; }
+
+        /// <summary>
+        /// The number of samples written
+        /// </summary>
+        public long SamplesWritten { get; private set; }
+
+        /// <summary>
+        /// Creates a provider that writes into the specified stream
+        /// </summary>
+        /// <param name="stream">Output stream</param>
+        /// <param name="format">Output format</param>
+        /// <param name="useSoundConfiguration">
+        /// True: use the PSG configuration for the sample rate;
+        /// False: use the beeper configuration
+        /// </param>
+        /// <param name="ownsStream">Should the provider dispose the stream?</param>
+        public WaveFileAudioProvider(Stream stream, AudioFileFormat format = AudioFileFormat.Wav, 
+            bool useSoundConfiguration = false, bool ownsStream = false)
+        {
+            _stream = stream ?? throw new ArgumentNullException(nameof(stream));
+            Format = format;
+            _useSoundConfiguration = useSoundConfiguration;
+            _ownsStream = ownsStream;
+        }
+
+        /// <summary>
+        /// Creates a provider that writes into the specified file
+        /// </summary>
+        /// <param name="fileName">Output file name</param>
+        /// <param name="format">Output format</param>
+        /// <param name="useSoundConfiguration">
+        /// True: use the PSG configuration for the sample rate;
+        /// False: use the beeper configuration
+        /// </param>
+        public WaveFileAudioProvider(string fileName, AudioFileFormat format = AudioFileFormat.Wav,
+            bool useSoundConfiguration = false)
+            : this(File.Create(fileName), format, useSoundConfiguration, true)
+        {
+        }
+
+        /// <summary>
+        /// Signs that the provider has been attached to the Spectrum virtual machine
+        /// </summary>
+        public override void OnAttachedToVm(ISpectrumVm hostVm)
+        {
+            base.OnAttachedToVm(hostVm);
+            var config = _useSoundConfiguration
+                ? hostVm.SoundConfiguration
+                : hostVm.AudioConfiguration;
+            SampleRate = config?.AudioSampleRate ?? 0;
+        }
+
+        /// <summary>
+        /// Adds the specified set of samples to the output
+        /// </summary>
+        /// <param name="samples">Array of sound samples</param>
+        public void AddSoundFrame(float[] samples)
+        {
+            if (!_headerWritten)
+            {
+                WriteHeader();
+            }
+            var length = samples.Length * 2;
+            if (_byteBuffer.Length < length)
+            {
+                _byteBuffer = new byte[length];
+            }
+            for (var i = 0; i < samples.Length; i++)
+            {
+                var sample = samples[i];
+                if (sample > 1.0f) sample = 1.0f;
+                else if (sample < -1.0f) sample = -1.0f;
+                var value = (short)(sample * short.MaxValue);
+                _byteBuffer[2 * i] = (byte)value;
+                _byteBuffer[2 * i + 1] = (byte)(value >> 8);
+            }
+            _stream.Write(_byteBuffer, 0, length);
+            SamplesWritten += samples.Length;
+        }
+
+        /// <summary>
+        /// Starts playing the sound (the provider always records)
+        /// </summary>
+        public void PlaySound()
+        {
+        }
+
+        /// <summary>
+        /// Pauses playing the sound (the provider always records)
+        /// </summary>
+        public void PauseSound()
+        {
+        }
+
+        /// <summary>
+        /// Stops playing the sound, and completes the output
+        /// </summary>
+        public void KillSound()
+        {
+            Flush();
+        }
+
+        /// <summary>
+        /// Completes the WAV header and flushes the stream
+        /// </summary>
+        public void Flush()
+        {
+            if (Format == AudioFileFormat.Wav && _stream.CanSeek)
+            {
+                if (!_headerWritten)
+                {
+                    WriteHeader();
+                }
+                var position = _stream.Position;
+                var dataLength = SamplesWritten * 2;
+                WriteInt32At(_headerPosition + 4, (int)(HEADER_LENGTH - 8 + dataLength));
+                WriteInt32At(_headerPosition + HEADER_LENGTH - 4, (int)dataLength);
+                _stream.Position = position;
+            }
+            _stream.Flush();
+        }
+
+        /// <summary>
+        /// Completes the output, and releases the stream if the provider owns it
+        /// </summary>
+        public void Dispose()
+        {
+            Flush();
+            if (_ownsStream)
+            {
+                _stream.Dispose();
+            }
+        }
+
+        /// <summary>
+        /// Writes the WAV header with zero lengths
+        /// </summary>
+        private void WriteHeader()
+        {
+            _headerWritten = true;
+            if (Format != AudioFileFormat.Wav) return;
+
+            _headerPosition = _stream.CanSeek ? _stream.Position : 0;
+            var writer = new BinaryWriter(_stream, Encoding.ASCII, true);
+            writer.Write(Encoding.ASCII.GetBytes("RIFF"));
+            writer.Write(HEADER_LENGTH - 8);
+            writer.Write(Encoding.ASCII.GetBytes("WAVE"));
+            writer.Write(Encoding.ASCII.GetBytes("fmt "));
+            writer.Write(16);
+            writer.Write((short)1);
+            writer.Write((short)1);
+            writer.Write(SampleRate);
+            writer.Write(SampleRate * BITS_PER_SAMPLE / 8);
+            writer.Write((short)(BITS_PER_SAMPLE / 8));
+            writer.Write(BITS_PER_SAMPLE);
+            writer.Write(Encoding.ASCII.GetBytes("data"));
+            writer.Write(0);
+            writer.Flush();
+        }
+
+        /// <summary>
+        /// Writes a 32-bit value to the specified stream position
+        /// </summary>
+        private void WriteInt32At(long position, int value)
+        {
+            _stream.Position = position;
+            _stream.WriteByte((byte)value);
+            _stream.WriteByte((byte)(value >> 8));
+            _stream.WriteByte((byte)(value >> 16));
+            _stream.WriteByte((byte)(value >> 24));
+        }
+    }
+}
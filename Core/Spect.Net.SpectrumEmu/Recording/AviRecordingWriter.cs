@@ -0,0 +1,434 @@
+﻿using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Text;
+
+namespace Spect.Net.SpectrumEmu.Recording
+{
+    /// <summary>
+    /// This writer creates uncompressed AVI files with 8-bit palettized video
+    /// and 16-bit mono PCM audio.
+    /// </summary>
+    /// <remarks>
+    /// A single AVI file (RIFF) cannot be larger than 2 GB, so long recordings
+    /// continue in new segment files after MaxSegmentSize bytes. Dropped frames
+    /// are written as empty video chunks (players repeat the previous frame)
+    /// with silence, so audio and video stay in sync.
+    /// </remarks>
+    public class AviRecordingWriter : IFrameRecordingWriter
+    {
+        /// <summary>
+        /// The default maximum size of a segment file
+        /// </summary>
+        public const long DEFAULT_SEGMENT_SIZE = 1L << 30;
+
+        private const int AVIF_HASINDEX = 0x10;
+        private const int AVIF_ISINTERLEAVED = 0x100;
+        private const int AVIIF_KEYFRAME = 0x10;
+        private const int PALETTE_SIZE = 256;
+        private const int MAIN_HEADER_SIZE = 56;
+        private const int STREAM_HEADER_SIZE = 56;
+        private const int BITMAP_HEADER_SIZE = 40;
+        private const int WAVE_FORMAT_SIZE = 18;
+        private const int INDEX_ENTRY_SIZE = 16;
+
+        private static readonly int s_VideoChunkId = FourCc("00db");
+        private static readonly int s_AudioChunkId = FourCc("01wb");
+
+        private readonly Func<int, Stream> _createSegment;
+        private readonly List<IndexEntry> _index = new List<IndexEntry>();
+        private RecordingFormat _format;
+        private Stream _stream;
+        private BinaryWriter _writer;
+        private int _segmentIndex;
+        private int _stride;
+        private byte[] _frameBuffer;
+        private byte[] _audioBuffer = new byte[4096];
+        private long _nextFrameNumber;
+        private double _samplesPerFrame;
+        private double _silenceDebt;
+
+        // --- Positions of the values completed at the end of the segment
+        private long _moviListPosition;
+        private long _totalFramesPosition;
+        private long _videoLengthPosition;
+        private long _audioLengthPosition;
+        private int _segmentFrames;
+        private int _segmentSamples;
+
+        /// <summary>
+        /// The maximum size of a segment file
+        /// </summary>
+        public long MaxSegmentSize { get; set; } = DEFAULT_SEGMENT_SIZE;
+
+        /// <summary>
+        /// Number of segment files created
+        /// </summary>
+        public int SegmentCount => _segmentIndex;
+
+        /// <summary>
+        /// Creates a writer that obtains the segment streams from the specified function
+        /// </summary>
+        /// <param name="createSegment">
+        /// Creates the stream of the segment with the specified index. The writer
+        /// disposes the stream when the segment is complete. The stream must be seekable.
+        /// </param>
+        public AviRecordingWriter(Func<int, Stream> createSegment)
+        {
+            _createSegment = createSegment ?? throw new ArgumentNullException(nameof(createSegment));
+        }
+
+        /// <summary>
+        /// Creates a writer for the specified file. Segments after the first one
+        /// get a numeric suffix (e.g. "game_001.avi").
+        /// </summary>
+        /// <param name="fileName">Output file name</param>
+        public AviRecordingWriter(string fileName)
+            : this(segment => File.Create(GetSegmentFileName(fileName, segment)))
+        {
+        }
+
+        /// <summary>
+        /// Gets the file name of the specified segment
+        /// </summary>
+        /// <param name="fileName">File name of the first segment</param>
+        /// <param name="segment">Segment index</param>
+        public static string GetSegmentFileName(string fileName, int segment)
+        {
+            if (segment == 0) return fileName;
+            var folder = Path.GetDirectoryName(fileName) ?? "";
+            var name = Path.GetFileNameWithoutExtension(fileName);
+            return Path.Combine(folder, $"{name}_{segment:D3}{Path.GetExtension(fileName)}");
+        }
+
+        /// <summary>
+        /// Starts the output with the specified format
+        /// </summary>
+        /// <param name="format">Recording format</param>
+        public void Begin(RecordingFormat format)
+        {
+            _format = format;
+            _stride = (format.Width + 3) & ~3;
+            _frameBuffer = new byte[_stride * format.Height];
+            _samplesPerFrame = format.FrameRate > 0
+                ? (double)(format.AudioSampleRate / format.FrameRate)
+                : 0.0;
+            _nextFrameNumber = 0;
+            _silenceDebt = 0.0;
+            _segmentIndex = 0;
+            StartSegment();
+        }
+
+        /// <summary>
+        /// Writes the specified frame
+        /// </summary>
+        /// <param name="frame">Frame to write</param>
+        public void WriteFrame(RecordedFrame frame)
+        {
+            // --- Fill in the frames dropped by the recorder
+            while (_nextFrameNumber < frame.FrameNumber)
+            {
+                WriteChunk(s_VideoChunkId, _frameBuffer, 0);
+                _segmentFrames++;
+                _silenceDebt += _samplesPerFrame;
+                var silence = (int)_silenceDebt;
+                _silenceDebt -= silence;
+                WriteAudio(null, silence);
+                _nextFrameNumber++;
+            }
+
+            // --- DIB rows are stored bottom-up
+            var height = _format.Height;
+            var width = _format.Width;
+            for (var y = 0; y < height; y++)
+            {
+                Buffer.BlockCopy(frame.Pixels, y * width, _frameBuffer, (height - 1 - y) * _stride, width);
+            }
+            WriteChunk(s_VideoChunkId, _frameBuffer, _frameBuffer.Length);
+            _segmentFrames++;
+            WriteAudio(frame.AudioSamples, frame.AudioSampleCount);
+            _nextFrameNumber = frame.FrameNumber + 1;
+
+            if (_stream.Position >= MaxSegmentSize)
+            {
+                EndSegment();
+                StartSegment();
+            }
+        }
+
+        /// <summary>
+        /// Completes the output
+        /// </summary>
+        public void End()
+        {
+            if (_stream == null) return;
+            EndSegment();
+        }
+
+        /// <summary>
+        /// Writes the audio samples as 16-bit PCM
+        /// </summary>
+        private void WriteAudio(float[] samples, int count)
+        {
+            if (_format.AudioSampleRate == 0 || count <= 0) return;
+            var length = count * 2;
+            if (_audioBuffer.Length < length)
+            {
+                _audioBuffer = new byte[length];
+            }
+            if (samples == null)
+            {
+                Array.Clear(_audioBuffer, 0, length);
+            }
+            else
+            {
+                for (var i = 0; i < count; i++)
+                {
+                    var sample = samples[i];
+                    if (sample > 1.0f) sample = 1.0f;
+                    else if (sample < -1.0f) sample = -1.0f;
+                    var value = (short)(sample * short.MaxValue);
+                    _audioBuffer[2 * i] = (byte)value;
+                    _audioBuffer[2 * i + 1] = (byte)(value >> 8);
+                }
+            }
+            WriteChunk(s_AudioChunkId, _audioBuffer, length);
+            _segmentSamples += count;
+        }
+
+        /// <summary>
+        /// Writes a data chunk into the movi list, and adds it to the index
+        /// </summary>
+        private void WriteChunk(int chunkId, byte[] data, int length)
+        {
+            _index.Add(new IndexEntry
+            {
+                ChunkId = chunkId,
+                Offset = (int)(_stream.Position - _moviListPosition - 8),
+                Size = length
+            });
+            _writer.Write(chunkId);
+            _writer.Write(length);
+            _writer.Write(data, 0, length);
+            if ((length & 1) != 0)
+            {
+                _writer.Write((byte)0);
+            }
+        }
+
+        /// <summary>
+        /// Creates a new segment file and writes its headers
+        /// </summary>
+        private void StartSegment()
+        {
+            _stream = _createSegment(_segmentIndex++);
+            _writer = new BinaryWriter(_stream, Encoding.ASCII, true);
+            _index.Clear();
+            _segmentFrames = 0;
+            _segmentSamples = 0;
+
+            var hasAudio = _format.AudioSampleRate > 0;
+            var rate = (int)Math.Round(_format.FrameRate * 1000);
+            var frameSize = _frameBuffer.Length;
+
+            // --- RIFF header, the size is completed at the end
+            WriteFourCc("RIFF");
+            _writer.Write(0);
+            WriteFourCc("AVI ");
+
+            // --- Header list
+            var hdrlPosition = StartList("hdrl");
+            WriteFourCc("avih");
+            _writer.Write(MAIN_HEADER_SIZE);
+            _writer.Write(rate > 0 ? (int)(1_000_000_000L / rate) : 0);
+            _writer.Write(rate > 0 ? (int)((long)frameSize * rate / 1000) : 0);
+            _writer.Write(0);
+            _writer.Write(AVIF_HASINDEX | AVIF_ISINTERLEAVED);
+            _totalFramesPosition = _stream.Position;
+            _writer.Write(0);
+            _writer.Write(0);
+            _writer.Write(hasAudio ? 2 : 1);
+            _writer.Write(frameSize);
+            _writer.Write(_format.Width);
+            _writer.Write(_format.Height);
+            _writer.Write(new byte[16]);
+
+            // --- Video stream
+            var strlPosition = StartList("strl");
+            WriteFourCc("strh");
+            _writer.Write(STREAM_HEADER_SIZE);
+            WriteFourCc("vids");
+            WriteFourCc("DIB ");
+            _writer.Write(0);
+            _writer.Write(0);
+            _writer.Write(0);
+            _writer.Write(1000);
+            _writer.Write(rate);
+            _writer.Write(0);
+            _videoLengthPosition = _stream.Position;
+            _writer.Write(0);
+            _writer.Write(frameSize);
+            _writer.Write(-1);
+            _writer.Write(0);
+            _writer.Write((short)0);
+            _writer.Write((short)0);
+            _writer.Write((short)_format.Width);
+            _writer.Write((short)_format.Height);
+
+            WriteFourCc("strf");
+            _writer.Write(BITMAP_HEADER_SIZE + PALETTE_SIZE * 4);
+            _writer.Write(BITMAP_HEADER_SIZE);
+            _writer.Write(_format.Width);
+            _writer.Write(_format.Height);
+            _writer.Write((short)1);
+            _writer.Write((short)8);
+            _writer.Write(0);
+            _writer.Write(frameSize);
+            _writer.Write(0);
+            _writer.Write(0);
+            _writer.Write(PALETTE_SIZE);
+            _writer.Write(0);
+            for (var i = 0; i < PALETTE_SIZE; i++)
+            {
+                // --- RGBQUAD: blue, green, red, reserved
+                var color = _format.Palette != null && i < _format.Palette.Count ? _format.Palette[i] : 0;
+                _writer.Write((byte)color);
+                _writer.Write((byte)(color >> 8));
+                _writer.Write((byte)(color >> 16));
+                _writer.Write((byte)0);
+            }
+            EndList(strlPosition);
+
+            // --- Audio stream
+            if (hasAudio)
+            {
+                strlPosition = StartList("strl");
+                WriteFourCc("strh");
+                _writer.Write(STREAM_HEADER_SIZE);
+                WriteFourCc("auds");
+                _writer.Write(0);
+                _writer.Write(0);
+                _writer.Write(0);
+                _writer.Write(0);
+                _writer.Write(1);
+                _writer.Write(_format.AudioSampleRate);
+                _writer.Write(0);
+                _audioLengthPosition = _stream.Position;
+                _writer.Write(0);
+                _writer.Write(_format.AudioSampleRate * 2);
+                _writer.Write(-1);
+                _writer.Write(2);
+                _writer.Write(0L);
+
+                WriteFourCc("strf");
+                _writer.Write(WAVE_FORMAT_SIZE);
+                _writer.Write((short)1);
+                _writer.Write((short)1);
+                _writer.Write(_format.AudioSampleRate);
+                _writer.Write(_format.AudioSampleRate * 2);
+                _writer.Write((short)2);
+                _writer.Write((short)16);
+                _writer.Write((short)0);
+                EndList(strlPosition);
+            }
+            EndList(hdrlPosition);
+
+            // --- Data list, the size is completed at the end
+            _moviListPosition = StartList("movi");
+        }
+
+        /// <summary>
+        /// Writes the index, completes the sizes and lengths, and closes the segment
+        /// </summary>
+        private void EndSegment()
+        {
+            EndList(_moviListPosition);
+
+            // --- Index
+            WriteFourCc("idx1");
+            _writer.Write(_index.Count * INDEX_ENTRY_SIZE);
+            foreach (var entry in _index)
+            {
+                _writer.Write(entry.ChunkId);
+                _writer.Write(entry.ChunkId == s_VideoChunkId && entry.Size > 0 ? AVIIF_KEYFRAME : 0);
+                _writer.Write(entry.Offset);
+                _writer.Write(entry.Size);
+            }
+            _writer.Flush();
+
+            // --- Complete the sizes and the lengths
+            var end = _stream.Position;
+            WriteInt32At(4, (int)(end - 8));
+            WriteInt32At(_totalFramesPosition, _segmentFrames);
+            WriteInt32At(_videoLengthPosition, _segmentFrames);
+            if (_format.AudioSampleRate > 0)
+            {
+                WriteInt32At(_audioLengthPosition, _segmentSamples);
+            }
+            _stream.Position = end;
+            _stream.Flush();
+            _writer.Dispose();
+            _stream.Dispose();
+            _writer = null;
+            _stream = null;
+        }
+
+        /// <summary>
+        /// Starts a LIST chunk
+        /// </summary>
+        /// <returns>The position of the list</returns>
+        private long StartList(string listType)
+        {
+            var position = _stream.Position;
+            WriteFourCc("LIST");
+            _writer.Write(0);
+            WriteFourCc(listType);
+            return position;
+        }
+
+        /// <summary>
+        /// Completes the size of the LIST chunk at the specified position
+        /// </summary>
+        private void EndList(long position)
+        {
+            _writer.Flush();
+            var end = _stream.Position;
+            WriteInt32At(position + 4, (int)(end - position - 8));
+            _stream.Position = end;
+        }
+
+        /// <summary>
+        /// Writes a four-character code
+        /// </summary>
+        private void WriteFourCc(string code) => _writer.Write(FourCc(code));
+
+        /// <summary>
+        /// Writes a 32-bit value to the specified stream position
+        /// </summary>
+        private void WriteInt32At(long position, int value)
+        {
+            _writer.Flush();
+            _stream.Position = position;
+            _stream.WriteByte((byte)value);
+            _stream.WriteByte((byte)(value >> 8));
+            _stream.WriteByte((byte)(value >> 16));
+            _stream.WriteByte((byte)(value >> 24));
+        }
+
+        /// <summary>
+        /// Converts a four-character code into its 32-bit value
+        /// </summary>
+        private static int FourCc(string code)
+            => code[0] | code[1] << 8 | code[2] << 16 | code[3] << 24;
+
+        /// <summary>
+        /// An entry of the idx1 chunk
+        /// </summary>
+        private struct IndexEntry
+        {
+            public int ChunkId;
+            public int Offset;
+            public int Size;
+        }
+    }
+}
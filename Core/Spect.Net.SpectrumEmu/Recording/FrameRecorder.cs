@@ -0,0 +1,238 @@
+﻿using System;
+using System.Collections.Concurrent;
+using System.Threading;
+using Spect.Net.SpectrumEmu.Abstraction.Devices;
+using Spect.Net.SpectrumEmu.Devices.Screen;
+
+namespace Spect.Net.SpectrumEmu.Recording
+{
+    /// <summary>
+    /// This class records the screen and the audio of the Spectrum VM. Frames
+    /// are captured on the emulation thread and written on a background thread.
+    /// </summary>
+    /// <remarks>
+    /// The machine calls OnFrameCompleted at the end of each frame, after the
+    /// audio mixer has completed its samples. The frame is copied into a buffer
+    /// taken from a fixed-size pool, and queued for the writer. The emulation
+    /// thread never waits for the writer: when the pool is empty, the frame is
+    /// dropped and counted. The FrameNumber of the frames lets the writer
+    /// detect the gaps.
+    /// </remarks>
+    public class FrameRecorder : IDisposable
+    {
+        /// <summary>
+        /// The default number of frames that can wait for the writer
+        /// </summary>
+        public const int DEFAULT_QUEUE_LENGTH = 16;
+
+        private readonly IFrameRecordingWriter _writer;
+        private readonly int _queueLength;
+        private readonly ConcurrentQueue<RecordedFrame> _pending = new ConcurrentQueue<RecordedFrame>();
+        private readonly ConcurrentQueue<RecordedFrame> _free = new ConcurrentQueue<RecordedFrame>();
+        private readonly SemaphoreSlim _signal = new SemaphoreSlim(0);
+        private readonly object _captureLock = new object();
+        private ISpectrumVm _vm;
+        private IAudioSamplesDevice _audioSource;
+        private Thread _writerThread;
+        private volatile bool _recording;
+        private volatile bool _stopping;
+        private long _frameCounter;
+        private long _recordedFrames;
+        private long _droppedFrames;
+        private long _writtenFrames;
+
+        /// <summary>
+        /// The format of the current recording
+        /// </summary>
+        public RecordingFormat Format { get; private set; }
+
+        /// <summary>
+        /// Indicates that the recorder captures the frames
+        /// </summary>
+        public bool IsRecording => _recording;
+
+        /// <summary>
+        /// Number of frames queued for the writer
+        /// </summary>
+        public long RecordedFrames => Interlocked.Read(ref _recordedFrames);
+
+        /// <summary>
+        /// Number of frames dropped because the writer fell behind
+        /// </summary>
+        public long DroppedFrames => Interlocked.Read(ref _droppedFrames);
+
+        /// <summary>
+        /// Number of frames written
+        /// </summary>
+        public long WrittenFrames => Interlocked.Read(ref _writtenFrames);
+
+        /// <summary>
+        /// The exception the writer raised. After an error, frames are not written.
+        /// </summary>
+        public Exception WriterError { get; private set; }
+
+        /// <summary>
+        /// Creates a recorder that uses the specified writer
+        /// </summary>
+        /// <param name="writer">Writer that encodes the frames</param>
+        /// <param name="queueLength">Number of frames that can wait for the writer</param>
+        public FrameRecorder(IFrameRecordingWriter writer, int queueLength = DEFAULT_QUEUE_LENGTH)
+        {
+            _writer = writer ?? throw new ArgumentNullException(nameof(writer));
+            _queueLength = queueLength < 1 ? 1 : queueLength;
+        }
+
+        /// <summary>
+        /// Starts recording the specified machine
+        /// </summary>
+        /// <param name="vm">Spectrum virtual machine to record</param>
+        public void Start(ISpectrumVm vm)
+        {
+            if (_recording || _writerThread != null)
+            {
+                throw new InvalidOperationException("The recorder is already running.");
+            }
+            _vm = vm ?? throw new ArgumentNullException(nameof(vm));
+            _audioSource = (IAudioSamplesDevice)vm.AudioMixerDevice ?? vm.BeeperDevice;
+
+            var screen = vm.ScreenConfiguration;
+            var audio = vm.AudioConfiguration;
+            Format = new RecordingFormat(screen.ScreenWidth, screen.ScreenLines,
+                Spectrum48ScreenDevice.SpectrumColors, vm.ScreenDevice.RefreshRate,
+                _audioSource == null ? 0 : audio?.AudioSampleRate ?? 0);
+
+            // --- Prepare the frame pool. Leave room for the overflow samples.
+            while (_pending.TryDequeue(out _)) { }
+            while (_free.TryDequeue(out _)) { }
+            var audioCapacity = (audio?.SamplesPerFrame ?? 0) + 16;
+            for (var i = 0; i < _queueLength; i++)
+            {
+                _free.Enqueue(new RecordedFrame(screen.ScreenWidth * screen.ScreenLines, audioCapacity));
+            }
+            _frameCounter = 0;
+            _recordedFrames = 0;
+            _droppedFrames = 0;
+            _writtenFrames = 0;
+            WriterError = null;
+
+            _writer.Begin(Format);
+            _stopping = false;
+            _writerThread = new Thread(WriterLoop)
+            {
+                IsBackground = true,
+                Name = "Spectrum frame recorder"
+            };
+            _writerThread.Start();
+            _recording = true;
+            vm.FrameRecorder = this;
+        }
+
+        /// <summary>
+        /// Stops recording, writes the queued frames, and completes the output
+        /// </summary>
+        public void Stop()
+        {
+            if (_writerThread == null) return;
+
+            // --- A frame being captured is queued before the lock is taken;
+            // --- no frame is captured after it is released
+            lock (_captureLock)
+            {
+                _recording = false;
+                if (_vm.FrameRecorder == this)
+                {
+                    _vm.FrameRecorder = null;
+                }
+            }
+
+            // --- Let the writer complete the queue
+            _stopping = true;
+            _signal.Release();
+            _writerThread.Join();
+            _writerThread = null;
+            WritePendingFrames();
+            try
+            {
+                _writer.End();
+            }
+            catch (Exception ex)
+            {
+                WriterError = WriterError ?? ex;
+            }
+        }
+
+        /// <summary>
+        /// Captures the current frame. The machine calls this method on the
+        /// emulation thread when a frame has been completed.
+        /// </summary>
+        public void OnFrameCompleted()
+        {
+            lock (_captureLock)
+            {
+                if (!_recording) return;
+                var frameNumber = _frameCounter++;
+                if (!_free.TryDequeue(out var frame))
+                {
+                    // --- The writer fell behind
+                    Interlocked.Increment(ref _droppedFrames);
+                    return;
+                }
+
+                var pixels = _vm.ScreenDevice.GetPixelBuffer();
+                Buffer.BlockCopy(pixels, 0, frame.Pixels, 0, Math.Min(pixels.Length, frame.Pixels.Length));
+                if (_audioSource != null)
+                {
+                    frame.SetAudio(_audioSource.AudioSamples, _audioSource.NextSampleIndex);
+                }
+                frame.FrameNumber = frameNumber;
+                _pending.Enqueue(frame);
+                Interlocked.Increment(ref _recordedFrames);
+                _signal.Release();
+            }
+        }
+
+        /// <summary>
+        /// Stops the recording
+        /// </summary>
+        public void Dispose()
+        {
+            Stop();
+        }
+
+        /// <summary>
+        /// The loop of the background writer thread
+        /// </summary>
+        private void WriterLoop()
+        {
+            while (true)
+            {
+                _signal.Wait();
+                WritePendingFrames();
+                if (_stopping) return;
+            }
+        }
+
+        /// <summary>
+        /// Writes the queued frames and returns them to the pool
+        /// </summary>
+        private void WritePendingFrames()
+        {
+            while (_pending.TryDequeue(out var frame))
+            {
+                if (WriterError == null)
+                {
+                    try
+                    {
+                        _writer.WriteFrame(frame);
+                        Interlocked.Increment(ref _writtenFrames);
+                    }
+                    catch (Exception ex)
+                    {
+                        WriterError = ex;
+                    }
+                }
+                _free.Enqueue(frame);
+            }
+        }
+    }
+}
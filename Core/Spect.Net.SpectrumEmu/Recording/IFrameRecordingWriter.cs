@@ -0,0 +1,27 @@
+﻿namespace Spect.Net.SpectrumEmu.Recording
+{
+    /// <summary>
+    /// This interface represents an object that encodes and writes the
+    /// recorded frames. The FrameRecorder calls its methods from its
+    /// background thread.
+    /// </summary>
+    public interface IFrameRecordingWriter
+    {
+        /// <summary>
+        /// Starts the output with the specified format
+        /// </summary>
+        /// <param name="format">Recording format</param>
+        void Begin(RecordingFormat format);
+
+        /// <summary>
+        /// Writes the specified frame
+        /// </summary>
+        /// <param name="frame">Frame to write</param>
+        void WriteFrame(RecordedFrame frame);
+
+        /// <summary>
+        /// Completes the output
+        /// </summary>
+        void End();
+    }
+}
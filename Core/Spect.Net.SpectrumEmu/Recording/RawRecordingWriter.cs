@@ -0,0 +1,133 @@
+﻿using System;
+using System.IO;
+
+namespace Spect.Net.SpectrumEmu.Recording
+{
+    /// <summary>
+    /// This writer stores the frames as raw palette indexes (one byte per
+    /// pixel, top-down rows) and the audio as raw 16-bit little-endian mono PCM.
+    /// </summary>
+    /// <remarks>
+    /// The output has no headers, so it can be compared byte by byte in
+    /// regression tests, or converted with external tools. Dropped frames are
+    /// written as copies of the previous frame with silence.
+    /// </remarks>
+    public class RawRecordingWriter : IFrameRecordingWriter
+    {
+        private readonly Stream _videoStream;
+        private readonly Stream _audioStream;
+        private readonly bool _ownsStreams;
+        private byte[] _lastPixels;
+        private byte[] _audioBuffer = new byte[4096];
+        private long _nextFrameNumber;
+        private double _samplesPerFrame;
+        private double _silenceDebt;
+
+        /// <summary>
+        /// Number of frames written
+        /// </summary>
+        public long FramesWritten { get; private set; }
+
+        /// <summary>
+        /// Number of audio samples written
+        /// </summary>
+        public long SamplesWritten { get; private set; }
+
+        /// <summary>
+        /// Creates a writer with the specified streams
+        /// </summary>
+        /// <param name="videoStream">Stream for the frames</param>
+        /// <param name="audioStream">Stream for the audio (null: no audio output)</param>
+        /// <param name="ownsStreams">Should the writer dispose the streams?</param>
+        public RawRecordingWriter(Stream videoStream, Stream audioStream = null, bool ownsStreams = false)
+        {
+            _videoStream = videoStream ?? throw new ArgumentNullException(nameof(videoStream));
+            _audioStream = audioStream;
+            _ownsStreams = ownsStreams;
+        }
+
+        /// <summary>
+        /// Starts the output with the specified format
+        /// </summary>
+        /// <param name="format">Recording format</param>
+        public void Begin(RecordingFormat format)
+        {
+            _lastPixels = new byte[format.Width * format.Height];
+            _samplesPerFrame = format.FrameRate > 0
+                ? (double)(format.AudioSampleRate / format.FrameRate)
+                : 0.0;
+            _nextFrameNumber = 0;
+            _silenceDebt = 0.0;
+            FramesWritten = 0;
+            SamplesWritten = 0;
+        }
+
+        /// <summary>
+        /// Writes the specified frame
+        /// </summary>
+        /// <param name="frame">Frame to write</param>
+        public void WriteFrame(RecordedFrame frame)
+        {
+            // --- Fill in the frames dropped by the recorder
+            while (_nextFrameNumber < frame.FrameNumber)
+            {
+                _videoStream.Write(_lastPixels, 0, _lastPixels.Length);
+                FramesWritten++;
+                _silenceDebt += _samplesPerFrame;
+                var silence = (int)_silenceDebt;
+                _silenceDebt -= silence;
+                WriteAudio(null, silence);
+                _nextFrameNumber++;
+            }
+
+            Buffer.BlockCopy(frame.Pixels, 0, _lastPixels, 0, _lastPixels.Length);
+            _videoStream.Write(_lastPixels, 0, _lastPixels.Length);
+            FramesWritten++;
+            WriteAudio(frame.AudioSamples, frame.AudioSampleCount);
+            _nextFrameNumber = frame.FrameNumber + 1;
+        }
+
+        /// <summary>
+        /// Completes the output
+        /// </summary>
+        public void End()
+        {
+            _videoStream.Flush();
+            _audioStream?.Flush();
+            if (!_ownsStreams) return;
+            _videoStream.Dispose();
+            _audioStream?.Dispose();
+        }
+
+        /// <summary>
+        /// Writes the audio samples as 16-bit PCM
+        /// </summary>
+        private void WriteAudio(float[] samples, int count)
+        {
+            if (_audioStream == null || count <= 0) return;
+            var length = count * 2;
+            if (_audioBuffer.Length < length)
+            {
+                _audioBuffer = new byte[length];
+            }
+            if (samples == null)
+            {
+                Array.Clear(_audioBuffer, 0, length);
+            }
+            else
+            {
+                for (var i = 0; i < count; i++)
+                {
+                    var sample = samples[i];
+                    if (sample > 1.0f) sample = 1.0f;
+                    else if (sample < -1.0f) sample = -1.0f;
+                    var value = (short)(sample * short.MaxValue);
+                    _audioBuffer[2 * i] = (byte)value;
+                    _audioBuffer[2 * i + 1] = (byte)(value >> 8);
+                }
+            }
+            _audioStream.Write(_audioBuffer, 0, length);
+            SamplesWritten += count;
+        }
+    }
+}
@@ -0,0 +1,67 @@
+﻿using System;
+
+namespace Spect.Net.SpectrumEmu.Recording
+{
+    /// <summary>
+    /// This class stores the screen and audio of a single frame while it
+    /// waits to be written. Instances are pooled by the FrameRecorder.
+    /// </summary>
+    public class RecordedFrame
+    {
+        /// <summary>
+        /// The screen pixels as palette indexes, one byte per pixel
+        /// </summary>
+        public byte[] Pixels { get; }
+
+        /// <summary>
+        /// The audio samples of the frame
+        /// </summary>
+        public float[] AudioSamples { get; private set; }
+
+        /// <summary>
+        /// The number of valid audio samples
+        /// </summary>
+        public int AudioSampleCount { get; private set; }
+
+        /// <summary>
+        /// The number of the frame since the start of the recording
+        /// </summary>
+        public long FrameNumber { get; set; }
+
+        /// <summary>
+        /// Creates a frame with the specified capacity
+        /// </summary>
+        /// <param name="pixelCount">Number of screen pixels</param>
+        /// <param name="audioCapacity">Initial capacity of the audio buffer</param>
+        public RecordedFrame(int pixelCount, int audioCapacity)
+        {
+            Pixels = new byte[pixelCount];
+            AudioSamples = new float[audioCapacity];
+        }
+
+        /// <summary>
+        /// Copies the audio samples into the frame
+        /// </summary>
+        /// <param name="samples">Source samples</param>
+        /// <param name="count">Number of samples to copy</param>
+        public void SetAudio(float[] samples, int count)
+        {
+            if (samples == null || count <= 0)
+            {
+                AudioSampleCount = 0;
+                return;
+            }
+            if (count > samples.Length)
+            {
+                count = samples.Length;
+            }
+            if (AudioSamples.Length < count)
+            {
+                // --- The frame was longer than expected (e.g. overflow)
+                AudioSamples = new float[count];
+            }
+            Array.Copy(samples, AudioSamples, count);
+            AudioSampleCount = count;
+        }
+    }
+}
@@ -0,0 +1,53 @@
+﻿using System.Collections.Generic;
+
+namespace Spect.Net.SpectrumEmu.Recording
+{
+    /// <summary>
+    /// This class describes the video and audio format of a recording
+    /// </summary>
+    public class RecordingFormat
+    {
+        /// <summary>
+        /// Width of the screen in pixels
+        /// </summary>
+        public int Width { get; }
+
+        /// <summary>
+        /// Height of the screen in pixels
+        /// </summary>
+        public int Height { get; }
+
+        /// <summary>
+        /// ARGB colors of the palette indexes used in the pixels
+        /// </summary>
+        public IReadOnlyList<uint> Palette { get; }
+
+        /// <summary>
+        /// Number of frames per second
+        /// </summary>
+        public decimal FrameRate { get; }
+
+        /// <summary>
+        /// Number of audio samples per second (0, if there is no audio)
+        /// </summary>
+        public int AudioSampleRate { get; }
+
+        /// <summary>
+        /// Initializes the format
+        /// </summary>
+        /// <param name="width">Screen width</param>
+        /// <param name="height">Screen height</param>
+        /// <param name="palette">ARGB palette colors</param>
+        /// <param name="frameRate">Frames per second</param>
+        /// <param name="audioSampleRate">Audio samples per second</param>
+        public RecordingFormat(int width, int height, IReadOnlyList<uint> palette, decimal frameRate,
+            int audioSampleRate)
+        {
+            Width = width;
+            Height = height;
+            Palette = palette;
+            FrameRate = frameRate;
+            AudioSampleRate = audioSampleRate;
+        }
+    }
+}
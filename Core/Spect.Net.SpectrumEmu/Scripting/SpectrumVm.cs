@@ -8,8 +8,11 @@ using System.Threading.Tasks;
 using Spect.Net.Assembler.Assembler;
 using Spect.Net.SpectrumEmu.Abstraction.Configuration;
 using Spect.Net.SpectrumEmu.Abstraction.Devices;
+using Spect.Net.SpectrumEmu.Basic;
+using Spect.Net.SpectrumEmu.Cpu;
 using Spect.Net.SpectrumEmu.Devices.Screen;
 using Spect.Net.SpectrumEmu.Machine;
+using Spect.Net.SpectrumEmu.Recording;
 // ReSharper disable ArgumentsStyleLiteral
 
 namespace Spect.Net.SpectrumEmu.Scripting
@@ -24,6 +27,7 @@ namespace Spect.Net.SpectrumEmu.Scripting
         private readonly ISpectrumVm _spectrumVm;
         private readonly SpectrumVmStateFileManager _stateFileManager;
         private CancellationTokenSource _cancellationTokenSource;
+        private Z80InstructionProfiler _lastProfiler;
 
         #region Machine properties
 
@@ -248,6 +252,7 @@ namespace Spect.Net.SpectrumEmu.Scripting
             {
                 await Stop();
             }
+            StopRecording();
             _spectrumVm.ScreenDevice.FrameCompleted -= OnScreenFrameCompleted;
         }
 
@@ -478,6 +483,101 @@ namespace Spect.Net.SpectrumEmu.Scripting
 
         #endregion
 
+        #region Recording functions
+
+        /// <summary>
+        /// The recorder of the machine, provided a recording is in progress
+        /// </summary>
+        public FrameRecorder Recorder { get; private set; }
+
+        /// <summary>
+        /// Starts recording the screen and the audio with the specified writer
+        /// </summary>
+        /// <param name="writer">Writer that encodes the frames</param>
+        /// <param name="queueLength">Number of frames that can wait for the writer</param>
+        /// <returns>The recorder</returns>
+        public FrameRecorder StartRecording(IFrameRecordingWriter writer,
+            int queueLength = FrameRecorder.DEFAULT_QUEUE_LENGTH)
+        {
+            StopRecording();
+            Recorder = new FrameRecorder(writer, queueLength);
+            Recorder.Start(_spectrumVm);
+            return Recorder;
+        }
+
+        /// <summary>
+        /// Starts recording the screen and the audio into the specified AVI file
+        /// </summary>
+        /// <param name="fileName">Output file name</param>
+        /// <returns>The recorder</returns>
+        public FrameRecorder StartRecording(string fileName)
+            => StartRecording(new AviRecordingWriter(fileName));
+
+        /// <summary>
+        /// Stops the recording in progress, and completes the output
+        /// </summary>
+        public void StopRecording()
+        {
+            Recorder?.Stop();
+            Recorder = null;
+        }
+
+        #endregion
+
+        #region Profiling functions
+
+        /// <summary>
+        /// The instruction profiler of the CPU; null, if profiling is turned off
+        /// </summary>
+        public Z80InstructionProfiler Profiler => _spectrumVm.Cpu.Profiler;
+
+        /// <summary>
+        /// Turns on collecting the execution statistics of Z80 instructions
+        /// </summary>
+        /// <param name="clear">Indicates if the statistics collected so far should be removed</param>
+        /// <returns>The profiler that collects the statistics</returns>
+        public Z80InstructionProfiler StartProfiling(bool clear = true)
+        {
+            var profiler = _spectrumVm.Cpu.Profiler ?? _lastProfiler ?? new Z80InstructionProfiler();
+            if (clear)
+            {
+                profiler.Clear();
+            }
+            _spectrumVm.Cpu.Profiler = _lastProfiler = profiler;
+            return profiler;
+        }
+
+        /// <summary>
+        /// Turns off collecting the execution statistics
+        /// </summary>
+        /// <returns>The profiler with the collected statistics</returns>
+        public Z80InstructionProfiler StopProfiling()
+        {
+            var profiler = _spectrumVm.Cpu.Profiler;
+            _spectrumVm.Cpu.Profiler = null;
+            return profiler;
+        }
+
+        /// <summary>
+        /// Gets the collected instruction statistics as a text table
+        /// </summary>
+        /// <remarks>
+        /// The statistics of the last profiling session are available after
+        /// profiling has been stopped
+        /// </remarks>
+        public string GetProfilingTable() => (Profiler ?? _lastProfiler)?.ToTable();
+
+        /// <summary>
+        /// Gets the collected instruction statistics as JSON
+        /// </summary>
+        /// <remarks>
+        /// The statistics of the last profiling session are available after
+        /// profiling has been stopped
+        /// </remarks>
+        public string GetProfilingJson() => (Profiler ?? _lastProfiler)?.ToJson();
+
+        #endregion
+
         #region Code manipulation function
 
         /// <summary>
@@ -564,6 +664,26 @@ namespace Spect.Net.SpectrumEmu.Scripting
             return output.EntryAddress ?? output.Segments[0].StartAddress;
         }
 
+        /// <summary>
+        /// Tokenizes the provided BASIC source and loads it into the virtual machine
+        /// </summary>
+        /// <param name="basicSource">ZX Spectrum BASIC source, one numbered line per row</param>
+        /// <returns>The address following the program (the new value of VARS)</returns>
+        /// <remarks>
+        /// The program replaces the current one, and the variables are cleared,
+        /// as if the program was loaded from tape.
+        /// </remarks>
+        public ushort InjectBasicProgram(string basicSource)
+        {
+            if (MachineState != VmState.Paused)
+            {
+                throw new InvalidOperationException(
+                    "The virtual machine must be in Paused state to allow BASIC program injection.");
+            }
+            var program = new BasicTokenizer().TokenizeProgram(basicSource);
+            return BasicProgramLoader.Load(_spectrumVm.MemoryDevice, program);
+        }
+
         /// <summary>
         /// Calls the code at the specified subroutine start address
         /// </summary>
@@ -710,6 +830,11 @@ namespace Spect.Net.SpectrumEmu.Scripting
         {
             var oldState = MachineState;
             MachineState = newState;
+            if (newState == VmState.Paused || newState == VmState.Stopped)
+            {
+                // --- The disk images are up to date while the machine does not run
+                _spectrumVm.FloppyDevice?.Flush();
+            }
             VmStateChanged?.Invoke(this, new VmStateChangedEventArgs(oldState, newState));
         }
 
@@ -54,7 +54,8 @@ namespace Spect.Net.SpectrumEmu.Scripting
         protected override void ResetDevicesAfterLoad()
         {
             SpectrumVm.BeeperDevice.Reset();
-            SpectrumVm.BeeperProvider.Reset();
+            SpectrumVm.BeeperProvider?.Reset();
+            SpectrumVm.AudioMixerDevice?.Reset();
         }
     }
 }
\ No newline at end of file
@@ -38,9 +38,9 @@ namespace Spect.Net.SpectrumEmu.Scripting
         public const ushort SPP3_RETURN_TO_EDITOR = 0x0937;
 
         /// <summary>
-        /// Time to wait after an emulated menu key has been pressed
+        /// Number of frames between two emulated menu keys
         /// </summary>
-        public const int WAIT_FOR_MENU_KEY = 250;
+        public const int MENU_KEY_FRAMES = 13;
 
         /// <summary>
         /// Number of frames an emulated key is held down
@@ -94,6 +94,11 @@ namespace Spect.Net.SpectrumEmu.Scripting
         /// </summary>
         protected abstract void ResetDevicesAfterLoad();
 
+        /// <summary>
+        /// The cache of the startup states shared by the projects (null: no cache)
+        /// </summary>
+        protected virtual StartupStateCache StartupStateCache => StartupStateCache.Default;
+
         /// <summary>
         /// Responds to the event when an invalid machine state has been detected
         /// </summary>
@@ -203,19 +208,75 @@ namespace Spect.Net.SpectrumEmu.Scripting
             // --- We cannot set the desired state if the machine is running
             CheckMachineState();
 
-            // --- Check, if the virtual machine state file exists
             var stateFolder = GetStateFolder();
             var stateFile = Path.Combine(stateFolder, vmFile);
+            var cache = StartupStateCache;
+            var key = cache == null || SpectrumVm == null
+                ? null
+                : StartupStateCache.ComputeKey(SpectrumVm, ModelName, vmFile);
+
+            // --- Check, if the virtual machine state file exists
             LogMessage($"Checking VMSTATE file {stateFile}");
             if (File.Exists(stateFile))
             {
+                // --- The snapshot of the file can be used while the file does not change
+                var fileInfo = new FileInfo(stateFile);
+                var fileKey = key == null
+                    ? null
+                    : $"{key}|{fileInfo.LastWriteTimeUtc.Ticks}|{fileInfo.Length}";
+                if (fileKey != null && cache.TryGetSnapshot(fileKey, out var fileSnapshot))
+                {
+                    LogMessage($"Restoring cached {stateFile}");
+                    if (RestoreVmState(() => SpectrumVm.RestoreSnapshot(fileSnapshot, ModelName)))
+                    {
+                        return true;
+                    }
+                    cache.RemoveSnapshot(fileKey);
+                }
+
                 // --- Use the existing state file
                 LogMessage($"Loading {stateFile}");
-                LoadVmStateFile(stateFile);
-                LogMessage("Virtual machine state restored.");
+                var state = File.ReadAllText(stateFile);
+                if (RestoreVmState(() => SpectrumVm.SetVmState(state, ModelName)))
+                {
+                    if (fileKey != null)
+                    {
+                        cache.StoreSnapshot(fileKey, SpectrumVm.CreateSnapshot(ModelName));
+                    }
+                    LogMessage("Virtual machine state restored.");
+                }
                 return true;
             }
 
+            // --- Without a state file, use the snapshot of the last load, if there is any
+            if (key != null && cache.TryGetSnapshot(key, out var snapshot))
+            {
+                LogMessage("Restoring cached virtual machine startup state.");
+                if (RestoreVmState(() => SpectrumVm.RestoreSnapshot(snapshot, ModelName)))
+                {
+                    WriteStateFile(stateFile, SpectrumVm.GetVmState(ModelName));
+                    return true;
+                }
+                cache.RemoveSnapshot(key);
+            }
+
+            // --- Check, if the machine-wide cache has the state
+            var cachedState = key == null ? null : cache.TryReadState(key);
+            if (cachedState != null)
+            {
+                LogMessage($"Loading {cache.GetStateFile(key)}");
+                if (RestoreVmState(() => SpectrumVm.SetVmState(cachedState, ModelName)))
+                {
+                    cache.StoreSnapshot(key, SpectrumVm.CreateSnapshot(ModelName));
+                    WriteStateFile(stateFile, cachedState);
+                    LogMessage("Virtual machine state restored.");
+                    return true;
+                }
+
+                // --- Do not load a state that cannot be restored again
+                cache.RemoveState(key);
+            }
+
             // --- Create the new virtual machine startup state
             LogMessage("Creating virtual machine startup state.");
             var result = await createAction(VmController);
@@ -224,7 +285,13 @@ namespace Spect.Net.SpectrumEmu.Scripting
             if (result)
             {
                 LogMessage($"Saving {stateFile}");
-                SaveVmStateFile(stateFile);
+                var newState = SpectrumVm.GetVmState(ModelName);
+                WriteStateFile(stateFile, newState);
+                if (key != null)
+                {
+                    cache.WriteState(key, newState);
+                    cache.StoreSnapshot(key, SpectrumVm.CreateSnapshot(ModelName));
+                }
             }
             return result;
         }
@@ -237,12 +304,36 @@ namespace Spect.Net.SpectrumEmu.Scripting
         {
             CheckMachineState();
             var state = File.ReadAllText(stateFile);
+            RestoreVmState(() => SpectrumVm.SetVmState(state, ModelName));
+        }
+
+        /// <summary>
+        /// Saves the virtual machine state to the specified file
+        /// </summary>
+        /// <param name="stateFile">File to save the virtual machine state</param>
+        public void SaveVmStateFile(string stateFile)
+        {
+            CheckMachineState();
+            WriteStateFile(stateFile, SpectrumVm.GetVmState(ModelName));
+        }
+
+        #region Helpers
+
+        /// <summary>
+        /// Restores the machine state with the specified action, and then
+        /// forces the machine into paused state
+        /// </summary>
+        /// <param name="restore">Action that restores the state</param>
+        /// <returns>True, if the state has been restored; otherwise, false</returns>
+        private bool RestoreVmState(Action restore)
+        {
             try
             {
-                SpectrumVm.SetVmState(state, ModelName);
+                restore();
                 ResetDevicesAfterLoad();
                 LogMessage($"Forcing Paused state from {VmController.MachineState}");
                 ForcePausedState();
+                return true;
             }
             catch (InvalidVmStateException e)
             {
@@ -252,28 +343,25 @@ namespace Spect.Net.SpectrumEmu.Scripting
             {
                 OnLoadVmException(e);
             }
+            return false;
         }
 
         /// <summary>
-        /// Saves the virtual machine state to the specified file
+        /// Writes the state into the specified file
         /// </summary>
         /// <param name="stateFile">File to save the virtual machine state</param>
-        public void SaveVmStateFile(string stateFile)
+        /// <param name="state">JSON state</param>
+        private static void WriteStateFile(string stateFile, string state)
         {
-            CheckMachineState();
             var stateFolder = Path.GetDirectoryName(stateFile);
-            var newState = SpectrumVm.GetVmState(ModelName);
-
             if (!Directory.Exists(stateFolder))
             {
                 // ReSharper disable once AssignNullToNotNullAttribute
                 Directory.CreateDirectory(stateFolder);
             }
-            File.WriteAllText(stateFile, newState);
+            File.WriteAllText(stateFile, state);
         }
 
-        #region Helpers
-
         /// <summary>
         /// Checks if machine is in a valid state for VMSTATE operations
         /// </summary>
@@ -321,20 +409,14 @@ namespace Spect.Net.SpectrumEmu.Scripting
                 fastTapeMode: true,
                 fastVmMode: true));
             if (!await WaitForTerminationPoint()) return false;
+
+            // --- Move to Spectrum 48 mode
+            ScheduleMenuSelection(3);
             controller.Start(new ExecuteCycleOptions(EmulationMode.UntilExecutionPoint,
                 terminationRom: 1,
                 terminationPoint: SP48_MAIN_EXEC_ADDR,
                 fastTapeMode: true,
                 fastVmMode: true));
-
-            // --- Move to Spectrum 48 mode
-            QueueKeyStroke(SpectrumKeyCode.N6, SpectrumKeyCode.CShift);
-            await Task.Delay(WAIT_FOR_MENU_KEY);
-            QueueKeyStroke(SpectrumKeyCode.N6, SpectrumKeyCode.CShift);
-            await Task.Delay(WAIT_FOR_MENU_KEY);
-            QueueKeyStroke(SpectrumKeyCode.N6, SpectrumKeyCode.CShift);
-            await Task.Delay(WAIT_FOR_MENU_KEY);
-            QueueKeyStroke(SpectrumKeyCode.Enter);
             return await WaitForTerminationPoint();
         }
 
@@ -354,16 +436,14 @@ namespace Spect.Net.SpectrumEmu.Scripting
                 fastTapeMode: true,
                 fastVmMode: true));
             if (!await WaitForTerminationPoint()) return false;
+
+            // --- Move to Spectrum 128 mode
+            ScheduleMenuSelection(1);
             controller.Start(new ExecuteCycleOptions(EmulationMode.UntilExecutionPoint,
                 terminationRom: 0,
                 terminationPoint: SP128_RETURN_TO_EDITOR,
                 fastTapeMode: true,
                 fastVmMode: true));
-
-            // --- Move to Spectrum 128 mode
-            QueueKeyStroke(SpectrumKeyCode.N6, SpectrumKeyCode.CShift);
-            await Task.Delay(WAIT_FOR_MENU_KEY);
-            QueueKeyStroke(SpectrumKeyCode.Enter);
             return await WaitForTerminationPoint();
         }
 
@@ -383,20 +463,14 @@ namespace Spect.Net.SpectrumEmu.Scripting
                 fastTapeMode: true,
                 fastVmMode: true));
             if (!await WaitForTerminationPoint()) return false;
+
+            // --- Move to Spectrum 48 mode
+            ScheduleMenuSelection(3);
             controller.Start(new ExecuteCycleOptions(EmulationMode.UntilExecutionPoint,
                 terminationRom: 3,
                 terminationPoint: SP48_MAIN_EXEC_ADDR,
                 fastTapeMode: true,
                 fastVmMode: true));
-
-            // --- Move to Spectrum 48 mode
-            QueueKeyStroke(SpectrumKeyCode.N6, SpectrumKeyCode.CShift);
-            await Task.Delay(WAIT_FOR_MENU_KEY);
-            QueueKeyStroke(SpectrumKeyCode.N6, SpectrumKeyCode.CShift);
-            await Task.Delay(WAIT_FOR_MENU_KEY);
-            QueueKeyStroke(SpectrumKeyCode.N6, SpectrumKeyCode.CShift);
-            await Task.Delay(WAIT_FOR_MENU_KEY);
-            QueueKeyStroke(SpectrumKeyCode.Enter);
             return await WaitForTerminationPoint();
         }
 
@@ -416,16 +490,14 @@ namespace Spect.Net.SpectrumEmu.Scripting
                 fastTapeMode: true,
                 fastVmMode: true));
             if (!await WaitForTerminationPoint()) return false;
+
+            // --- Move to Spectrum +3 mode
+            ScheduleMenuSelection(1);
             controller.Start(new ExecuteCycleOptions(EmulationMode.UntilExecutionPoint,
                 terminationRom: 0,
                 terminationPoint: SPP3_RETURN_TO_EDITOR,
                 fastTapeMode: true,
                 fastVmMode: true));
-
-            // --- Move to Spectrum +3 mode
-            QueueKeyStroke(SpectrumKeyCode.N6, SpectrumKeyCode.CShift);
-            await Task.Delay(WAIT_FOR_MENU_KEY);
-            QueueKeyStroke(SpectrumKeyCode.Enter);
             return await WaitForTerminationPoint();
         }
 
@@ -438,7 +510,9 @@ namespace Spect.Net.SpectrumEmu.Scripting
             const int TIME_OUT_IN_SECONDS = 5;
 
             await Task.WhenAny(VmController.CompletionTask, Task.Delay(TIME_OUT_IN_SECONDS * 1000));
-            if (VmController.CompletionTask.IsCompleted && VmController.MachineState == VmState.Paused)
+            // --- Only a machine stopped at the termination point has a state worth saving
+            if (VmController.CompletionTask.IsCompleted && VmController.MachineState == VmState.Paused
+                && SpectrumVm.ExecutionCompletionReason == ExecutionCompletionReason.TerminationPointReached)
             {
                 return true;
             }
@@ -450,24 +524,38 @@ namespace Spect.Net.SpectrumEmu.Scripting
         }
 
         /// <summary>
-        /// Enques an emulated key stroke
+        /// Schedules the key strokes that select an item of the boot menu
         /// </summary>
-        /// <param name="primaryCode">Primary key code</param>
-        /// <param name="secondaryCode">Secondary key code</param>
-        private void QueueKeyStroke(SpectrumKeyCode primaryCode,
-            SpectrumKeyCode? secondaryCode = null)
+        /// <param name="menuItem">Index of the menu item (number of cursor down keys)</param>
+        /// <remarks>
+        /// The keys are scheduled for CPU tacts, so the menu navigation does
+        /// not depend on the wall clock and can run in fast mode.
+        /// </remarks>
+        private void ScheduleMenuSelection(int menuItem)
         {
             if (SpectrumVm == null) return;
+            ScheduleMenuSelection(SpectrumVm.InputSchedule, SpectrumVm.Cpu.Tacts, menuItem);
+        }
 
-            var currentTact = SpectrumVm.Cpu.Tacts;
-            var lastTact = currentTact + SpectrumVm.FrameTacts * KEY_PRESS_FRAMES * SpectrumVm.ClockMultiplier;
+        /// <summary>
+        /// Schedules the key strokes that select an item of the boot menu
+        /// </summary>
+        /// <param name="schedule">Input schedule of the machine</param>
+        /// <param name="startTact">The current CPU tact of the machine</param>
+        /// <param name="menuItem">Index of the menu item (number of cursor down keys)</param>
+        public static void ScheduleMenuSelection(InputSchedule schedule, long startTact, int menuItem)
+        {
+            if (schedule == null) throw new ArgumentNullException(nameof(schedule));
 
-            SpectrumVm.KeyboardProvider.QueueKeyPress(
-                new EmulatedKeyStroke(
-                    currentTact,
-                    lastTact,
-                    primaryCode,
-                    secondaryCode));
+            var keyTacts = MENU_KEY_FRAMES * schedule.TactsPerFrame;
+            var holdTacts = KEY_PRESS_FRAMES * schedule.TactsPerFrame;
+            var tact = startTact + keyTacts;
+            for (var i = 0; i < menuItem; i++)
+            {
+                schedule.KeyStroke(tact, holdTacts, SpectrumKeyCode.N6, SpectrumKeyCode.CShift);
+                tact += keyTacts;
+            }
+            schedule.KeyStroke(tact, holdTacts, SpectrumKeyCode.Enter);
         }
 
         #endregion
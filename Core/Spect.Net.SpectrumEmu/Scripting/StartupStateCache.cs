@@ -0,0 +1,279 @@
+﻿using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Security.Cryptography;
+using System.Text;
+using Spect.Net.SpectrumEmu.Abstraction.Devices;
+using Spect.Net.SpectrumEmu.Machine;
+
+namespace Spect.Net.SpectrumEmu.Scripting
+{
+    /// <summary>
+    /// This class caches the startup states of the virtual machines. The
+    /// states are shared by all projects and test runs on the computer.
+    /// </summary>
+    /// <remarks>
+    /// A startup state is identified by a hash of the ROM images, the model
+    /// and machine configuration, and the name of the startup state, so
+    /// machines with the same configuration find the same state. The state
+    /// files are kept in a folder of the local application data. The most
+    /// recently used states are also kept in memory as snapshots that can be
+    /// restored without parsing the state file.
+    /// </remarks>
+    public class StartupStateCache
+    {
+        /// <summary>
+        /// Changing this value invalidates the cached states
+        /// </summary>
+        public const string FORMAT_VERSION = "2";
+
+        /// <summary>
+        /// The maximum number of snapshots kept in memory
+        /// </summary>
+        public const int MAX_SNAPSHOTS = 8;
+
+        /// <summary>
+        /// Extension of the cached state files
+        /// </summary>
+        public const string STATE_FILE_EXTENSION = ".vmstate";
+
+        private readonly object _locker = new object();
+        private readonly Dictionary<string, VmStateSnapshot> _snapshots = new Dictionary<string, VmStateSnapshot>();
+        private readonly LinkedList<string> _snapshotOrder = new LinkedList<string>();
+
+        /// <summary>
+        /// The default folder of the machine-wide cache
+        /// </summary>
+        public static string DefaultFolder =>
+            Path.Combine(Environment.GetFolderPath(Environment.SpecialFolder.LocalApplicationData),
+                "SpectNetIde", "StartupStates");
+
+        /// <summary>
+        /// The cache shared by the virtual machines of the process
+        /// </summary>
+        public static StartupStateCache Default { get; } = new StartupStateCache(DefaultFolder);
+
+        /// <summary>
+        /// The folder of the state files; null, if states are kept only in memory
+        /// </summary>
+        public string Folder { get; }
+
+        /// <summary>
+        /// Creates a cache that uses the specified folder
+        /// </summary>
+        /// <param name="folder">Folder of the state files (null: memory only)</param>
+        public StartupStateCache(string folder)
+        {
+            Folder = folder;
+        }
+
+        /// <summary>
+        /// Calculates the key of a startup state
+        /// </summary>
+        /// <param name="spectrumVm">Virtual machine</param>
+        /// <param name="modelName">Model of the virtual machine</param>
+        /// <param name="stateName">Name of the startup state</param>
+        /// <returns>Hexadecimal hash that identifies the state</returns>
+        public static string ComputeKey(ISpectrumVm spectrumVm, string modelName, string stateName)
+        {
+            if (spectrumVm == null) throw new ArgumentNullException(nameof(spectrumVm));
+            using (var sha = SHA256.Create())
+            {
+                var memoryConfig = spectrumVm.MemoryConfiguration;
+                var engineVersion = typeof(SpectrumEngine).Assembly.GetName().Version;
+                var header = $"{FORMAT_VERSION}|{engineVersion}|{modelName}|{stateName}|"
+                    + $"{spectrumVm.BaseClockFrequency}|{spectrumVm.ClockMultiplier}|{spectrumVm.FrameTacts}|"
+                    + $"{memoryConfig?.SupportsBanking}|{memoryConfig?.RamBanks}|{memoryConfig?.ContentionType}|";
+                var headerBytes = Encoding.UTF8.GetBytes(header);
+                sha.TransformBlock(headerBytes, 0, headerBytes.Length, null, 0);
+
+                var romCount = spectrumVm.RomConfiguration?.NumberOfRoms ?? 0;
+                for (var i = 0; i < romCount; i++)
+                {
+                    var rom = spectrumVm.RomDevice.GetRomBytes(i);
+                    if (rom != null)
+                    {
+                        sha.TransformBlock(rom, 0, rom.Length, null, 0);
+                    }
+                }
+                sha.TransformFinalBlock(new byte[0], 0, 0);
+
+                var hash = new StringBuilder(sha.Hash.Length * 2);
+                foreach (var hashByte in sha.Hash)
+                {
+                    hash.Append(hashByte.ToString("x2"));
+                }
+                return hash.ToString();
+            }
+        }
+
+        /// <summary>
+        /// Gets the name of the file that stores the specified state
+        /// </summary>
+        /// <param name="key">Key of the state</param>
+        public string GetStateFile(string key)
+            => Folder == null ? null : Path.Combine(Folder, key + STATE_FILE_EXTENSION);
+
+        /// <summary>
+        /// Gets the in-memory snapshot of the specified state
+        /// </summary>
+        /// <param name="key">Key of the state</param>
+        /// <param name="snapshot">The snapshot, if found</param>
+        /// <returns>True, if the snapshot has been found; otherwise, false</returns>
+        public bool TryGetSnapshot(string key, out VmStateSnapshot snapshot)
+        {
+            lock (_locker)
+            {
+                if (!_snapshots.TryGetValue(key, out snapshot)) return false;
+                _snapshotOrder.Remove(key);
+                _snapshotOrder.AddFirst(key);
+                return true;
+            }
+        }
+
+        /// <summary>
+        /// Stores the in-memory snapshot of the specified state
+        /// </summary>
+        /// <param name="key">Key of the state</param>
+        /// <param name="snapshot">Snapshot to store</param>
+        public void StoreSnapshot(string key, VmStateSnapshot snapshot)
+        {
+            if (snapshot == null) throw new ArgumentNullException(nameof(snapshot));
+            lock (_locker)
+            {
+                if (_snapshots.ContainsKey(key))
+                {
+                    _snapshotOrder.Remove(key);
+                }
+                _snapshots[key] = snapshot;
+                _snapshotOrder.AddFirst(key);
+                while (_snapshotOrder.Count > MAX_SNAPSHOTS)
+                {
+                    _snapshots.Remove(_snapshotOrder.Last.Value);
+                    _snapshotOrder.RemoveLast();
+                }
+            }
+        }
+
+        /// <summary>
+        /// Reads the specified state from the cache folder
+        /// </summary>
+        /// <param name="key">Key of the state</param>
+        /// <returns>The JSON state; null, if the state is not cached</returns>
+        public string TryReadState(string key)
+        {
+            var stateFile = GetStateFile(key);
+            if (stateFile == null || !File.Exists(stateFile)) return null;
+            try
+            {
+                return File.ReadAllText(stateFile);
+            }
+            catch (IOException)
+            {
+                return null;
+            }
+            catch (UnauthorizedAccessException)
+            {
+                return null;
+            }
+        }
+
+        /// <summary>
+        /// Writes the specified state into the cache folder
+        /// </summary>
+        /// <param name="key">Key of the state</param>
+        /// <param name="state">JSON state</param>
+        /// <returns>True, if the state has been written; otherwise, false</returns>
+        /// <remarks>
+        /// The state is written into a temporary file first, so other processes
+        /// never read a partially written state.
+        /// </remarks>
+        public bool WriteState(string key, string state)
+        {
+            var stateFile = GetStateFile(key);
+            if (stateFile == null) return false;
+            var tempFile = $"{stateFile}.{Guid.NewGuid():N}.tmp";
+            try
+            {
+                Directory.CreateDirectory(Folder);
+                File.WriteAllText(tempFile, state);
+                if (File.Exists(stateFile))
+                {
+                    // --- Another process has already created the state
+                    File.Delete(tempFile);
+                    return true;
+                }
+                File.Move(tempFile, stateFile);
+                return true;
+            }
+            catch (IOException)
+            {
+                TryDelete(tempFile);
+                return false;
+            }
+            catch (UnauthorizedAccessException)
+            {
+                TryDelete(tempFile);
+                return false;
+            }
+        }
+
+        /// <summary>
+        /// Removes the in-memory snapshot of the specified state
+        /// </summary>
+        /// <param name="key">Key of the state</param>
+        public void RemoveSnapshot(string key)
+        {
+            lock (_locker)
+            {
+                if (_snapshots.Remove(key))
+                {
+                    _snapshotOrder.Remove(key);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Removes the specified state from the memory and from the cache folder
+        /// </summary>
+        /// <param name="key">Key of the state</param>
+        public void RemoveState(string key)
+        {
+            RemoveSnapshot(key);
+            var stateFile = GetStateFile(key);
+            if (stateFile != null)
+            {
+                TryDelete(stateFile);
+            }
+        }
+
+        /// <summary>
+        /// Removes the in-memory snapshots
+        /// </summary>
+        public void ClearSnapshots()
+        {
+            lock (_locker)
+            {
+                _snapshots.Clear();
+                _snapshotOrder.Clear();
+            }
+        }
+
+        /// <summary>
+        /// Deletes the specified file, ignoring errors
+        /// </summary>
+        private static void TryDelete(string file)
+        {
+            try
+            {
+                if (File.Exists(file)) File.Delete(file);
+            }
+            catch (IOException)
+            {
+            }
+            catch (UnauthorizedAccessException)
+            {
+            }
+        }
+    }
+}
@@ -61,7 +61,8 @@ namespace Spect.Net.SpectrumEmu
                                 {
                                     AudioSampleRate = 35000,
                                     SamplesPerFrame = 699,
-                                    TactsPerSample = 100
+                                    TactsPerSample = 100,
+                                    BandLimitedSynthesis = true
                                 }
                             }
                         },
@@ -107,7 +108,8 @@ namespace Spect.Net.SpectrumEmu
                                 {
                                     AudioSampleRate = 35000,
                                     SamplesPerFrame = 699,
-                                    TactsPerSample = 100
+                                    TactsPerSample = 100,
+                                    BandLimitedSynthesis = true
                                 }
                             }
                         },
@@ -152,7 +154,8 @@ namespace Spect.Net.SpectrumEmu
                                 {
                                     AudioSampleRate = 35000,
                                     SamplesPerFrame = 591,
-                                    TactsPerSample = 100
+                                    TactsPerSample = 100,
+                                    BandLimitedSynthesis = true
                                 }
                             }
                         },
@@ -197,7 +200,8 @@ namespace Spect.Net.SpectrumEmu
                                 {
                                     AudioSampleRate = 35000,
                                     SamplesPerFrame = 699,
-                                    TactsPerSample = 100
+                                    TactsPerSample = 100,
+                                    BandLimitedSynthesis = true
                                 }
                             }
                         },
@@ -242,7 +246,8 @@ namespace Spect.Net.SpectrumEmu
                                 {
                                     AudioSampleRate = 35000,
                                     SamplesPerFrame = 699,
-                                    TactsPerSample = 100
+                                    TactsPerSample = 100,
+                                    BandLimitedSynthesis = true
                                 }
                             }
                         }
@@ -296,7 +301,8 @@ namespace Spect.Net.SpectrumEmu
                                 {
                                     AudioSampleRate = 35469,
                                     SamplesPerFrame = 709,
-                                    TactsPerSample = 100
+                                    TactsPerSample = 100,
+                                    BandLimitedSynthesis = true
                                 },
                                 Sound = new AudioConfigurationData
                                 {
@@ -356,7 +362,8 @@ namespace Spect.Net.SpectrumEmu
                                 {
                                     AudioSampleRate = 35469,
                                     SamplesPerFrame = 709,
-                                    TactsPerSample = 100
+                                    TactsPerSample = 100,
+                                    BandLimitedSynthesis = true
                                 },
                                 Sound = new AudioConfigurationData
                                 {
@@ -408,7 +415,8 @@ namespace Spect.Net.SpectrumEmu
                                 {
                                     AudioSampleRate = 35469,
                                     SamplesPerFrame = 709,
-                                    TactsPerSample = 100
+                                    TactsPerSample = 100,
+                                    BandLimitedSynthesis = true
                                 },
                                 Sound = new AudioConfigurationData
                                 {
@@ -465,7 +473,8 @@ namespace Spect.Net.SpectrumEmu
                                 {
                                     AudioSampleRate = 35469,
                                     SamplesPerFrame = 709,
-                                    TactsPerSample = 100
+                                    TactsPerSample = 100,
+                                    BandLimitedSynthesis = true
                                 },
                                 Sound = new AudioConfigurationData
                                 {
@@ -530,7 +539,8 @@ namespace Spect.Net.SpectrumEmu
                                 {
                                     AudioSampleRate = 35469,
                                     SamplesPerFrame = 709,
-                                    TactsPerSample = 100
+                                    TactsPerSample = 100,
+                                    BandLimitedSynthesis = true
                                 },
                                 Sound = new AudioConfigurationData
                                 {
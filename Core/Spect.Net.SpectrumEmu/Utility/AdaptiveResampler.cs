@@ -0,0 +1,127 @@
+﻿using System;
+
+namespace Spect.Net.SpectrumEmu.Utility
+{
+    /// <summary>
+    /// This class resamples the audio stream of a ring buffer with a slightly
+    /// varying rate to keep the fill level of the buffer at a target value.
+    /// </summary>
+    /// <remarks>
+    /// This is dynamic rate control: when the emulator produces samples
+    /// faster than the audio device consumes them, the buffer fills up, and
+    /// the resampler consumes input a bit faster (and vice versa). The rate
+    /// deviates from 1.0 by at most MaxDeviation, which is inaudible.
+    /// The resampler uses linear interpolation with a 32.32 fixed-point
+    /// phase, so the number of input samples consumed is exact.
+    /// </remarks>
+    public class AdaptiveResampler
+    {
+        /// <summary>
+        /// Default maximum deviation of the resampling ratio
+        /// </summary>
+        public const double DEFAULT_MAX_DEVIATION = 0.005;
+
+        private const long ONE = 1L << 32;
+        private const double FILL_SMOOTHING = 0.05;
+
+        private float[] _input = new float[1024];
+        private long _phase;
+        private float _prev;
+        private float _next;
+        private double _averageFill;
+
+        /// <summary>
+        /// The fill level (number of samples) the resampler tries to keep
+        /// </summary>
+        public int TargetFill { get; }
+
+        /// <summary>
+        /// Maximum deviation of the resampling ratio from 1.0
+        /// </summary>
+        public double MaxDeviation { get; }
+
+        /// <summary>
+        /// The input/output ratio used by the last Process call
+        /// </summary>
+        public double Ratio { get; private set; } = 1.0;
+
+        /// <summary>
+        /// The smoothed fill level of the source buffer (number of samples)
+        /// </summary>
+        public double AverageFill => _averageFill;
+
+        /// <summary>
+        /// Creates the resampler
+        /// </summary>
+        /// <param name="targetFill">Fill level to keep</param>
+        /// <param name="maxDeviation">Maximum deviation of the ratio from 1.0</param>
+        public AdaptiveResampler(int targetFill, double maxDeviation = DEFAULT_MAX_DEVIATION)
+        {
+            TargetFill = targetFill < 1 ? 1 : targetFill;
+            MaxDeviation = maxDeviation;
+            Reset();
+        }
+
+        /// <summary>
+        /// Resets the resampler state
+        /// </summary>
+        public void Reset()
+        {
+            _phase = ONE;
+            _prev = _next = 0.0f;
+            _averageFill = TargetFill;
+            Ratio = 1.0;
+        }
+
+        /// <summary>
+        /// Produces output samples from the source buffer
+        /// </summary>
+        /// <param name="source">Source ring buffer</param>
+        /// <param name="buffer">Output buffer</param>
+        /// <param name="offset">Index of the first output sample</param>
+        /// <param name="count">Number of output samples</param>
+        /// <returns>
+        /// The number of missing input samples. When the source underruns,
+        /// the last available sample is held.
+        /// </returns>
+        public int Process(AudioRingBuffer source, float[] buffer, int offset, int count)
+        {
+            if (count <= 0) return 0;
+
+            // --- Update the ratio from the smoothed fill level
+            _averageFill += (source.Count - _averageFill) * FILL_SMOOTHING;
+            var error = (_averageFill - TargetFill) / TargetFill;
+            if (error > 1.0) error = 1.0;
+            else if (error < -1.0) error = -1.0;
+            Ratio = 1.0 + MaxDeviation * error;
+            var step = (long)(Ratio * ONE);
+
+            // --- Fetch exactly the number of input samples the block consumes
+            var needed = (int)((_phase + (count - 1) * step) >> 32);
+            if (_input.Length < needed)
+            {
+                _input = new float[needed * 2];
+            }
+            var available = source.Read(_input, 0, needed);
+
+            // --- Interpolate
+            var inputIndex = 0;
+            for (var i = 0; i < count; i++)
+            {
+                while (_phase >= ONE)
+                {
+                    _phase -= ONE;
+                    _prev = _next;
+                    if (inputIndex < available)
+                    {
+                        _next = _input[inputIndex];
+                    }
+                    inputIndex++;
+                }
+                buffer[offset + i] = _prev + (_next - _prev) * (float)((double)_phase / ONE);
+                _phase += step;
+            }
+            return Math.Max(0, needed - available);
+        }
+    }
+}
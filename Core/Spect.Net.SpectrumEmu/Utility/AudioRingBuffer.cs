@@ -0,0 +1,141 @@
+﻿using System;
+using System.Threading;
+
+namespace Spect.Net.SpectrumEmu.Utility
+{
+    /// <summary>
+    /// This class implements a lock-free single-producer, single-consumer
+    /// ring buffer of audio samples.
+    /// </summary>
+    /// <remarks>
+    /// Only one thread may call Write, and only one (other) thread may call
+    /// Read. The producer owns the write index, the consumer owns the read
+    /// index; each of them publishes its index with a volatile write after
+    /// the samples have been copied.
+    /// </remarks>
+    public class AudioRingBuffer
+    {
+        private readonly float[] _buffer;
+        private readonly int _mask;
+        private long _writeIndex;
+        private long _readIndex;
+        private long _overruns;
+        private long _underruns;
+
+        /// <summary>
+        /// The number of samples the buffer can hold
+        /// </summary>
+        public int Capacity { get; }
+
+        /// <summary>
+        /// The number of samples waiting to be read
+        /// </summary>
+        public int Count => (int)(Volatile.Read(ref _writeIndex) - Volatile.Read(ref _readIndex));
+
+        /// <summary>
+        /// The fill level of the buffer (between 0.0 and 1.0)
+        /// </summary>
+        public double FillLevel => (double)Count / Capacity;
+
+        /// <summary>
+        /// The number of Write calls that could not store all samples
+        /// </summary>
+        public long Overruns => Interlocked.Read(ref _overruns);
+
+        /// <summary>
+        /// The number of Read calls that could not get all samples
+        /// </summary>
+        public long Underruns => Interlocked.Read(ref _underruns);
+
+        /// <summary>
+        /// Creates the ring buffer
+        /// </summary>
+        /// <param name="minCapacity">
+        /// Minimum capacity. The real capacity is rounded up to a power of two.
+        /// </param>
+        public AudioRingBuffer(int minCapacity)
+        {
+            if (minCapacity < 1)
+            {
+                throw new ArgumentOutOfRangeException(nameof(minCapacity));
+            }
+            var capacity = 1;
+            while (capacity < minCapacity) capacity <<= 1;
+            Capacity = capacity;
+            _mask = capacity - 1;
+            _buffer = new float[capacity];
+        }
+
+        /// <summary>
+        /// Writes samples into the buffer. Samples that do not fit are dropped.
+        /// </summary>
+        /// <param name="samples">Sample array</param>
+        /// <param name="offset">Index of the first sample to write</param>
+        /// <param name="count">Number of samples to write</param>
+        /// <returns>The number of samples written</returns>
+        public int Write(float[] samples, int offset, int count)
+        {
+            var writeIndex = _writeIndex;
+            var free = Capacity - (int)(writeIndex - Volatile.Read(ref _readIndex));
+            if (count > free)
+            {
+                Interlocked.Increment(ref _overruns);
+                count = free;
+            }
+            if (count <= 0) return 0;
+
+            // --- Copy in at most two chunks
+            var start = (int)(writeIndex & _mask);
+            var first = Math.Min(count, Capacity - start);
+            Array.Copy(samples, offset, _buffer, start, first);
+            if (first < count)
+            {
+                Array.Copy(samples, offset + first, _buffer, 0, count - first);
+            }
+            Volatile.Write(ref _writeIndex, writeIndex + count);
+            return count;
+        }
+
+        /// <summary>
+        /// Reads samples from the buffer
+        /// </summary>
+        /// <param name="buffer">Buffer to read the samples into</param>
+        /// <param name="offset">Index of the first sample within the buffer</param>
+        /// <param name="count">Number of samples to read</param>
+        /// <returns>The number of samples read</returns>
+        public int Read(float[] buffer, int offset, int count)
+        {
+            var readIndex = _readIndex;
+            var available = (int)(Volatile.Read(ref _writeIndex) - readIndex);
+            if (count > available)
+            {
+                Interlocked.Increment(ref _underruns);
+                count = available;
+            }
+            if (count <= 0) return 0;
+
+            // --- Copy out in at most two chunks
+            var start = (int)(readIndex & _mask);
+            var first = Math.Min(count, Capacity - start);
+            Array.Copy(_buffer, start, buffer, offset, first);
+            if (first < count)
+            {
+                Array.Copy(_buffer, 0, buffer, offset + first, count - first);
+            }
+            Volatile.Write(ref _readIndex, readIndex + count);
+            return count;
+        }
+
+        /// <summary>
+        /// Empties the buffer and resets the counters. Must not be called while
+        /// the producer or the consumer is active.
+        /// </summary>
+        public void Clear()
+        {
+            Volatile.Write(ref _readIndex, 0);
+            Volatile.Write(ref _writeIndex, 0);
+            Interlocked.Exchange(ref _overruns, 0);
+            Interlocked.Exchange(ref _underruns, 0);
+        }
+    }
+}
@@ -51,5 +51,64 @@ namespace Spect.Net.SpectrumEmu.Utility
             }
             return FromBytes(newBytes);
         }
+
+        /// <summary>
+        /// Converts the specified value to the five-byte form of ZX Spectrum numbers
+        /// </summary>
+        /// <param name="value">Value to convert</param>
+        /// <returns>
+        /// The simple integer form for whole numbers between -65535 and 65535;
+        /// otherwise, the floating point form
+        /// </returns>
+        public static byte[] ToBytes(double value)
+        {
+            if (value == Math.Floor(value) && value >= -65535 && value <= 65535)
+            {
+                // --- Simple integer form, negative numbers in two's complement
+                var intValue = (int)value;
+                var stored = intValue < 0 ? intValue + 0x10000 : intValue;
+                return new byte[] {0x00, (byte)(intValue < 0 ? 0xFF : 0x00), (byte)stored, (byte)(stored >> 8), 0x00};
+            }
+
+            var negative = value < 0;
+            var abs = Math.Abs(value);
+
+            // --- Find the exponent so that abs = mant * 2^exp, where 0.5 <= mant < 1
+            var exp = (int)Math.Floor(Math.Log(abs, 2.0)) + 1;
+            var mant = abs / Math.Pow(2.0, exp);
+            if (mant >= 1.0)
+            {
+                mant /= 2.0;
+                exp++;
+            }
+            else if (mant < 0.5)
+            {
+                mant *= 2.0;
+                exp--;
+            }
+            var bits = (ulong)Math.Round(mant * 4294967296.0);
+            if (bits >= 0x100000000UL)
+            {
+                bits >>= 1;
+                exp++;
+            }
+            if (exp + 128 < 1)
+            {
+                // --- Too small to represent
+                return new byte[] {0x00, 0x00, 0x00, 0x00, 0x00};
+            }
+            if (exp + 128 > 0xFF)
+            {
+                throw new OverflowException($"{value} is too large for a ZX Spectrum number.");
+            }
+            return new[]
+            {
+                (byte)(exp + 128),
+                (byte)(((bits >> 24) & 0x7F) | (negative ? 0x80UL : 0x00UL)),
+                (byte)(bits >> 16),
+                (byte)(bits >> 8),
+                (byte)bits
+            };
+        }
     }
 }
\ No newline at end of file
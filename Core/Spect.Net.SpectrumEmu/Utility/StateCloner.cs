@@ -0,0 +1,115 @@
+﻿using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.Linq;
+using System.Reflection;
+using System.Runtime.CompilerServices;
+
+namespace Spect.Net.SpectrumEmu.Utility
+{
+    /// <summary>
+    /// This class creates deep copies of device state object graphs
+    /// </summary>
+    /// <remarks>
+    /// Device states often keep references to the arrays of the device they
+    /// were taken from, and the devices keep the arrays of the states they
+    /// are restored from. A state restored more than once must be copied
+    /// first. Strings, delegates, types, and value types are copied by value;
+    /// value types are expected not to hold mutable references.
+    /// </remarks>
+    public static class StateCloner
+    {
+        private static readonly Func<object, object> s_MemberwiseClone =
+            (Func<object, object>)Delegate.CreateDelegate(typeof(Func<object, object>),
+                typeof(object).GetMethod("MemberwiseClone", BindingFlags.Instance | BindingFlags.NonPublic)
+                ?? throw new InvalidOperationException("MemberwiseClone is not available."));
+
+        private static readonly ConcurrentDictionary<Type, FieldInfo[]> s_ReferenceFields =
+            new ConcurrentDictionary<Type, FieldInfo[]>();
+
+        /// <summary>
+        /// Creates a deep copy of the specified object
+        /// </summary>
+        /// <typeparam name="T">Type of the object</typeparam>
+        /// <param name="source">Object to copy</param>
+        /// <returns>The copy of the object</returns>
+        public static T DeepClone<T>(T source) where T : class
+            => (T)Clone(source, new Dictionary<object, object>(ReferenceComparer.Instance));
+
+        /// <summary>
+        /// Clones the specified object, reusing the copies already made
+        /// </summary>
+        private static object Clone(object source, Dictionary<object, object> copies)
+        {
+            if (source == null) return null;
+            var type = source.GetType();
+            if (IsCopiedByValue(type)) return source;
+            if (copies.TryGetValue(source, out var existing)) return existing;
+
+            if (source is Array array)
+            {
+                var arrayCopy = (Array)array.Clone();
+                copies[source] = arrayCopy;
+                // ReSharper disable once AssignNullToNotNullAttribute
+                if (!IsCopiedByValue(type.GetElementType()))
+                {
+                    if (array.Rank != 1)
+                    {
+                        throw new NotSupportedException(
+                            $"Cannot copy multi-dimensional array of {type.GetElementType()}.");
+                    }
+                    for (var i = 0; i < array.Length; i++)
+                    {
+                        arrayCopy.SetValue(Clone(array.GetValue(i), copies), i);
+                    }
+                }
+                return arrayCopy;
+            }
+
+            var copy = s_MemberwiseClone(source);
+            copies[source] = copy;
+            foreach (var field in s_ReferenceFields.GetOrAdd(type, GetReferenceFields))
+            {
+                field.SetValue(copy, Clone(field.GetValue(source), copies));
+            }
+            return copy;
+        }
+
+        /// <summary>
+        /// Checks if instances of the type can be shared by the copies
+        /// </summary>
+        private static bool IsCopiedByValue(Type type)
+            => type.IsValueType
+                || type == typeof(string)
+                || typeof(Delegate).IsAssignableFrom(type)
+                || typeof(MemberInfo).IsAssignableFrom(type);
+
+        /// <summary>
+        /// Gets the instance fields of the type that may hold mutable references
+        /// </summary>
+        private static FieldInfo[] GetReferenceFields(Type type)
+        {
+            var fields = new List<FieldInfo>();
+            for (var current = type; current != null && current != typeof(object); current = current.BaseType)
+            {
+                fields.AddRange(current
+                    .GetFields(BindingFlags.Instance | BindingFlags.Public | BindingFlags.NonPublic
+                        | BindingFlags.DeclaredOnly)
+                    .Where(f => !IsCopiedByValue(f.FieldType)));
+            }
+            return fields.ToArray();
+        }
+
+        /// <summary>
+        /// Compares objects by reference
+        /// </summary>
+        private class ReferenceComparer : IEqualityComparer<object>
+        {
+            public static readonly ReferenceComparer Instance = new ReferenceComparer();
+
+            public new bool Equals(object x, object y) => ReferenceEquals(x, y);
+
+            public int GetHashCode(object obj) => RuntimeHelpers.GetHashCode(obj);
+        }
+    }
+}
@@ -1,6 +1,8 @@
-﻿using Spect.Net.SpectrumEmu.Abstraction.Configuration;
+﻿using System;
+using Spect.Net.SpectrumEmu.Abstraction.Configuration;
 using Spect.Net.SpectrumEmu.Abstraction.Devices;
 using Spect.Net.SpectrumEmu.Abstraction.Providers;
+using Spect.Net.SpectrumEmu.Utility;
 using Spect.Net.Wpf.Audio;
 
 namespace Spect.Net.Wpf.Providers
@@ -11,26 +13,42 @@ namespace Spect.Net.Wpf.Providers
     public enum AudioProviderType
     {
         Beeper = 1,
-        Psg 
+        Psg,
+        Mixer
     }
 
     /// <summary>
     /// This renderer renders the ear bit pulses into an MME wave form
     /// </summary>
-    public class AudioWaveProvider: VmComponentProviderBase, ISoundProvider, ISampleProvider
+    /// <remarks>
+    /// AddSoundFrame runs on the emulation thread, while Read runs on the
+    /// WaveOut callback thread. They share a lock-free single-producer,
+    /// single-consumer ring buffer. The consumer side resamples the stream
+    /// with a slightly varying rate to keep the buffered latency at the
+    /// target, so the emulator and the audio device clocks can drift apart
+    /// without clicks.
+    /// </remarks>
+    public class AudioWaveProvider: VmComponentProviderBase, ISoundProvider, IAudioMixerProvider, ISampleProvider
     {
         /// <summary>
         /// Number of sound frames buffered
         /// </summary>
         public const int FRAMES_BUFFERED = 50;
-        public const int FRAMES_DELAYED = 2;
+
+        /// <summary>
+        /// Latency of the buffered samples to keep, in milliseconds
+        /// </summary>
+        public const int TARGET_LATENCY = 20;
+
+        /// <summary>
+        /// Latency of the WaveOut device, in milliseconds
+        /// </summary>
+        public const int DEVICE_LATENCY = 20;
 
         private IAudioConfiguration _audioPars;
-        private float[] _waveBuffer;
-        private int _bufferLength;
-        private int _frameCount;
-        private long _writeIndex;
-        private long _readIndex;
+        private AudioRingBuffer _ringBuffer;
+        private AdaptiveResampler _resampler;
+        private bool _primed;
         private IWavePlayer _waveOut;
 
         /// <summary>
@@ -38,6 +56,31 @@ namespace Spect.Net.Wpf.Providers
         /// </summary>
         public AudioProviderType Type { get; }
 
+        /// <summary>
+        /// The number of samples waiting to be played
+        /// </summary>
+        public int BufferedSamples => _ringBuffer?.Count ?? 0;
+
+        /// <summary>
+        /// The fill level of the sample buffer (between 0.0 and 1.0)
+        /// </summary>
+        public double FillLevel => _ringBuffer?.FillLevel ?? 0.0;
+
+        /// <summary>
+        /// The number of frames that did not fit into the sample buffer
+        /// </summary>
+        public long Overruns => _ringBuffer?.Overruns ?? 0;
+
+        /// <summary>
+        /// The number of device reads that ran out of samples
+        /// </summary>
+        public long Underruns => _ringBuffer?.Underruns ?? 0;
+
+        /// <summary>
+        /// The current resampling ratio
+        /// </summary>
+        public double ResampleRatio => _resampler?.Ratio ?? 1.0;
+
         /// <summary>
         /// Initializes the provider with the specified name
         /// </summary>
@@ -52,9 +95,10 @@ namespace Spect.Net.Wpf.Providers
         public override void OnAttachedToVm(ISpectrumVm hostVm)
         {
             base.OnAttachedToVm(hostVm);
-            _audioPars = Type == AudioProviderType.Beeper 
-                ? hostVm.AudioConfiguration : 
-                hostVm.SoundConfiguration;
+            // --- The mixed stream uses the sample rate of the beeper
+            _audioPars = Type == AudioProviderType.Psg 
+                ? hostVm.SoundConfiguration : 
+                hostVm.AudioConfiguration;
             WaveFormat = WaveFormat.CreateIeeeFloatWaveFormat(_audioPars.AudioSampleRate, 1);
             Reset();
         }
@@ -73,11 +117,9 @@ namespace Spect.Net.Wpf.Providers
                 // --- We ignore this exception deliberately
             }
             _waveOut = null;
-            _bufferLength = (_audioPars.SamplesPerFrame + 1) * FRAMES_BUFFERED;
-            _waveBuffer = new float[_bufferLength];
-            _frameCount = 0;
-            _writeIndex = 0;
-            _readIndex = 0;
+            _ringBuffer = new AudioRingBuffer((_audioPars.SamplesPerFrame + 1) * FRAMES_BUFFERED);
+            _resampler = new AdaptiveResampler(_audioPars.AudioSampleRate * TARGET_LATENCY / 1000);
+            _primed = false;
         }
 
         /// <summary>
@@ -88,11 +130,7 @@ namespace Spect.Net.Wpf.Providers
         /// </param>
         public void AddSoundFrame(float[] samples)
         {
-            foreach (var sample in samples)
-            {
-                _waveBuffer[_writeIndex++] = sample;
-                if (_writeIndex >= _bufferLength) _writeIndex = 0;
-            }
+            _ringBuffer.Write(samples, 0, samples.Length);
         }
 
         /// <summary>
@@ -110,24 +148,22 @@ namespace Spect.Net.Wpf.Providers
         /// <returns>the number of samples written to the buffer.</returns>
         public int Read(float[] buffer, int offset, int count)
         {
-            // --- We set up the initial buffer content for desired latency
-            if (_frameCount <= FRAMES_DELAYED)
+            var ringBuffer = _ringBuffer;
+            var resampler = _resampler;
+
+            // --- Play silence until the buffer holds the target latency
+            if (!_primed && ringBuffer.Count < resampler.TargetFill)
             {
-                for (var i = 0; i < count; i++)
-                {
-                    buffer[offset++] = 0.0F;
-                }
+                Array.Clear(buffer, offset, count);
+                return count;
             }
-            else
+            _primed = true;
+
+            // --- Wait for the target latency again after running out of samples
+            if (resampler.Process(ringBuffer, buffer, offset, count) > 0)
             {
-                // --- We use the real samples
-                for (var i = 0; i < count; i++)
-                {
-                    buffer[offset++] = _waveBuffer[_readIndex++];
-                    if (_readIndex >= _bufferLength) _readIndex = 0;
-                }
+                _primed = false;
             }
-            _frameCount++;
             return count;
         }
 
@@ -159,7 +195,7 @@ namespace Spect.Net.Wpf.Providers
         {
             _waveOut = new WaveOut
             {
-                DesiredLatency = 100,
+                DesiredLatency = DEVICE_LATENCY,
             };
             _waveOut.Init(this);
             _waveOut.Volume = 1.0F;
@@ -0,0 +1,60 @@
+﻿using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Shouldly;
+using Spect.Net.Assembler.Assembler;
+using Spect.Net.Assembler.Test.Benchmark;
+
+namespace Spect.Net.Assembler.Test.Assembler
+{
+    [TestClass]
+    public class AssemblerStatisticsTests
+    {
+        [TestMethod]
+        public void StatisticsCountLinesAndFixups()
+        {
+            // --- Arrange
+            var compiler = new Z80Assembler();
+
+            // --- Act
+            var output = compiler.Compile(SyntheticSourceGenerator.InstructionHeavy(64));
+
+            // --- Assert
+            output.ErrorCount.ShouldBe(0);
+            var stats = output.Statistics;
+            stats.SourceLines.ShouldBe(65);
+            stats.ParsedFiles.ShouldBe(1);
+            stats.FixupsRecorded.ShouldBeGreaterThan(0);
+            stats.EmittedBytes.ShouldBe(output.Segments[0].EmittedCode.Count);
+            stats.MacrosExpanded.ShouldBe(0);
+            stats.TotalTime.ShouldBeGreaterThanOrEqualTo(stats.ParseTime);
+        }
+
+        [TestMethod]
+        public void StatisticsCountMacroExpansions()
+        {
+            // --- Arrange
+            var compiler = new Z80Assembler();
+
+            // --- Act
+            var output = compiler.Compile(SyntheticSourceGenerator.MacroHeavy(10));
+
+            // --- Assert
+            output.ErrorCount.ShouldBe(0);
+            output.Statistics.MacrosExpanded.ShouldBe(10);
+        }
+
+        [TestMethod]
+        public void StatisticsCountStructInvocations()
+        {
+            // --- Arrange
+            var compiler = new Z80Assembler();
+
+            // --- Act
+            var output = compiler.Compile(SyntheticSourceGenerator.StructHeavy(6));
+
+            // --- Assert
+            output.ErrorCount.ShouldBe(0);
+            output.Statistics.StructsInvoked.ShouldBe(6);
+            output.Statistics.EmittedBytes.ShouldBe(2 * 14 + 4 * 4);
+        }
+    }
+}
@@ -0,0 +1,125 @@
+﻿using System;
+using System.IO;
+using System.Linq;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Shouldly;
+using Spect.Net.Assembler.Assembler;
+
+namespace Spect.Net.Assembler.Test.Benchmark
+{
+    /// <summary>
+    /// Assembler throughput benchmarks over synthetic sources.
+    /// </summary>
+    /// <remarks>
+    /// Run them with the "Benchmark" test category filter. The size of the
+    /// generated sources can be set with the SPECTNET_ASM_BENCH_SIZE
+    /// environment variable, the number of measured iterations with
+    /// SPECTNET_ASM_BENCH_ITERATIONS.
+    /// </remarks>
+    [TestClass]
+    public class AssemblerBenchmarkTests
+    {
+        private const string SIZE_VAR = "SPECTNET_ASM_BENCH_SIZE";
+        private const string ITERATIONS_VAR = "SPECTNET_ASM_BENCH_ITERATIONS";
+        private const int DEFAULT_SIZE = 20000;
+        private const int DEFAULT_ITERATIONS = 5;
+        private const int INCLUDE_FILES = 50;
+
+        [TestMethod]
+        [TestCategory("Benchmark")]
+        public void InstructionHeavyBenchmark()
+        {
+            RunBenchmark(SyntheticSourceKind.InstructionHeavy);
+        }
+
+        [TestMethod]
+        [TestCategory("Benchmark")]
+        public void MacroHeavyBenchmark()
+        {
+            RunBenchmark(SyntheticSourceKind.MacroHeavy);
+        }
+
+        [TestMethod]
+        [TestCategory("Benchmark")]
+        public void StructHeavyBenchmark()
+        {
+            RunBenchmark(SyntheticSourceKind.StructHeavy);
+        }
+
+        [TestMethod]
+        [TestCategory("Benchmark")]
+        public void IncludeHeavyBenchmark()
+        {
+            RunBenchmark(SyntheticSourceKind.IncludeHeavy);
+        }
+
+        /// <summary>
+        /// Compiles the generated source once for warm-up, then the
+        /// configured number of times, and prints the phase statistics
+        /// </summary>
+        private static void RunBenchmark(SyntheticSourceKind kind)
+        {
+            // --- Arrange
+            var size = GetSetting(SIZE_VAR, DEFAULT_SIZE);
+            var iterations = GetSetting(ITERATIONS_VAR, DEFAULT_ITERATIONS);
+            var folder = Path.Combine(Path.GetTempPath(), "SpectNetAsmBench", Guid.NewGuid().ToString("N"));
+            AppDomain.MonitoringIsEnabled = true;
+
+            try
+            {
+                Func<AssemblerOutput> compile;
+                switch (kind)
+                {
+                    case SyntheticSourceKind.MacroHeavy:
+                        var macroSource = SyntheticSourceGenerator.MacroHeavy(size);
+                        compile = () => new Z80Assembler().Compile(macroSource);
+                        break;
+                    case SyntheticSourceKind.StructHeavy:
+                        var structSource = SyntheticSourceGenerator.StructHeavy(size);
+                        compile = () => new Z80Assembler().Compile(structSource);
+                        break;
+                    case SyntheticSourceKind.IncludeHeavy:
+                        var mainFile = SyntheticSourceGenerator.IncludeHeavy(folder, size, INCLUDE_FILES);
+                        compile = () => new Z80Assembler().CompileFile(mainFile);
+                        break;
+                    default:
+                        var source = SyntheticSourceGenerator.InstructionHeavy(size);
+                        compile = () => new Z80Assembler().Compile(source);
+                        break;
+                }
+
+                // --- Act
+                compile().ErrorCount.ShouldBe(0);
+                var results = Enumerable.Range(0, iterations)
+                    .Select(i => compile().Statistics)
+                    .ToList();
+
+                // --- Report
+                Console.WriteLine($"{kind}, size: {size}, iterations: {iterations}");
+                foreach (var stats in results)
+                {
+                    Console.WriteLine(stats);
+                }
+                var best = results.OrderBy(s => s.TotalTime).First();
+                Console.WriteLine($"Best: {best.TotalTime.TotalMilliseconds:F2}ms, "
+                    + $"{best.SourceLines / best.TotalTime.TotalSeconds:F0} lines/s");
+            }
+            finally
+            {
+                if (Directory.Exists(folder))
+                {
+                    Directory.Delete(folder, true);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Gets an integer setting from an environment variable
+        /// </summary>
+        private static int GetSetting(string name, int defaultValue)
+        {
+            var value = Environment.GetEnvironmentVariable(name);
+            return int.TryParse(value, out var result) && result > 0 ? result : defaultValue;
+        }
+    }
+}
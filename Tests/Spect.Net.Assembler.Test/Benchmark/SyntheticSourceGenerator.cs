@@ -0,0 +1,189 @@
+﻿using System;
+using System.IO;
+using System.Text;
+
+namespace Spect.Net.Assembler.Test.Benchmark
+{
+    /// <summary>
+    /// The shapes of synthetic source code the generator can create
+    /// </summary>
+    public enum SyntheticSourceKind
+    {
+        InstructionHeavy,
+        MacroHeavy,
+        StructHeavy,
+        IncludeHeavy
+    }
+
+    /// <summary>
+    /// Generates deterministic synthetic Z80 assembly sources of configurable
+    /// size for assembler benchmarks
+    /// </summary>
+    public static class SyntheticSourceGenerator
+    {
+        /// <summary>
+        /// Number of source lines after which a new .org segment is started,
+        /// so that large sources do not overflow the 64K address space
+        /// </summary>
+        private const int LINES_PER_SEGMENT = 4096;
+
+        /// <summary>
+        /// Number of source lines between two labels
+        /// </summary>
+        private const int LINES_PER_LABEL = 16;
+
+        private static readonly string[] s_Instructions =
+        {
+            "ld a,b",
+            "ld hl,#4000",
+            "add a,(hl)",
+            "inc de",
+            "ld (ix+#12),a",
+            "sub c",
+            "rlc (iy-3)",
+            "ex de,hl",
+            "ld bc,{0}",
+            "push hl",
+            "pop hl",
+            "and #0f",
+            "jp nz,{0}",
+            "djnz {1}",
+            "ld (#6000),hl",
+            "out (#fe),a"
+        };
+
+        /// <summary>
+        /// Creates a source that consists of plain Z80 instructions with
+        /// forward and backward label references
+        /// </summary>
+        /// <param name="lines">Approximate number of source lines</param>
+        public static string InstructionHeavy(int lines)
+        {
+            var sb = new StringBuilder(lines * 20);
+            AppendInstructions(sb, lines, "L");
+            return sb.ToString();
+        }
+
+        /// <summary>
+        /// Creates a source that defines a few macros and invokes them
+        /// with different arguments
+        /// </summary>
+        /// <param name="invocations">Number of macro invocations</param>
+        public static string MacroHeavy(int invocations)
+        {
+            var sb = new StringBuilder(invocations * 24);
+            sb.AppendLine("LdAndAdd: .macro(reg, value)");
+            sb.AppendLine("  ld {{reg}},{{value}}");
+            sb.AppendLine("  add a,{{reg}}");
+            sb.AppendLine(".endm");
+            sb.AppendLine("Fill: .macro(addr, count)");
+            sb.AppendLine("  ld hl,{{addr}}");
+            sb.AppendLine("  ld b,{{count}}");
+            sb.AppendLine("  ld (hl),a");
+            sb.AppendLine("  inc hl");
+            sb.AppendLine("  djnz $-2");
+            sb.AppendLine(".endm");
+            sb.AppendLine(".org #8000");
+            var regs = new[] { "b", "c", "d", "e" };
+            for (var i = 0; i < invocations; i++)
+            {
+                if (i > 0 && i % (LINES_PER_SEGMENT / 4) == 0)
+                {
+                    sb.AppendLine(".org #8000");
+                }
+                sb.AppendLine(i % 2 == 0
+                    ? $"  LdAndAdd({regs[i % regs.Length]}, {i & 0xFF})"
+                    : $"  Fill(#{0x4000 + (i & 0x0FFF):X4}, {1 + i % 32})");
+            }
+            return sb.ToString();
+        }
+
+        /// <summary>
+        /// Creates a source that defines structures and invokes them
+        /// </summary>
+        /// <param name="invocations">Number of structure invocations</param>
+        public static string StructHeavy(int invocations)
+        {
+            var sb = new StringBuilder(invocations * 16);
+            sb.AppendLine("Point: .struct");
+            sb.AppendLine("  .defw 0");
+            sb.AppendLine("  .defw 0");
+            sb.AppendLine(".ends");
+            sb.AppendLine("Sprite: .struct");
+            sb.AppendLine("  .defb 0, 0, 0, 0");
+            sb.AppendLine("  .defw #4000");
+            sb.AppendLine("  .defs 8");
+            sb.AppendLine(".ends");
+            sb.AppendLine(".org #8000");
+            for (var i = 0; i < invocations; i++)
+            {
+                if (i > 0 && i % LINES_PER_SEGMENT == 0)
+                {
+                    sb.AppendLine(".org #8000");
+                }
+                sb.AppendLine(i % 3 == 0 ? "  Sprite()" : "  Point()");
+            }
+            return sb.ToString();
+        }
+
+        /// <summary>
+        /// Writes a source into the specified folder that includes a number of
+        /// other generated files
+        /// </summary>
+        /// <param name="folder">Folder to write the files into</param>
+        /// <param name="lines">Approximate number of source lines altogether</param>
+        /// <param name="files">Number of included files</param>
+        /// <returns>The full path of the main file to compile</returns>
+        public static string IncludeHeavy(string folder, int lines, int files)
+        {
+            if (files < 1)
+            {
+                throw new ArgumentOutOfRangeException(nameof(files));
+            }
+            Directory.CreateDirectory(folder);
+            var main = new StringBuilder();
+            var linesPerFile = Math.Max(1, lines / files);
+            for (var i = 0; i < files; i++)
+            {
+                var incName = $"inc{i:D4}.z80asm";
+                var inc = new StringBuilder(linesPerFile * 20);
+                AppendInstructions(inc, linesPerFile, $"F{i}L");
+                File.WriteAllText(Path.Combine(folder, incName), inc.ToString());
+                main.AppendLine($"#include \"{incName}\"");
+            }
+            var mainFile = Path.Combine(folder, "main.z80asm");
+            File.WriteAllText(mainFile, main.ToString());
+            return mainFile;
+        }
+
+        /// <summary>
+        /// Appends the specified number of instruction lines to the source
+        /// </summary>
+        private static void AppendInstructions(StringBuilder sb, int lines, string labelPrefix)
+        {
+            sb.AppendLine(".org #8000");
+            for (var i = 0; i < lines; i++)
+            {
+                if (i > 0 && i % LINES_PER_SEGMENT == 0)
+                {
+                    sb.AppendLine(".org #8000");
+                }
+                var labelIndex = i / LINES_PER_LABEL;
+                if (i % LINES_PER_LABEL == 0)
+                {
+                    sb.Append($"{labelPrefix}{labelIndex}: ");
+                }
+                else
+                {
+                    sb.Append("  ");
+                }
+
+                // --- {0}: forward reference, {1}: reference to the current label
+                var lastLabel = (lines - 1) / LINES_PER_LABEL;
+                var forward = $"{labelPrefix}{Math.Min(labelIndex + 1, lastLabel)}";
+                var current = $"{labelPrefix}{labelIndex}";
+                sb.AppendLine(string.Format(s_Instructions[i % s_Instructions.Length], forward, current));
+            }
+        }
+    }
+}
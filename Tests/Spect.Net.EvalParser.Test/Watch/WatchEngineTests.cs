@@ -0,0 +1,249 @@
+﻿using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Shouldly;
+using Spect.Net.EvalParser.SyntaxTree;
+using Spect.Net.EvalParser.Watch;
+
+namespace Spect.Net.EvalParser.Test.Watch
+{
+    [TestClass]
+    public class WatchEngineTests: ParserTestBed
+    {
+        [TestMethod]
+        public void DependenciesContainRegistersAndFlags()
+        {
+            // --- Act
+            var deps = ExpressionDependencies.Collect(ParseExpr("`z ? hl + 1 : a"));
+
+            // --- Assert
+            deps.Registers.ShouldBe(new[] { "hl", "a" }, true);
+            deps.Flags.ShouldBe(new[] { "`z" });
+            deps.MemoryAddresses.Count.ShouldBe(0);
+            deps.HasComputedAddresses.ShouldBeFalse();
+            deps.IsConstant.ShouldBeFalse();
+        }
+
+        [TestMethod]
+        [DataRow("[#4000]", 1)]
+        [DataRow("[#4000 + 2 :b]", 1)]
+        [DataRow("[#4000:w]", 2)]
+        [DataRow("[#4000:dw]", 4)]
+        public void DependenciesContainConstantMemoryAddresses(string source, int count)
+        {
+            // --- Act
+            var deps = ExpressionDependencies.Collect(ParseExpr(source));
+
+            // --- Assert
+            deps.MemoryAddresses.Count.ShouldBe(count);
+            deps.HasComputedAddresses.ShouldBeFalse();
+        }
+
+        [TestMethod]
+        public void DependenciesSignComputedAddresses()
+        {
+            // --- Act
+            var deps = ExpressionDependencies.Collect(ParseExpr("[hl + 2]"));
+
+            // --- Assert
+            deps.Registers.ShouldBe(new[] { "hl" });
+            deps.MemoryAddresses.Count.ShouldBe(0);
+            deps.HasComputedAddresses.ShouldBeTrue();
+        }
+
+        [TestMethod]
+        public void FirstEvaluationPublishesAllValues()
+        {
+            // --- Arrange
+            var context = new Z80TestEvaluationContext();
+            context.SetHL(0x1234);
+            var engine = new WatchEngine(context);
+            var id1 = engine.Add(ParseExpr("hl"));
+            var id2 = engine.Add(ParseExpr("3 + 4"));
+
+            // --- Act
+            var changes = engine.Evaluate();
+
+            // --- Assert
+            changes.Count.ShouldBe(2);
+            changes[0].Id.ShouldBe(id1);
+            changes[0].Value.Value.ShouldBe(0x1234u);
+            changes[1].Id.ShouldBe(id2);
+            changes[1].Value.Value.ShouldBe(7u);
+        }
+
+        [TestMethod]
+        public void UnchangedDependenciesSkipEvaluation()
+        {
+            // --- Arrange
+            var context = new Z80TestEvaluationContext();
+            context.SetHL(0x1234);
+            context.SetBC(0x0010);
+            var engine = new WatchEngine(context);
+            engine.Add(ParseExpr("hl"));
+            var id2 = engine.Add(ParseExpr("bc * 2"));
+            engine.Evaluate();
+
+            // --- Act
+            context.SetBC(0x0020);
+            var changes = engine.Evaluate();
+
+            // --- Assert
+            engine.LastEvaluatedCount.ShouldBe(1);
+            engine.LastSkippedCount.ShouldBe(1);
+            changes.Count.ShouldBe(1);
+            changes[0].Id.ShouldBe(id2);
+            changes[0].Value.Value.ShouldBe(0x40u);
+        }
+
+        [TestMethod]
+        public void SameValueIsNotPublished()
+        {
+            // --- Arrange
+            var context = new Z80TestEvaluationContext();
+            context.SetHL(0x1234);
+            var engine = new WatchEngine(context);
+            engine.Add(ParseExpr("h"));
+            engine.Evaluate();
+
+            // --- Act
+            context.SetL(0x56);
+            var changes = engine.Evaluate();
+
+            // --- Assert
+            engine.LastEvaluatedCount.ShouldBe(0);
+            changes.Count.ShouldBe(0);
+        }
+
+        [TestMethod]
+        public void ConstantMemoryChangeIsDetected()
+        {
+            // --- Arrange
+            var context = new Z80TestEvaluationContext();
+            context.Memory[0x4000] = 0x12;
+            context.Memory[0x4001] = 0x34;
+            var engine = new WatchEngine(context);
+            engine.Add(ParseExpr("[#4000:w]"));
+            engine.Evaluate();
+
+            // --- Act
+            context.Memory[0x4002] = 0xFF;
+            var unchanged = engine.Evaluate();
+            context.Memory[0x4001] = 0x56;
+            var changes = engine.Evaluate();
+
+            // --- Assert
+            unchanged.Count.ShouldBe(0);
+            changes.Count.ShouldBe(1);
+            changes[0].Value.Value.ShouldBe(0x5612u);
+        }
+
+        [TestMethod]
+        public void ComputedMemoryChangeIsDetected()
+        {
+            // --- Arrange
+            var context = new Z80TestEvaluationContext();
+            context.SetHL(0x8000);
+            context.Memory[0x8001] = 0x23;
+            var engine = new WatchEngine(context);
+            engine.Add(ParseExpr("[hl + 1]"));
+            var first = engine.Evaluate();
+
+            // --- Act
+            context.Memory[0x8000] = 0xFF;
+            var unchanged = engine.Evaluate();
+            context.Memory[0x8001] = 0x24;
+            var changes = engine.Evaluate();
+
+            // --- Assert
+            first[0].Value.Value.ShouldBe(0x23u);
+            unchanged.Count.ShouldBe(0);
+            changes.Count.ShouldBe(1);
+            changes[0].Value.Value.ShouldBe(0x24u);
+        }
+
+        [TestMethod]
+        public void InvalidateForcesEvaluation()
+        {
+            // --- Arrange
+            var context = new Z80TestEvaluationContext();
+            var engine = new WatchEngine(context);
+            engine.Add(ParseExpr("MySymbol"));
+            var first = engine.Evaluate();
+
+            // --- Act
+            context.AddSymbol("MySymbol", 0x1000);
+            var unchanged = engine.Evaluate();
+            engine.Invalidate();
+            var changes = engine.Evaluate();
+
+            // --- Assert
+            first[0].HasError.ShouldBeTrue();
+            unchanged.Count.ShouldBe(0);
+            changes.Count.ShouldBe(1);
+            changes[0].HasError.ShouldBeFalse();
+            changes[0].Value.Value.ShouldBe(0x1000u);
+        }
+
+        [TestMethod]
+        public void ChangesArePublishedInBatch()
+        {
+            // --- Arrange
+            var context = new Z80TestEvaluationContext();
+            var engine = new WatchEngine(context);
+            engine.Add(ParseExpr("a"));
+            engine.Add(ParseExpr("b"));
+            engine.Evaluate();
+            var raised = 0;
+            WatchValuesChangedEventArgs args = null;
+            engine.ValuesChanged += (s, e) =>
+            {
+                raised++;
+                args = e;
+            };
+
+            // --- Act
+            context.SetA(1);
+            context.SetB(2);
+            engine.Evaluate(1000);
+            engine.Evaluate(2000);
+
+            // --- Assert
+            raised.ShouldBe(1);
+            args.Tacts.ShouldBe(1000);
+            args.Changes.Count.ShouldBe(2);
+        }
+
+        [TestMethod]
+        public void TactIntervalSchedulesNextEvaluation()
+        {
+            // --- Arrange
+            var engine = new WatchEngine(new Z80TestEvaluationContext());
+            engine.NextEvaluationTact.ShouldBe(long.MaxValue);
+
+            // --- Act
+            engine.TactInterval = 10_000;
+            var due = engine.NextEvaluationTact;
+            engine.Evaluate(5000);
+
+            // --- Assert
+            due.ShouldBe(0);
+            engine.NextEvaluationTact.ShouldBe(15_000);
+        }
+
+        [TestMethod]
+        public void RemovedExpressionIsNotEvaluated()
+        {
+            // --- Arrange
+            var engine = new WatchEngine(new Z80TestEvaluationContext());
+            var id = engine.Add(ParseExpr("a"));
+
+            // --- Act
+            var removed = engine.Remove(id);
+            var changes = engine.Evaluate();
+
+            // --- Assert
+            removed.ShouldBeTrue();
+            engine.Count.ShouldBe(0);
+            changes.Count.ShouldBe(0);
+        }
+    }
+}
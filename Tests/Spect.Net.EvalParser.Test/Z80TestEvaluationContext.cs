@@ -50,6 +50,8 @@ namespace Spect.Net.EvalParser.Test
         public bool Nf;
         public bool Cf;
 
+        public readonly byte[] Memory = new byte[0x1_0000];
+
         /// <summary>
         /// Gets the value of the specified symbol
         /// </summary>
@@ -156,7 +158,19 @@ namespace Spect.Net.EvalParser.Test
         /// <returns>Z80 register value</returns>
         public ExpressionValue GetZ80FlagValue(string flagName)
         {
-            throw new System.NotImplementedException();
+            switch (flagName.Substring(1).ToLower())
+            {
+                case "z":
+                    return new ExpressionValue(Zf);
+                case "nz":
+                    return new ExpressionValue(!Zf);
+                case "c":
+                    return new ExpressionValue(Cf);
+                case "nc":
+                    return new ExpressionValue(!Cf);
+                default:
+                    return ExpressionValue.Error;
+            }
         }
 
         /// <summary>
@@ -166,7 +180,7 @@ namespace Spect.Net.EvalParser.Test
         /// <returns>Z80 register value</returns>
         public ExpressionValue GetMemoryIndirectValue(ExpressionValue address)
         {
-            throw new System.NotImplementedException();
+            return new ExpressionValue(Memory[(ushort)address.Value]);
         }
 
         public void SetA(byte value)
@@ -0,0 +1,108 @@
+﻿using System.Linq;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Shouldly;
+using Spect.Net.SpectrumEmu.Basic;
+
+namespace Spect.Net.SpectrumEmu.Test.Basic
+{
+    [TestClass]
+    public class BasicProgramDecoderTests
+    {
+        private const ushort PROG_START = 0x5CCB;
+
+        private static readonly byte[] s_Program =
+        {
+            0x00, 0x0A, 0x06, 0x00,                   // 10
+            0xF5, 0x22, 0x48, 0x49, 0x22, 0x0D,       // PRINT "HI"
+            0x00, 0x14, 0x0A, 0x00,                   // 20
+            0xEC, 0x31, 0x30, 0x0E, 0x00, 0x00, 0x0A, // GO TO 10
+            0x00, 0x00, 0x0D,
+            0x00, 0x1E, 0x06, 0x00,                   // 30
+            0xFA, 0x41, 0xCB, 0xE2, 0x10, 0x0D        // IF A THEN STOP (INK control)
+        };
+
+        [TestMethod]
+        public void DecodeProgramUsesSystemVariables()
+        {
+            // --- Arrange
+            var memory = CreateMemory();
+            var decoder = new BasicProgramDecoder();
+
+            // --- Act
+            var lines = decoder.DecodeProgram(memory).ToList();
+
+            // --- Assert
+            lines.Select(l => l.LineNo).ShouldBe(new[] { 10, 20, 30 });
+            lines[0].Offset.ShouldBe(PROG_START);
+            lines[1].Length.ShouldBe(10);
+            decoder.FormatLine(memory, lines[0]).ShouldBe("PRINT \"HI\"");
+            decoder.FormatLine(memory, lines[1]).ShouldBe("GO TO 10");
+            decoder.FormatLine(memory, lines[2]).ShouldBe("IF A THEN STOP °10°");
+        }
+
+        [TestMethod]
+        public void DecodeLinesWorksOnTapeData()
+        {
+            // --- Arrange
+            var data = new byte[s_Program.Length + 2];
+            s_Program.CopyTo(data, 1);
+            var decoder = new BasicProgramDecoder();
+
+            // --- Act
+            var lines = decoder.DecodeLines(data, 1, data.Length - 1).ToList();
+
+            // --- Assert
+            lines.Count.ShouldBe(3);
+            decoder.FormatLine(data, lines[1]).ShouldBe("GO TO 10");
+        }
+
+        [TestMethod]
+        public void MissingProgramHasNoLines()
+        {
+            // --- Arrange
+            var decoder = new BasicProgramDecoder();
+
+            // --- Act
+            var lines = decoder.DecodeProgram(new byte[0x10000]).ToList();
+
+            // --- Assert
+            lines.Count.ShouldBe(0);
+        }
+
+        [TestMethod]
+        public void ListingRefreshesChangedLinesOnly()
+        {
+            // --- Arrange
+            var memory = CreateMemory();
+            var listing = new BasicListing();
+
+            // --- Act
+            var firstChanges = listing.Refresh(memory);
+            var firstText = listing.GetText(1);
+            var unchanged = listing.Refresh(memory);
+            memory[PROG_START + 15] = 0x32; // GO TO 20
+            var changed = listing.Refresh(memory);
+
+            // --- Assert
+            firstChanges.ShouldBe(3);
+            firstText.ShouldBe("GO TO 10");
+            unchanged.ShouldBe(0);
+            changed.ShouldBe(1);
+            listing.Lines.Count.ShouldBe(3);
+            listing.GetText(0).ShouldBe("PRINT \"HI\"");
+            listing.GetText(1).ShouldBe("GO TO 20");
+        }
+
+        private static byte[] CreateMemory()
+        {
+            var memory = new byte[0x10000];
+            s_Program.CopyTo(memory, PROG_START);
+            var progEnd = PROG_START + s_Program.Length;
+            memory[0x5C53] = PROG_START & 0xFF;
+            memory[0x5C54] = PROG_START >> 8;
+            memory[0x5C4B] = (byte)(progEnd & 0xFF);
+            memory[0x5C4C] = (byte)(progEnd >> 8);
+            return memory;
+        }
+    }
+}
@@ -0,0 +1,200 @@
+﻿using System;
+using System.Linq;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Shouldly;
+using Spect.Net.SpectrumEmu.Abstraction.Devices;
+using Spect.Net.SpectrumEmu.Basic;
+using Spect.Net.SpectrumEmu.Test.Helpers;
+using Spect.Net.SpectrumEmu.Utility;
+
+namespace Spect.Net.SpectrumEmu.Test.Basic
+{
+    [TestClass]
+    public class BasicTokenizerTests
+    {
+        private const ushort PROG_START = 0x5CCB;
+
+        [TestMethod]
+        public void TokenizeLineCreatesRomFormat()
+        {
+            // --- Arrange
+            var tokenizer = new BasicTokenizer();
+
+            // --- Act
+            var line = tokenizer.TokenizeLine("20 go to 10");
+
+            // --- Assert
+            line.ShouldBe(new byte[]
+            {
+                0x00, 0x14, 0x0A, 0x00,
+                0xEC, 0x31, 0x30, 0x0E, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x0D
+            });
+        }
+
+        [TestMethod]
+        public void TokenizeProgramRoundTripsThroughDecoder()
+        {
+            // --- Arrange
+            var tokenizer = new BasicTokenizer();
+            const string SOURCE = "30 IF total>=5 THEN STOP\n"
+                + "10 PRINT \"GO TO\";a$\n"
+                + "20 REM print this as it is\n"
+                + "\n"
+                + "40 LET x=BIN 101: GOTO 10\n";
+
+            // --- Act
+            var program = tokenizer.TokenizeProgram(SOURCE);
+
+            // --- Assert
+            var decoder = new BasicProgramDecoder();
+            var lines = decoder.DecodeLines(program, 0, program.Length).ToList();
+            lines.Select(l => l.LineNo).ShouldBe(new[] { 10, 20, 30, 40 });
+            lines.First().Offset.ShouldBe(0);
+            lines.Last().EndOffset.ShouldBe(program.Length);
+            decoder.FormatLine(program, lines[0]).ShouldBe("PRINT \"GO TO\";a$");
+            decoder.FormatLine(program, lines[1]).ShouldBe("REM print this as it is");
+            decoder.FormatLine(program, lines[2]).ShouldBe("IF total >=5 THEN STOP ");
+            decoder.FormatLine(program, lines[3]).ShouldBe("LET x= BIN 101: GO TO 10");
+        }
+
+        [TestMethod]
+        public void BinNumberUsesBinaryValue()
+        {
+            // --- Arrange
+            var tokenizer = new BasicTokenizer();
+
+            // --- Act
+            var line = tokenizer.TokenizeLine("1 PRINT BIN 101");
+
+            // --- Assert
+            line.Skip(6).ShouldBe(new byte[] { 0x31, 0x30, 0x31, 0x0E, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0D });
+        }
+
+        [TestMethod]
+        [DataRow("1 LET x10=1", "x10=")]
+        [DataRow("1 LET a1b22=1", "a1b22=")]
+        public void DigitsWithinNameAreNotNumbers(string source, string name)
+        {
+            // --- Arrange
+            var tokenizer = new BasicTokenizer();
+
+            // --- Act
+            var line = tokenizer.TokenizeLine(source);
+
+            // --- Assert
+            line.Skip(5).Take(name.Length).ShouldBe(name.Select(c => (byte)c));
+            line.Count(b => b == BasicTokens.NUMBER_MARKER).ShouldBe(1);
+        }
+
+        [TestMethod]
+        public void ForLoopWithNumberedNameKeepsKeywords()
+        {
+            // --- Arrange
+            var tokenizer = new BasicTokenizer();
+
+            // --- Act
+            var line = tokenizer.TokenizeLine("1 FOR i1=1 TO 10");
+
+            // --- Assert
+            line.Skip(4).ShouldBe(new byte[]
+            {
+                0xEB, 0x69, 0x31, 0x3D,
+                0x31, 0x0E, 0x00, 0x00, 0x01, 0x00, 0x00,
+                0xCC,
+                0x31, 0x30, 0x0E, 0x00, 0x00, 0x0A, 0x00, 0x00,
+                0x0D
+            });
+        }
+
+        [TestMethod]
+        public void LaterLineReplacesEarlierOne()
+        {
+            // --- Arrange
+            var tokenizer = new BasicTokenizer();
+
+            // --- Act
+            var program = tokenizer.TokenizeProgram("10 CLS\n10 STOP");
+
+            // --- Assert
+            program.ShouldBe(new byte[] { 0x00, 0x0A, 0x02, 0x00, 0xE2, 0x0D });
+        }
+
+        [TestMethod]
+        public void LineWithoutNumberFails()
+        {
+            // --- Arrange
+            var tokenizer = new BasicTokenizer();
+
+            // --- Act/Assert
+            Should.Throw<FormatException>(() => tokenizer.TokenizeLine("PRINT 1"));
+            Should.Throw<FormatException>(() => tokenizer.TokenizeLine("10000 PRINT 1"));
+        }
+
+        [TestMethod]
+        public void ToBytesCreatesSpectrumNumbers()
+        {
+            FloatNumber.ToBytes(10).ShouldBe(new byte[] { 0x00, 0x00, 0x0A, 0x00, 0x00 });
+            FloatNumber.ToBytes(-1).ShouldBe(new byte[] { 0x00, 0xFF, 0xFF, 0xFF, 0x00 });
+            FloatNumber.ToBytes(0.5).ShouldBe(new byte[] { 0x80, 0x00, 0x00, 0x00, 0x00 });
+            FloatNumber.ToBytes(-0.5).ShouldBe(new byte[] { 0x80, 0x80, 0x00, 0x00, 0x00 });
+            FloatNumber.ToBytes(65536).ShouldBe(new byte[] { 0x91, 0x00, 0x00, 0x00, 0x00 });
+            FloatNumber.FromBytes(FloatNumber.ToBytes(3.25)).ShouldBe(3.25f);
+        }
+
+        [TestMethod]
+        public void LoaderSetsSystemVariables()
+        {
+            // --- Arrange
+            var machine = new SpectrumAdvancedTestMachine();
+            var memory = machine.MemoryDevice;
+            WriteWord(memory, 0x5C53, PROG_START); // PROG
+            WriteWord(memory, 0x5CB2, 0xFF57);     // RAMTOP
+            var program = new BasicTokenizer().TokenizeProgram("10 PRINT 1");
+
+            // --- Act
+            var vars = BasicProgramLoader.Load(memory, program);
+
+            // --- Assert
+            vars.ShouldBe((ushort)(PROG_START + program.Length));
+            for (var i = 0; i < program.Length; i++)
+            {
+                memory.Read((ushort)(PROG_START + i), true).ShouldBe(program[i]);
+            }
+            memory.Read(vars, true).ShouldBe((byte)0x80);
+            memory.Read((ushort)(vars + 1), true).ShouldBe((byte)0x0D);
+            memory.Read((ushort)(vars + 2), true).ShouldBe((byte)0x80);
+            ReadWord(memory, 0x5C4B).ShouldBe(vars);                 // VARS
+            ReadWord(memory, 0x5C59).ShouldBe((ushort)(vars + 1));   // E_LINE
+            ReadWord(memory, 0x5C5B).ShouldBe((ushort)(vars + 1));   // K_CUR
+            ReadWord(memory, 0x5C61).ShouldBe((ushort)(vars + 3));   // WORKSP
+            ReadWord(memory, 0x5C63).ShouldBe((ushort)(vars + 3));   // STKBOT
+            ReadWord(memory, 0x5C65).ShouldBe((ushort)(vars + 3));   // STKEND
+            ReadWord(memory, 0x5C57).ShouldBe((ushort)(PROG_START - 1)); // DATADD
+            var decoder = new BasicProgramDecoder();
+            decoder.DecodeProgram(memory.CloneMemory()).Single().LineNo.ShouldBe(10);
+        }
+
+        [TestMethod]
+        public void LoaderRejectsProgramAboveRamtop()
+        {
+            // --- Arrange
+            var machine = new SpectrumAdvancedTestMachine();
+            var memory = machine.MemoryDevice;
+            WriteWord(memory, 0x5C53, PROG_START); // PROG
+            WriteWord(memory, 0x5CB2, 0x5D00);     // RAMTOP
+
+            // --- Act/Assert
+            Should.Throw<InvalidOperationException>(() =>
+                BasicProgramLoader.Load(memory, new byte[0x40]));
+        }
+
+        private static void WriteWord(IMemoryDevice memory, ushort addr, ushort value)
+        {
+            memory.Write(addr, (byte)value, true);
+            memory.Write((ushort)(addr + 1), (byte)(value >> 8), true);
+        }
+
+        private static ushort ReadWord(IMemoryDevice memory, ushort addr)
+            => (ushort)(memory.Read(addr, true) + memory.Read((ushort)(addr + 1), true) * 0x100);
+    }
+}
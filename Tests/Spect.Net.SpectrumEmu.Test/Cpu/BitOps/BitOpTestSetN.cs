@@ -27,7 +27,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // SET N,B
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.B = 0x00;
 
                 // --- Act
@@ -61,7 +61,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // SET N,B
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.B = 0x55;
 
                 // --- Act
@@ -95,7 +95,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // SET N,C
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.C = 0x00;
 
                 // --- Act
@@ -129,7 +129,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // SET N,C
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.C = 0x55;
 
                 // --- Act
@@ -163,7 +163,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // SET N,D
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.D = 0x00;
 
                 // --- Act
@@ -197,7 +197,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // SET N,D
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.D = 0x55;
 
                 // --- Act
@@ -231,7 +231,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // SET N,E
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.E = 0x00;
 
                 // --- Act
@@ -265,7 +265,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // SET N,E
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.E = 0x55;
 
                 // --- Act
@@ -299,7 +299,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // SET N,H
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.H = 0x00;
 
                 // --- Act
@@ -333,7 +333,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // SET N,H
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.H = 0x55;
 
                 // --- Act
@@ -367,7 +367,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // SET N,L
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.L = 0x00;
 
                 // --- Act
@@ -401,7 +401,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // SET N,L
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.L = 0x55;
 
                 // --- Act
@@ -435,7 +435,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // SET N,(HL)
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.HL = 0x1000;
                 m.Memory[regs.HL] = 0x00;
 
@@ -470,7 +470,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // SET N,(HL)
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.HL = 0x1000;
                 m.Memory[regs.HL] = 0x55;
 
@@ -505,7 +505,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // SET N,A
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.A = 0x00;
 
                 // --- Act
@@ -539,7 +539,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // SET N,A
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.A = 0x55;
 
                 // --- Act
@@ -21,7 +21,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x00 // RLC B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.B = 0x08;
 
             // --- Act
@@ -56,7 +56,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x00 // RLC B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.B = 0x84;
 
             // --- Act
@@ -91,7 +91,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x00 // RLC B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.B = 0x00;
 
             // --- Act
@@ -126,7 +126,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x00 // RLC B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.B = 0xC0;
 
             // --- Act
@@ -161,7 +161,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x01 // RLC C
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.C = 0x08;
 
             // --- Act
@@ -196,7 +196,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x02 // RLC D
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.D = 0x08;
 
             // --- Act
@@ -231,7 +231,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x03 // RLC E
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.E = 0x08;
 
             // --- Act
@@ -266,7 +266,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x04 // RLC H
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.H = 0x08;
 
             // --- Act
@@ -301,7 +301,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x05 // RLC L
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.L = 0x08;
 
             // --- Act
@@ -336,7 +336,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x06 // RLC (HL)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x1000;
             m.Memory[regs.HL] = 0x08;
 
@@ -372,7 +372,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x07 // RLC A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x08;
 
             // --- Act
@@ -407,7 +407,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x08 // RRC B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.B = 0x08;
 
             // --- Act
@@ -442,7 +442,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x08 // RRC B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.B = 0x85;
 
             // --- Act
@@ -477,7 +477,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x00 // RLC B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.B = 0x00;
 
             // --- Act
@@ -512,7 +512,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x08 // RRC B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.B = 0x41;
 
             // --- Act
@@ -547,7 +547,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x09 // RRC C
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.C = 0x08;
 
             // --- Act
@@ -582,7 +582,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x0A // RRC D
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.D = 0x08;
 
             // --- Act
@@ -617,7 +617,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x0B // RRC E
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.E = 0x08;
 
             // --- Act
@@ -652,7 +652,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x0C // RRC H
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.H = 0x08;
 
             // --- Act
@@ -687,7 +687,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x0D // RRC L
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.L = 0x08;
 
             // --- Act
@@ -722,7 +722,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x0E // RRC (HL)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x1000;
             m.Memory[regs.HL] = 0x08;
 
@@ -758,7 +758,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x0F // RRC A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x08;
 
             // --- Act
@@ -22,7 +22,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x10 // RL B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.B = 0x08;
 
             // --- Act
@@ -57,7 +57,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x10 // RL B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.B = 0x84;
 
             // --- Act
@@ -92,7 +92,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x10 // RL B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.B = 0x00;
 
             // --- Act
@@ -127,7 +127,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x10 // RL B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.B = 0xC0;
 
             // --- Act
@@ -162,7 +162,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x10 // RL B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.F |= FlagsSetMask.C;
             regs.B = 0xC0;
 
@@ -198,7 +198,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x11 // RL C
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.C = 0x08;
 
             // --- Act
@@ -233,7 +233,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x12 // RL D
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.D = 0x08;
 
             // --- Act
@@ -268,7 +268,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x13 // RL E
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.E = 0x08;
 
             // --- Act
@@ -303,7 +303,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x14 // RL H
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.H = 0x08;
 
             // --- Act
@@ -338,7 +338,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x15 // RL L
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.L = 0x08;
 
             // --- Act
@@ -373,7 +373,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x16 // RL (HL)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x1000;
             m.Memory[regs.HL] = 0x08;
 
@@ -409,7 +409,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x17 // RL A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x08;
 
             // --- Act
@@ -444,7 +444,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x18 // RR B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.B = 0x08;
 
             // --- Act
@@ -479,7 +479,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x18 // RR B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.B = 0x85;
 
             // --- Act
@@ -514,7 +514,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x18 // RR B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.B = 0x00;
 
             // --- Act
@@ -549,7 +549,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x18 // RR B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.F |= FlagsSetMask.C;
             regs.B = 0xC0;
 
@@ -585,7 +585,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x19 // RR C
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.C = 0x08;
 
             // --- Act
@@ -620,7 +620,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x1A // RR D
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.D = 0x08;
 
             // --- Act
@@ -655,7 +655,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x1B // RR E
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.E = 0x08;
 
             // --- Act
@@ -690,7 +690,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x1C // RR H
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.H = 0x08;
 
             // --- Act
@@ -725,7 +725,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x1D // RR L
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.L = 0x08;
 
             // --- Act
@@ -760,7 +760,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x1E // RR (HL)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x1000;
             m.Memory[regs.HL] = 0x08;
 
@@ -796,7 +796,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x1F // RR A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x08;
 
             // --- Act
@@ -22,7 +22,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x20 // SLA B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.B = 0x08;
 
             // --- Act
@@ -57,7 +57,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x20 // SLA B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.B = 0x88;
 
             // --- Act
@@ -92,7 +92,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x20 // SLA B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.B = 0x48;
 
             // --- Act
@@ -127,7 +127,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x20 // SLA B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.B = 0x80;
 
             // --- Act
@@ -162,7 +162,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x21 // SLA C
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.C = 0x08;
 
             // --- Act
@@ -197,7 +197,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x22 // SLA D
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.D = 0x08;
 
             // --- Act
@@ -232,7 +232,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x23 // SLA E
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.E = 0x08;
 
             // --- Act
@@ -267,7 +267,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x24 // SLA H
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.H = 0x08;
 
             // --- Act
@@ -302,7 +302,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x25 // SLA L
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.L = 0x08;
 
             // --- Act
@@ -337,7 +337,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x26 // SLA (HL)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x1000;
             m.Memory[regs.HL] = 0x08;
 
@@ -373,7 +373,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x27 // SLA A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x08;
 
             // --- Act
@@ -408,7 +408,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x28 // SRA B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.B = 0x10;
 
             // --- Act
@@ -443,7 +443,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x28 // SRA B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.B = 0x21;
 
             // --- Act
@@ -478,7 +478,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x28 // SRA B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.B = 0x01;
 
             // --- Act
@@ -513,7 +513,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x29 // SRA C
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.C = 0x10;
 
             // --- Act
@@ -548,7 +548,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x2A // SRA D
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.D = 0x10;
 
             // --- Act
@@ -583,7 +583,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x2B // SRA E
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.E = 0x10;
 
             // --- Act
@@ -618,7 +618,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x2C // SRA H
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.H = 0x10;
 
             // --- Act
@@ -653,7 +653,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x2D // SRA L
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.L = 0x10;
 
             // --- Act
@@ -688,7 +688,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x2E // SRA (HL)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x1000;
             m.Memory[regs.HL] = 0x10;
 
@@ -724,7 +724,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x2F // SRA A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x10;
 
             // --- Act
@@ -22,7 +22,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x30 // SLL B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.B = 0x08;
 
             // --- Act
@@ -57,7 +57,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x30 // SLL B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.B = 0x88;
 
             // --- Act
@@ -92,7 +92,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x30 // SLL B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.B = 0x48;
 
             // --- Act
@@ -127,7 +127,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x31 // SLL C
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.C = 0x08;
 
             // --- Act
@@ -162,7 +162,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x32 // SLL D
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.D = 0x08;
 
             // --- Act
@@ -197,7 +197,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x33 // SLL E
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.E = 0x08;
 
             // --- Act
@@ -232,7 +232,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x34 // SLL H
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.H = 0x08;
 
             // --- Act
@@ -267,7 +267,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x35 // SLL L
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.L = 0x08;
 
             // --- Act
@@ -302,7 +302,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x36 // SLL (HL)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x1000;
             m.Memory[regs.HL] = 0x08;
 
@@ -338,7 +338,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x37 // SLL A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x08;
 
             // --- Act
@@ -373,7 +373,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x38 // SRL B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.F |= FlagsSetMask.C;
             regs.B = 0x10;
 
@@ -409,7 +409,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x38 // SRL B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.F |= FlagsSetMask.C;
             regs.B = 0x21;
 
@@ -445,7 +445,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x38 // SRL B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.F |= FlagsSetMask.C;
             regs.B = 0x01;
 
@@ -481,7 +481,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x39 // SRL C
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.F |= FlagsSetMask.C;
             regs.C = 0x10;
 
@@ -517,7 +517,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x3A // SRL D
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.F |= FlagsSetMask.C;
             regs.D = 0x10;
 
@@ -553,7 +553,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x3B // SRL E
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.F |= FlagsSetMask.C;
             regs.E = 0x10;
 
@@ -589,7 +589,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x3C // SRL H
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.F |= FlagsSetMask.C;
             regs.H = 0x10;
 
@@ -625,7 +625,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x3D // SRL L
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.F |= FlagsSetMask.C;
             regs.L = 0x10;
 
@@ -661,7 +661,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x3E // SRL (HL)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.HL] = 0x10;
@@ -698,7 +698,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
             {
                 0xCB, 0x3F // SRL A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.F |= FlagsSetMask.C;
             regs.A = 0x10;
 
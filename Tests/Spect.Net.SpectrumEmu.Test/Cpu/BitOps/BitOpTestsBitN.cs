@@ -26,7 +26,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // BIT N,B
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.B = (byte)~(0x01 << n);
 
                 // --- Act
@@ -65,7 +65,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // BIT N,B
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.B = (byte)(0x01 << n);
 
                 // --- Act
@@ -104,7 +104,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // BIT N,C
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.C = (byte)~(0x01 << n);
 
                 // --- Act
@@ -143,7 +143,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // BIT N,C
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.C = (byte)(0x01 << n);
 
                 // --- Act
@@ -182,7 +182,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // BIT N,D
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.D = (byte)~(0x01 << n);
 
                 // --- Act
@@ -221,7 +221,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // BIT N,D
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.D = (byte)(0x01 << n);
 
                 // --- Act
@@ -260,7 +260,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // BIT N,E
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.E = (byte)~(0x01 << n);
 
                 // --- Act
@@ -299,7 +299,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // BIT N,E
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.E = (byte)(0x01 << n);
 
                 // --- Act
@@ -338,7 +338,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // BIT N,H
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.H = (byte)~(0x01 << n);
 
                 // --- Act
@@ -377,7 +377,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // BIT N,H
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.H = (byte)(0x01 << n);
 
                 // --- Act
@@ -416,7 +416,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // BIT N,L
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.L = (byte)~(0x01 << n);
 
                 // --- Act
@@ -455,7 +455,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // BIT N,L
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.L = (byte)(0x01 << n);
 
                 // --- Act
@@ -494,7 +494,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // BIT N,(HL)
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.HL = 0x1000;
                 m.Memory[regs.HL] = (byte)~(0x01 << n);
 
@@ -534,7 +534,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // BIT N,(HL)
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.HL = 0x1000;
                 m.Memory[regs.HL] = (byte)(0x01 << n);
 
@@ -574,7 +574,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // BIT N,A
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.A = (byte)~(0x01 << n);
 
                 // --- Act
@@ -613,7 +613,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // BIT N,A
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.A = (byte)(0x01 << n);
 
                 // --- Act
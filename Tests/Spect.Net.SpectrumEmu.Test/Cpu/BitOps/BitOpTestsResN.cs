@@ -27,7 +27,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // RES N,B
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.B = 0xFF;
 
                 // --- Act
@@ -61,7 +61,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // RES N,B
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.B = 0xAA;
 
                 // --- Act
@@ -95,7 +95,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // RES N,C
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.C = 0xFF;
 
                 // --- Act
@@ -129,7 +129,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // RES N,C
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.C = 0xAA;
 
                 // --- Act
@@ -163,7 +163,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // RES N,D
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.D = 0xFF;
 
                 // --- Act
@@ -197,7 +197,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // RES N,D
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.D = 0xAA;
 
                 // --- Act
@@ -231,7 +231,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // RES N,E
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.E = 0xFF;
 
                 // --- Act
@@ -265,7 +265,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // RES N,E
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.E = 0xAA;
 
                 // --- Act
@@ -299,7 +299,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // RES N,H
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.H = 0xFF;
 
                 // --- Act
@@ -333,7 +333,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // RES N,H
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.H = 0xAA;
 
                 // --- Act
@@ -367,7 +367,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // RES N,L
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.L = 0xFF;
 
                 // --- Act
@@ -401,7 +401,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // RES N,L
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.L = 0xAA;
 
                 // --- Act
@@ -435,7 +435,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // RES N,(HL)
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.HL = 0x1000;
                 m.Memory[regs.HL] = 0xFF;
 
@@ -470,7 +470,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // RES N,(HL)
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.HL = 0x1000;
                 m.Memory[regs.HL] = 0xAA;
 
@@ -505,7 +505,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // RES N,A
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.A = 0xFF;
 
                 // --- Act
@@ -539,7 +539,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.BitOps
                     0xCB, opcn // RES N,A
                 });
 
-                var regs = m.Cpu.Registers;
+                ref var regs = ref m.Cpu.Registers;
                 regs.A = 0xAA;
 
                 // --- Act
@@ -22,7 +22,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xA0 // LDI
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x0010;
             regs.HL = 0x1000;
             regs.DE = 0x1001;
@@ -62,7 +62,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xA0 // LDI
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x0001;
             regs.HL = 0x1000;
             regs.DE = 0x1001;
@@ -102,7 +102,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xA1 // CPI
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x0010;
             regs.HL = 0x1000;
             regs.A = 0x11;
@@ -141,7 +141,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xA1 // CPI
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x0001;
             regs.HL = 0x1000;
             regs.A = 0x11;
@@ -180,7 +180,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xA1 // CPI
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x0010;
             regs.HL = 0x1000;
             regs.A = 0xA5;
@@ -219,7 +219,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xA1 // CPI
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x0001;
             regs.HL = 0x1000;
             regs.A = 0xA5;
@@ -258,7 +258,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xA2 // INI
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x10CC;
             regs.HL = 0x1000;
             m.IoInputSequence.Add(0x69);
@@ -295,7 +295,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xA2 // INI
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x01CC;
             regs.HL = 0x1000;
             m.IoInputSequence.Add(0x69);
@@ -332,7 +332,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xA3 // OUTI
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x10CC;
             regs.HL = 0x1000;
             m.Memory[regs.HL] = 0x29;
@@ -373,7 +373,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xA3 // OUTI
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x01CC;
             regs.HL = 0x1000;
             m.Memory[regs.HL] = 0x29;
@@ -414,7 +414,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xA8 // LDD
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x0010;
             regs.HL = 0x1000;
             regs.DE = 0x1001;
@@ -454,7 +454,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xA8 // LDI
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x0001;
             regs.HL = 0x1000;
             regs.DE = 0x1001;
@@ -494,7 +494,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xA9 // CPD
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x0010;
             regs.HL = 0x1000;
             regs.A = 0x11;
@@ -533,7 +533,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xA9 // CPD
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x0001;
             regs.HL = 0x1000;
             regs.A = 0x11;
@@ -572,7 +572,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xA9 // CPD
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x0010;
             regs.HL = 0x1000;
             regs.A = 0xA5;
@@ -611,7 +611,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xA9 // CPD
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x0001;
             regs.HL = 0x1000;
             regs.A = 0xA5;
@@ -650,7 +650,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xAA // IND
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x10CC;
             regs.HL = 0x1000;
             m.IoInputSequence.Add(0x69);
@@ -687,7 +687,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xAA // IND
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x01CC;
             regs.HL = 0x1000;
             m.IoInputSequence.Add(0x69);
@@ -724,7 +724,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xAB // OUTD
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x10CC;
             regs.HL = 0x1000;
             m.Memory[regs.HL] = 0x29;
@@ -765,7 +765,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xAB // OUTD
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x01CC;
             regs.HL = 0x1000;
             m.Memory[regs.HL] = 0x29;
@@ -806,7 +806,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xB0 // LDIR
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x0003;
             regs.HL = 0x1001;
             regs.DE = 0x1000;
@@ -849,7 +849,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xB1 // CPIR
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x0003;
             regs.HL = 0x1000;
             regs.A = 0x11;
@@ -890,7 +890,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xB1 // CPIR
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x0003;
             regs.HL = 0x1000;
             regs.A = 0xA6;
@@ -931,7 +931,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xB2 // INIR
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x03CC;
             regs.HL = 0x1000;
             m.IoInputSequence.Add(0x69);
@@ -972,7 +972,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xB3 // OUTIR
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x3CC;
             regs.HL = 0x1000;
             m.Memory[regs.HL] = 0x29;
@@ -1021,7 +1021,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xB8 // LDDR
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x0003;
             regs.HL = 0x1002;
             regs.DE = 0x1003;
@@ -1064,7 +1064,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xB9 // CPDR
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x0003;
             regs.HL = 0x1002;
             regs.A = 0x11;
@@ -1105,7 +1105,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xB9 // CPDR
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x0003;
             regs.HL = 0x1002;
             regs.A = 0xA6;
@@ -1146,7 +1146,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xBA // INDR
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x03CC;
             regs.HL = 0x1002;
             m.IoInputSequence.Add(0x69);
@@ -1187,7 +1187,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xBB // OTDR
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x3CC;
             regs.HL = 0x1002;
             m.Memory[regs.HL - 2] = 0x29;
@@ -23,7 +23,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
                 0xED, 0x40 // IN B,(C)
             });
             m.IoInputSequence.Add(0xD5);
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x1234;
 
             // --- Act
@@ -55,7 +55,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x41        // OUT (C),B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x1234;
 
             // --- Act
@@ -86,7 +86,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x42        // SBC HL,BC
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x3456;
             regs.BC = 0x1234;
 
@@ -120,7 +120,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x42        // SBC HL,BC
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x1234;
             regs.BC = 0x3456;
 
@@ -154,7 +154,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x42        // SBC HL,BC
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x1234;
             regs.BC = 0x1234;
 
@@ -188,7 +188,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x42        // SBC HL,BC
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x3456;
             regs.BC = 0x1234;
             regs.F |= FlagsSetMask.C;
@@ -223,7 +223,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x43, 0x00, 0x10 // LD (1000H),BC
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x1234;
 
             // --- Act
@@ -253,7 +253,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
                 0xED, 0x44 // NEG
             });
             m.IoInputSequence.Add(0xD5);
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x03;
 
             // --- Act
@@ -289,7 +289,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
                 0xED, 0x44 // NEG
             });
             m.IoInputSequence.Add(0xD5);
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x00;
 
             // --- Act
@@ -325,7 +325,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
                 0xED, 0x44 // NEG
             });
             m.IoInputSequence.Add(0xD5);
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x80;
 
             // --- Act
@@ -361,7 +361,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
                 0xED, 0x44 // NEG
             });
             m.IoInputSequence.Add(0xD5);
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0xD0;
 
             // --- Act
@@ -485,7 +485,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x47 // LD I,A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0xD5;
 
             // --- Act
@@ -514,7 +514,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
                 0xED, 0x48 // IN C,(C)
             });
             m.IoInputSequence.Add(0xD5);
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x1234;
 
             // --- Act
@@ -546,7 +546,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x49        // OUT (C),C
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x1234;
 
             // --- Act
@@ -577,7 +577,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x4A // ADC HL,BC
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x1111;
             regs.BC = 0x1234;
             regs.F |= FlagsSetMask.C;
@@ -613,7 +613,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x4A // ADC HL,BC
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x1111;
             regs.BC = 0xF234;
             regs.F |= FlagsSetMask.C;
@@ -649,7 +649,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x4A // ADC HL,BC
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x1111;
             regs.BC = 0x7234;
             regs.F |= FlagsSetMask.C;
@@ -685,7 +685,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x4A // ADC HL,BC
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x0001;
             regs.BC = 0xFFFE;
             regs.F |= FlagsSetMask.C;
@@ -721,7 +721,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x4B, 0x00, 0x10 // LD BC,(1000H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             m.Memory[0x1000] = 0x34;
             m.Memory[0x1001] = 0x12;
 
@@ -751,7 +751,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
                 0xED, 0x4C // NEG
             });
             m.IoInputSequence.Add(0xD5);
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x03;
 
             // --- Act
@@ -844,7 +844,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x4F // LD R,A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0xD5;
 
             // --- Act
@@ -873,7 +873,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
                 0xED, 0x50 // IN D,(C)
             });
             m.IoInputSequence.Add(0xD5);
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x1234;
 
             // --- Act
@@ -905,7 +905,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x51        // OUT (C),D
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x1234;
             regs.DE = 0xBA98;
 
@@ -937,7 +937,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x52        // SBC HL,DE
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x3456;
             regs.DE = 0x1234;
             regs.F |= FlagsSetMask.C;
@@ -972,7 +972,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x53, 0x00, 0x10 // LD (1000H),DE
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.DE = 0x1234;
 
             // --- Act
@@ -1002,7 +1002,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
                 0xED, 0x54 // NEG
             });
             m.IoInputSequence.Add(0xD5);
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x03;
 
             // --- Act
@@ -1095,7 +1095,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x57 // LD A,I
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.I = 0xD5;
 
             // --- Act
@@ -1123,7 +1123,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x57 // LD A,I
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.I = 0xD5;
 
             // --- Act
@@ -1153,7 +1153,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x57 // LD A,I
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.I = 0xD5;
 
             // --- Act
@@ -1182,7 +1182,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x57 // LD A,I
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.I = 0x25;
 
             // --- Act
@@ -1211,7 +1211,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x57 // LD A,I
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.I = 0x00;
 
             // --- Act
@@ -1240,7 +1240,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x57 // LD A,I
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.I = 0x25;
 
             // --- Act
@@ -1269,7 +1269,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x57 // LD A,I
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             m.Cpu.IFF2 = false;
             regs.I = 0x25;
 
@@ -1299,7 +1299,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x57 // LD A,I
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             m.Cpu.IFF2 = true;
             regs.I = 0x25;
 
@@ -1329,7 +1329,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x57 // LD A,I
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.F |= FlagsSetMask.C;
             regs.I = 0x25;
 
@@ -1359,7 +1359,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x57 // LD A,I
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.F |= FlagsSetMask.C;
             regs.I = 0x25;
 
@@ -1389,7 +1389,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x57 // LD A,I
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.F |= FlagsSetMask.C;
             regs.I = 0x09;
 
@@ -1421,7 +1421,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
                 0xED, 0x58 // IN E,(C)
             });
             m.IoInputSequence.Add(0xD5);
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x1234;
 
             // --- Act
@@ -1453,7 +1453,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x59        // OUT (C),E
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x1234;
             regs.DE = 0xBA98;
 
@@ -1485,7 +1485,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x5A // ADC HL,DE
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x1111;
             regs.DE = 0x1234;
             regs.F |= FlagsSetMask.C;
@@ -1521,7 +1521,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x5B, 0x00, 0x10 // LD DE,(1000H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             m.Memory[0x1000] = 0x34;
             m.Memory[0x1001] = 0x12;
 
@@ -1551,7 +1551,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
                 0xED, 0x5C // NEG
             });
             m.IoInputSequence.Add(0xD5);
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x03;
 
             // --- Act
@@ -1644,7 +1644,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x5F // LD A,R
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.R = 0xD5;
 
             // --- Act
@@ -1674,7 +1674,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x5F // LD A,R
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.R = 0xD3;
 
             // --- Act
@@ -1706,7 +1706,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x5F // LD A,R
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.R = 0xD3;
 
             // --- Act
@@ -1737,7 +1737,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x5F // LD A,R
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.R = 0x23;
 
             // --- Act
@@ -1768,7 +1768,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x5F // LD A,R
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.R = 0x7E;
 
             // --- Act
@@ -1799,7 +1799,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x5F // LD A,R
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.R = 0x23;
 
             // --- Act
@@ -1830,7 +1830,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x5F // LD A,R
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             m.Cpu.IFF2 = false;
             regs.R = 0x23;
 
@@ -1862,7 +1862,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x5F // LD A,R
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             m.Cpu.IFF2 = true;
             regs.R = 0x23;
 
@@ -1894,7 +1894,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x5F // LD A,R
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.F |= FlagsSetMask.C;
             regs.R = 0x23;
 
@@ -1926,7 +1926,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x5F // LD A,R
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.F |= FlagsSetMask.C;
             regs.R = 0x23;
 
@@ -1958,7 +1958,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x5F // LD A,R
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.F |= FlagsSetMask.C;
             regs.R = 0x07;
 
@@ -1992,7 +1992,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
                 0xED, 0x60 // IN H,(C)
             });
             m.IoInputSequence.Add(0xD5);
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x1234;
 
             // --- Act
@@ -2024,7 +2024,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x61        // OUT (C),H
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x1234;
             regs.HL = 0xBA98;
 
@@ -2056,7 +2056,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x62        // SBC HL,HL
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x3456;
             regs.F |= FlagsSetMask.C;
 
@@ -2090,7 +2090,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x63, 0x00, 0x10 // LD (1000H),HL
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x1234;
 
             // --- Act
@@ -2120,7 +2120,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
                 0xED, 0x64 // NEG
             });
             m.IoInputSequence.Add(0xD5);
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x03;
 
             // --- Act
@@ -2213,7 +2213,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x67 // RRD
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x1000;
             m.Memory[0x1000] = 0x56;
             regs.A = 0x34;
@@ -2251,7 +2251,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x67 // RRD
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x1000;
             m.Memory[0x1000] = 0x56;
             regs.A = 0xA4;
@@ -2289,7 +2289,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x67 // RRD
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x1000;
             m.Memory[0x1000] = 0x50;
             regs.A = 0x04;
@@ -2327,7 +2327,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x67 // RRD
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x1000;
             m.Memory[0x1000] = 0x50;
             regs.A = 0x14;
@@ -2366,7 +2366,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
                 0xED, 0x68 // IN L,(C)
             });
             m.IoInputSequence.Add(0xD5);
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x1234;
 
             // --- Act
@@ -2398,7 +2398,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x69        // OUT (C),L
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x1234;
             regs.HL = 0xBA98;
 
@@ -2430,7 +2430,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x6A // ADC HL,HL
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x1111;
             regs.F |= FlagsSetMask.C;
 
@@ -2465,7 +2465,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x6B, 0x00, 0x10 // LD HL,(1000H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             m.Memory[0x1000] = 0x34;
             m.Memory[0x1001] = 0x12;
 
@@ -2495,7 +2495,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
                 0xED, 0x6C // NEG
             });
             m.IoInputSequence.Add(0xD5);
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x03;
 
             // --- Act
@@ -2588,7 +2588,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x6F // RLD
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x1000;
             m.Memory[0x1000] = 0x56;
             regs.A = 0x34;
@@ -2626,7 +2626,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x6F // RLD
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x1000;
             m.Memory[0x1000] = 0x56;
             regs.A = 0xA4;
@@ -2664,7 +2664,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x6F // RLD
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x1000;
             m.Memory[0x1000] = 0x06;
             regs.A = 0x04;
@@ -2702,7 +2702,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x6F // RLD
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x1000;
             m.Memory[0x1000] = 0x06;
             regs.A = 0x14;
@@ -2741,7 +2741,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
                 0xED, 0x70 // IN (C)
             });
             m.IoInputSequence.Add(0xD5);
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x1234;
 
             // --- Act
@@ -2772,7 +2772,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x71        // OUT (C),0
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x1234;
 
             // --- Act
@@ -2803,7 +2803,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x72        // SBC HL,SP
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x3456;
             regs.SP = 0x1234;
             regs.F |= FlagsSetMask.C;
@@ -2838,7 +2838,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x73, 0x00, 0x10 // LD (1000H),SP
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.SP = 0x1234;
 
             // --- Act
@@ -2868,7 +2868,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
                 0xED, 0x74 // NEG
             });
             m.IoInputSequence.Add(0xD5);
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x03;
 
             // --- Act
@@ -2962,7 +2962,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
                 0xED, 0x78 // IN A,(C)
             });
             m.IoInputSequence.Add(0xD5);
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x1234;
 
             // --- Act
@@ -2994,7 +2994,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x79        // OUT (C),A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x1234;
             regs.A = 0x98;
 
@@ -3026,7 +3026,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x7A // ADC HL,SP
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = 0x1111;
             regs.SP = 0x1234;
             regs.F |= FlagsSetMask.C;
@@ -3062,7 +3062,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x7B, 0x00, 0x10 // LD SP,(1000H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             m.Memory[0x1000] = 0x34;
             m.Memory[0x1001] = 0x12;
 
@@ -3092,7 +3092,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
                 0xED, 0x7C // NEG
             });
             m.IoInputSequence.Add(0xD5);
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x03;
 
             // --- Act
@@ -24,7 +24,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x23           // SWAPNIB
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = (byte)initial;
 
             // --- Act
@@ -52,7 +52,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x23           // SWAPNIB
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
 
             // --- Act
             m.Run();
@@ -80,7 +80,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x24           // MIRROR A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = (byte)initial;
 
             // --- Act
@@ -108,7 +108,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x24           // MIRROR A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
 
             // --- Act
             m.Run();
@@ -136,7 +136,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x26           // MIRROR DE
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.DE = (ushort)initial;
 
             // --- Act
@@ -164,7 +164,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x26           // MIRROR DE
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
 
             // --- Act
             m.Run();
@@ -192,7 +192,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x27, (byte)n   // TEST N
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = (byte)a;
 
             // --- Act
@@ -220,7 +220,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x27           // TEST N
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
 
             // --- Act
             m.Run();
@@ -248,7 +248,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x30           // MUL
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = (ushort)hl;
             regs.DE = (ushort)de;
 
@@ -278,7 +278,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x30           // MUL
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
 
             // --- Act
             m.Run();
@@ -306,7 +306,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x31           // ADD HL,A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = (ushort)hl;
             regs.A = (byte)a;
 
@@ -335,7 +335,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x31           // ADD HL,A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
 
             // --- Act
             m.Run();
@@ -363,7 +363,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x32           // ADD DE,A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.DE = (ushort)de;
             regs.A = (byte)a;
 
@@ -392,7 +392,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x32           // ADD DE,A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
 
             // --- Act
             m.Run();
@@ -420,7 +420,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x33           // ADD BC,A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = (ushort)bc;
             regs.A = (byte)a;
 
@@ -449,7 +449,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x33           // ADD BC,A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
 
             // --- Act
             m.Run();
@@ -477,7 +477,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x34, (byte)nn, (byte)(nn >> 8)  // ADD HL,NN
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = (ushort)hl;
 
             // --- Act
@@ -505,7 +505,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x34   // ADD HL,NN
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
 
             // --- Act
             m.Run();
@@ -533,7 +533,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x35, (byte)nn, (byte)(nn >> 8)  // ADD DE,NN
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.DE = (ushort)de;
 
             // --- Act
@@ -561,7 +561,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x35   // ADD DE,NN
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
 
             // --- Act
             m.Run();
@@ -589,7 +589,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x36, (byte)nn, (byte)(nn >> 8)  // ADD BC,NN
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = (ushort)bc;
 
             // --- Act
@@ -617,7 +617,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x36   // ADD BC,NN
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
 
             // --- Act
             m.Run();
@@ -670,7 +670,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x8A           // PUSH NN
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
 
             // --- Act
             m.Run();
@@ -695,7 +695,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x90 // OUTINB
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0x10CC;
             regs.HL = 0x1000;
             m.Memory[regs.HL] = 0x29;
@@ -733,7 +733,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x90           // OUTINB
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
 
             // --- Act
             m.Run();
@@ -786,7 +786,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x91           // NEXTREG reg,val
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
 
             // --- Act
             m.Run();
@@ -814,7 +814,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             });
 
             // --- Act
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x3D;
             m.Run();
 
@@ -840,7 +840,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x92           // NEXTREG reg,A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
 
             // --- Act
             m.Run();
@@ -877,7 +877,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x93           // PIXELDN
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.HL = (ushort) orig;
 
             // --- Act
@@ -904,7 +904,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x93           // PIXELDN
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
 
             // --- Act
             m.Run();
@@ -956,7 +956,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x94           // PIXELAD
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.D = (byte)row;
             regs.E = (byte)col;
 
@@ -984,7 +984,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x94           // PIXELAD
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
 
             // --- Act
             m.Run();
@@ -1026,7 +1026,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x95           // SETAE
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = (byte)a;
             regs.E = (byte)e;
 
@@ -1054,7 +1054,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0x95           // SETAE
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
 
             // --- Act
             m.Run();
@@ -1079,7 +1079,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xA4 // LDIX
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x00;
             regs.BC = 0x0010;
             regs.HL = 0x1000;
@@ -1119,7 +1119,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xA4 // LDIX
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0xA5;
             regs.BC = 0x0010;
             regs.HL = 0x1000;
@@ -1159,7 +1159,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xA4 // LDIX
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x00;
             regs.BC = 0x0001;
             regs.HL = 0x1000;
@@ -1199,7 +1199,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xA4           // LDIX
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
 
             // --- Act
             m.Run();
@@ -1224,7 +1224,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xAC // LDDX
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x00;
             regs.BC = 0x0010;
             regs.HL = 0x1000;
@@ -1265,7 +1265,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xAC // LDDX
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0xA5;
             regs.BC = 0x0010;
             regs.HL = 0x1000;
@@ -1306,7 +1306,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xAC // LDDX
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x00;
             regs.BC = 0x0001;
             regs.HL = 0x1000;
@@ -1347,7 +1347,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xAC           // LDDX
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
 
             // --- Act
             m.Run();
@@ -1372,7 +1372,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xB4 // LDIRX
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x00;
             regs.BC = 0x0003;
             regs.HL = 0x1001;
@@ -1415,7 +1415,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xB4 // LDIRX
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0xA6;
             regs.BC = 0x0003;
             regs.HL = 0x1001;
@@ -1459,7 +1459,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xB4           // LDIRX
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
 
             // --- Act
             m.Run();
@@ -1484,7 +1484,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xBC // LDDRX
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x00;
             regs.BC = 0x0003;
             regs.HL = 0x1002;
@@ -1527,7 +1527,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xBC // LDDRX
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0xA6;
             regs.BC = 0x0003;
             regs.HL = 0x1002;
@@ -1571,7 +1571,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.ExtendedOps
             {
                 0xED, 0xBC           // LDDRX
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
 
             // --- Act
             m.Run();
@@ -30,7 +30,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
                         0xDD, 0xCB, OFFS, opcn // BIT N,(IX+54H)
                     });
 
-                    var regs = m.Cpu.Registers;
+                    ref var regs = ref m.Cpu.Registers;
                     regs.IX = 0x1000;
                     m.Memory[regs.IX + OFFS] = (byte)~(0x01 << n);
 
@@ -74,7 +74,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
                         0xDD, 0xCB, OFFS, opcn // BIT N,(IX+54H)
                     });
 
-                    var regs = m.Cpu.Registers;
+                    ref var regs = ref m.Cpu.Registers;
                     regs.IX = 0x1000;
                     m.Memory[regs.IX + OFFS] = (byte)(0x01 << n);
 
@@ -118,7 +118,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
                         0xDD, 0xCB, OFFS, opcn // RES N,(IX+54H)
                     });
 
-                    var regs = m.Cpu.Registers;
+                    ref var regs = ref m.Cpu.Registers;
                     regs.IX = 0x1000;
                     m.Memory[regs.IX + OFFS] = 0xFF;
 
@@ -155,7 +155,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
                         0xDD, 0xCB, OFFS, opcn // RES N,(IX+54H)
                     });
 
-                    var regs = m.Cpu.Registers;
+                    ref var regs = ref m.Cpu.Registers;
                     regs.IX = 0x1000;
                     m.Memory[regs.IX + OFFS] = 0xAA;
 
@@ -192,7 +192,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
                         0xDD, 0xCB, OFFS, opcn // SET N,(IX+54H)
                     });
 
-                    var regs = m.Cpu.Registers;
+                    ref var regs = ref m.Cpu.Registers;
                     regs.IX = 0x1000;
                     m.Memory[regs.IX + OFFS] = 0x00;
 
@@ -229,7 +229,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
                         0xDD, 0xCB, OFFS, opcn // SET N,(IX+54H)
                     });
 
-                    var regs = m.Cpu.Registers;
+                    ref var regs = ref m.Cpu.Registers;
                     regs.IX = 0x1000;
                     m.Memory[regs.IX + OFFS] = 0x55;
 
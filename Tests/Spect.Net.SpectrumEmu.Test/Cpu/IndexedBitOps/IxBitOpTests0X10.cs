@@ -23,7 +23,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x10 // RL (IX+32H),B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x08;
@@ -62,7 +62,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x11 // RL (IX+32H),C
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x08;
@@ -101,7 +101,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x12 // RL (IX+32H),D
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x08;
@@ -140,7 +140,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x13 // RL (IX+32H),E
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x08;
@@ -179,7 +179,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x14 // RL (IX+32H),H
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x08;
@@ -218,7 +218,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x15 // RL (IX+32H),L
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x08;
@@ -257,7 +257,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x16 // RL (IX+32H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x08;
@@ -295,7 +295,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x17 // RL (IX+32H),A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x08;
@@ -334,7 +334,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x18 // RR (IX+32H),B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x08;
@@ -373,7 +373,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x19 // RR (IX+32H),C
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x08;
@@ -412,7 +412,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x1A // RR (IX+32H),D
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x08;
@@ -451,7 +451,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x1B // RR (IX+32H),E
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x08;
@@ -490,7 +490,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x1C // RR (IX+32H),H
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x08;
@@ -529,7 +529,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x1D // RR (IX+32H),L
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x08;
@@ -568,7 +568,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x1E // RR (IX+32H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x08;
@@ -606,7 +606,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x1F // RR (IX+32H),A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x08;
@@ -23,7 +23,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x20 // SLA (IX+32H),B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x08;
@@ -62,7 +62,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x21 // SLA (IX+32H),C
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x08;
@@ -101,7 +101,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x22 // SLA (IX+32H),D
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x08;
@@ -140,7 +140,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x23 // SLA (IX+32H),E
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x08;
@@ -179,7 +179,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x24 // SLA (IX+32H),H
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x08;
@@ -218,7 +218,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x25 // SLA (IX+32H),L
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x08;
@@ -257,7 +257,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x26 // SLA (IX+32H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x08;
@@ -295,7 +295,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x27 // SLA (IX+32H),A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x08;
@@ -334,7 +334,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x28 // SRA (IX+32H),B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x10;
@@ -373,7 +373,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x29 // SRA (IX+32H),C
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x10;
@@ -412,7 +412,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x2A // SRA (IX+32H),D
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x10;
@@ -451,7 +451,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x2B // SRA (IX+32H),E
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x10;
@@ -490,7 +490,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x2C // SRA (IX+32H),H
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x10;
@@ -529,7 +529,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x2D // SRA (IX+32H),L
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x10;
@@ -568,7 +568,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x2E // SRA (IX+32H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x10;
@@ -606,7 +606,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xDD, 0xCB, OFFS, 0x2F // SRA (IX+32H),A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IX + OFFS] = 0x10;
@@ -28,7 +28,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
                         0xFD, 0xCB, OFFS, opcn // BIT N,(IY+54H)
                     });
 
-                    var regs = m.Cpu.Registers;
+                    ref var regs = ref m.Cpu.Registers;
                     regs.IY = 0x1000;
                     m.Memory[regs.IY + OFFS] = (byte)~(0x01 << n);
 
@@ -72,7 +72,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
                         0xFD, 0xCB, OFFS, opcn // BIT N,(IY+54H)
                     });
 
-                    var regs = m.Cpu.Registers;
+                    ref var regs = ref m.Cpu.Registers;
                     regs.IY = 0x1000;
                     m.Memory[regs.IY + OFFS] = (byte)(0x01 << n);
 
@@ -116,7 +116,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
                         0xFD, 0xCB, OFFS, opcn // RES N,(IY+54H)
                     });
 
-                    var regs = m.Cpu.Registers;
+                    ref var regs = ref m.Cpu.Registers;
                     regs.IY = 0x1000;
                     m.Memory[regs.IY + OFFS] = 0xFF;
 
@@ -153,7 +153,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
                         0xFD, 0xCB, OFFS, opcn // RES N,(IY+54H)
                     });
 
-                    var regs = m.Cpu.Registers;
+                    ref var regs = ref m.Cpu.Registers;
                     regs.IY = 0x1000;
                     m.Memory[regs.IY + OFFS] = 0xAA;
 
@@ -190,7 +190,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
                         0xFD, 0xCB, OFFS, opcn // SET N,(IY+54H)
                     });
 
-                    var regs = m.Cpu.Registers;
+                    ref var regs = ref m.Cpu.Registers;
                     regs.IY = 0x1000;
                     m.Memory[regs.IY + OFFS] = 0x00;
 
@@ -227,7 +227,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
                         0xFD, 0xCB, OFFS, opcn // SET N,(IY+54H)
                     });
 
-                    var regs = m.Cpu.Registers;
+                    ref var regs = ref m.Cpu.Registers;
                     regs.IY = 0x1000;
                     m.Memory[regs.IY + OFFS] = 0x55;
 
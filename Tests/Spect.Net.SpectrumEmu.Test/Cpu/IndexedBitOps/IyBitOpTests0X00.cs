@@ -23,7 +23,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0XFD, 0xCB, OFFS, 0x00 // RLC (IY+32H),B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x08;
 
@@ -61,7 +61,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0XFD, 0xCB, OFFS, 0x00 // RLC (IY+32H),B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY - 256 + OFFS] = 0x08;
 
@@ -99,7 +99,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0XFD, 0xCB, OFFS, 0x00 // RLC (IY+32H),B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x84;
 
@@ -137,7 +137,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0XFD, 0xCB, OFFS, 0x00 // RLC (IY+32H),B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x00;
 
@@ -175,7 +175,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0XFD, 0xCB, OFFS, 0x00 // RLC (IY+32H),B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0xC0;
 
@@ -213,7 +213,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0XFD, 0xCB, OFFS, 0x01 // RLC (IY+32H),C
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x08;
 
@@ -251,7 +251,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0XFD, 0xCB, OFFS, 0x02 // RLC (IY+32H),D
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x08;
 
@@ -289,7 +289,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0XFD, 0xCB, OFFS, 0x03 // RLC (IY+32H),E
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x08;
 
@@ -327,7 +327,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0XFD, 0xCB, OFFS, 0x04 // RLC (IY+32H),H
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x08;
 
@@ -365,7 +365,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0XFD, 0xCB, OFFS, 0x05 // RLC (IY+32H),L
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x08;
 
@@ -403,7 +403,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0XFD, 0xCB, OFFS, 0x06 // RLC (IY+32H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x08;
 
@@ -440,7 +440,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0XFD, 0xCB, OFFS, 0x07 // RLC (IY+32H),A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x08;
 
@@ -478,7 +478,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0XFD, 0xCB, OFFS, 0x08 // RRC (IY+32H),B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x08;
 
@@ -516,7 +516,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0XFD, 0xCB, OFFS, 0x08 // RRC (IY+32H),B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY - 256 + OFFS] = 0x08;
 
@@ -554,7 +554,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0XFD, 0xCB, OFFS, 0x09 // RRC (IY+32H),C
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x08;
 
@@ -592,7 +592,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0XFD, 0xCB, OFFS, 0x0A // RRC (IY+32H),D
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x08;
 
@@ -630,7 +630,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0XFD, 0xCB, OFFS, 0x0B // RRC (IY+32H),E
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x08;
 
@@ -668,7 +668,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0XFD, 0xCB, OFFS, 0x0C // RRC (IY+32H),H
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x08;
 
@@ -706,7 +706,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0XFD, 0xCB, OFFS, 0x0D // RRC (IY+32H),L
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x08;
 
@@ -744,7 +744,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0XFD, 0xCB, OFFS, 0x0E // RLC (IY+32H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x08;
 
@@ -781,7 +781,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0XFD, 0xCB, OFFS, 0x0F // RRC (IY+32H),A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x08;
 
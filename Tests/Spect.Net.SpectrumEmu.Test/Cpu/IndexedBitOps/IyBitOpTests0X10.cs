@@ -21,7 +21,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x10 // RL (IY+32H),B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x08;
@@ -60,7 +60,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x11 // RL (IY+32H),C
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x08;
@@ -99,7 +99,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x12 // RL (IY+32H),D
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x08;
@@ -138,7 +138,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x13 // RL (IY+32H),E
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x08;
@@ -177,7 +177,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x14 // RL (IY+32H),H
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x08;
@@ -216,7 +216,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x15 // RL (IY+32H),L
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x08;
@@ -255,7 +255,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x16 // RL (IY+32H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x08;
@@ -293,7 +293,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x17 // RL (IY+32H),A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x08;
@@ -332,7 +332,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x18 // RR (IY+32H),B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x08;
@@ -371,7 +371,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x19 // RR (IY+32H),C
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x08;
@@ -410,7 +410,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x1A // RR (IY+32H),D
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x08;
@@ -449,7 +449,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x1B // RR (IY+32H),E
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x08;
@@ -488,7 +488,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x1C // RR (IY+32H),H
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x08;
@@ -527,7 +527,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x1D // RR (IY+32H),L
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x08;
@@ -566,7 +566,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x1E // RR (IY+32H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x08;
@@ -604,7 +604,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x1F // RR (IY+32H),A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x08;
@@ -21,7 +21,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x30 // SLL (IY+32H),B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x08;
@@ -60,7 +60,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x31 // SLL (IY+32H),C
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x08;
@@ -99,7 +99,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x32 // SLL (IY+32H),D
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x08;
@@ -138,7 +138,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x33 // SLL (IY+32H),E
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x08;
@@ -177,7 +177,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x34 // SLL (IY+32H),H
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x08;
@@ -216,7 +216,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x35 // SLL (IY+32H),L
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x08;
@@ -255,7 +255,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x36 // SLL (IY+32H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x08;
@@ -293,7 +293,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x37 // SLL (IY+32H),A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x08;
@@ -332,7 +332,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x38 // SRL (IY+32H),B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x10;
@@ -371,7 +371,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x39 // SRL (IY+32H),C
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x10;
@@ -410,7 +410,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x3A // SRL (IY+32H),D
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x10;
@@ -449,7 +449,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x3B // SRL (IY+32H),E
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x10;
@@ -488,7 +488,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x3C // SRL (IY+32H),H
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x10;
@@ -527,7 +527,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x3D // SRL (IY+32H),L
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x10;
@@ -566,7 +566,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x3E // SRL (IY+32H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x10;
@@ -604,7 +604,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedBitOps
             {
                 0xFD, 0xCB, OFFS, 0x3F // SRL (IY+32H),A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.F |= FlagsSetMask.C;
             m.Memory[regs.IY + OFFS] = 0x10;
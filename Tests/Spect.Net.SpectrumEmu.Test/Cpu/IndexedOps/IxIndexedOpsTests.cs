@@ -769,7 +769,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x34, 0x52  // INC (IX+52H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             m.Memory[regs.IX + OFFS] = 0xA5;
 
@@ -799,7 +799,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x35, 0x52  // DEC (IX+52H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             m.Memory[regs.IX + OFFS] = 0xA5;
 
@@ -829,7 +829,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x36, 0x52, 0xD2  // LD (IX+52H),D2H
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
 
             // --- Act
@@ -947,7 +947,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x46, 0x54  // LD B,(IX+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             m.Memory[regs.IX + OFFS] = 0x7C;
 
@@ -1033,7 +1033,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x4E, 0x54  // LD C,(IX+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             m.Memory[regs.IX + OFFS] = 0x7C;
 
@@ -1119,7 +1119,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x56, 0x54  // LD D,(IX+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             m.Memory[regs.IX + OFFS] = 0x7C;
 
@@ -1205,7 +1205,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x5E, 0x54  // LD E,(IX+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             m.Memory[regs.IX + OFFS] = 0x7C;
 
@@ -1234,7 +1234,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x60 // LD XH,B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0xAAAA;
             regs.B = 0x55;
 
@@ -1263,7 +1263,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x61 // LD XH,C
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0xAAAA;
             regs.C = 0x55;
 
@@ -1292,7 +1292,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x62 // LD XH,D
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0xAAAA;
             regs.D = 0x55;
 
@@ -1321,7 +1321,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x63 // LD XH,E
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0xAAAA;
             regs.E = 0x55;
 
@@ -1350,7 +1350,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x65 // LD XH,XL
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0xAABB;
 
             // --- Act
@@ -1379,7 +1379,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x66, 0x54  // LD H,(IX+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             m.Memory[regs.IX + OFFS] = 0x7C;
 
@@ -1408,7 +1408,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x67 // LD XH,A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0xAAAA;
             regs.A = 0x55;
 
@@ -1437,7 +1437,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x68 // LD XL,B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0xAAAA;
             regs.B = 0x55;
 
@@ -1466,7 +1466,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x69 // LD XL,C
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0xAAAA;
             regs.C = 0x55;
 
@@ -1495,7 +1495,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x6A // LD XL,D
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0xAAAA;
             regs.D = 0x55;
 
@@ -1524,7 +1524,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x6B // LD XL,E
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0xAAAA;
             regs.E = 0x55;
 
@@ -1553,7 +1553,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x6C // LD XL,XH
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0xAABB;
 
             // --- Act
@@ -1582,7 +1582,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x6E, 0x54  // LD L,(IX+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             m.Memory[regs.IX + OFFS] = 0x7C;
 
@@ -1611,7 +1611,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x6F // LD XL,A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0xAAAA;
             regs.A = 0x55;
 
@@ -1641,7 +1641,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x70, 0x52  // LD (IX+52H),B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.B = 0xA5;
 
@@ -1671,7 +1671,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x71, 0x52  // LD (IX+52H),C
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.C = 0xA5;
 
@@ -1701,7 +1701,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x72, 0x52  // LD (IX+52H),D
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.D = 0xA5;
 
@@ -1731,7 +1731,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x73, 0x52  // LD (IX+52H),E
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.E = 0xA5;
 
@@ -1761,7 +1761,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x74, 0x52  // LD (IX+52H),H
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.H = 0xA5;
 
@@ -1791,7 +1791,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x75, 0x52  // LD (IX+52H),L
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.L = 0xA5;
 
@@ -1821,7 +1821,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x77, 0x52  // LD (IX+52H),A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             regs.A = 0xA5;
 
@@ -1907,7 +1907,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0x7E, 0x54  // LD A,(IX+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             m.Memory[regs.IX + OFFS] = 0x7C;
 
@@ -2010,7 +2010,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x3E, 0x12,      // LD A,12H
                 0xDD, 0x86, 0x54 // ADD A,(IX+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             m.Memory[regs.IX + OFFS] = 0x24;
 
@@ -2048,7 +2048,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x37,       // SCF
                 0xDD, 0x8C  // ADC A,XH
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0xF0AA;
 
             // --- Act
@@ -2085,7 +2085,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x37,       // SCF
                 0xDD, 0x8D  // ADC A,XL
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0xAAF0;
 
             // --- Act
@@ -2123,7 +2123,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x37,             // SCF
                 0xDD, 0x8E, 0x54  // ADC A,(IX+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             m.Memory[regs.IX + OFFS] = 0xF0;
 
@@ -2234,7 +2234,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x37,             // SCF
                 0xDD, 0x96, 0x54  // SUB (IX+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             m.Memory[regs.IX + OFFS] = 0x24;
 
@@ -2272,7 +2272,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0xDD, 0x21, 0x3D, 0x24, // LD IX,243DH
                 0xDD, 0x9C              // SBC XH
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.F |= FlagsSetMask.C;
 
             // --- Act
@@ -2309,7 +2309,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0xDD, 0x21, 0x24, 0x3D, // LD IX,3D24H
                 0xDD, 0x9D              // SBC XL
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.F |= FlagsSetMask.C;
 
             // --- Act
@@ -2346,7 +2346,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x37,             // SCF
                 0xDD, 0x9E, 0x54  // SBC (IX+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.F |= FlagsSetMask.C;
             regs.IX = 0x1000;
             m.Memory[regs.IX + OFFS] = 0x24;
@@ -2384,7 +2384,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x3E, 0x12, // LD A,12H
                 0xDD, 0xA4  // AND XH
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x23AA;
 
             // --- Act
@@ -2420,7 +2420,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x3E, 0x12, // LD A,12H
                 0xDD, 0xA5  // AND XL
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0xAA23;
 
             // --- Act
@@ -2457,7 +2457,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x3E, 0x12,       // LD A,12H
                 0xDD, 0xA6, 0x54  // AND (IX+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             m.Memory[regs.IX + OFFS] = 0x23;
 
@@ -2494,7 +2494,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x3E, 0x12, // LD A,12H
                 0xDD, 0xAC  // XOR XH
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x23AA;
 
             // --- Act
@@ -2530,7 +2530,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x3E, 0x12, // LD A,12H
                 0xDD, 0xAD  // XOR XL
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0xAA23;
 
             // --- Act
@@ -2567,7 +2567,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x3E, 0x12,       // LD A,12H
                 0xDD, 0xAE, 0x54  // XOR (IX+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             m.Memory[regs.IX + OFFS] = 0x23;
 
@@ -2604,7 +2604,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x3E, 0x12, // LD A,12H
                 0xDD, 0xB4  // OR XH
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x23AA;
 
             // --- Act
@@ -2640,7 +2640,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x3E, 0x12, // LD A,12H
                 0xDD, 0xB5  // OR XL
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0xAA23;
 
             // --- Act
@@ -2677,7 +2677,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x3E, 0x12,       // LD A,12H
                 0xDD, 0xB6, 0x54  // OR (IX+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IX = 0x1000;
             m.Memory[regs.IX + OFFS] = 0x23;
 
@@ -2713,7 +2713,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0xBC  // CP XH
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x36;
             regs.IX = 0x24AA;
 
@@ -2748,7 +2748,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0xBD  // CP XL
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x36;
             regs.IX = 0xAA24;
 
@@ -2784,7 +2784,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xDD, 0xBE, 0x54 // CP (IX+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x36;
             regs.IX = 0x1000;
             m.Memory[regs.IX + OFFS] = 0x24;
@@ -767,7 +767,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x34, 0x52  // INC (IY+52H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0xA5;
 
@@ -797,7 +797,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x35, 0x52  // DEC (IY+52H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0xA5;
 
@@ -827,7 +827,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x36, 0x52, 0xD2  // DEC (IY+52H),D2H
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
 
             // --- Act
@@ -945,7 +945,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x46, 0x54  // LD B,(IY+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x7C;
 
@@ -1031,7 +1031,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x4E, 0x54  // LD C,(IY+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x7C;
 
@@ -1117,7 +1117,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x56, 0x54  // LD D,(IY+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x7C;
 
@@ -1203,7 +1203,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x5E, 0x54  // LD E,(IY+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x7C;
 
@@ -1232,7 +1232,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x60 // LD YH,B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0xAAAA;
             regs.B = 0x55;
 
@@ -1261,7 +1261,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x61 // LD YH,C
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0xAAAA;
             regs.C = 0x55;
 
@@ -1290,7 +1290,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x62 // LD YH,D
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0xAAAA;
             regs.D = 0x55;
 
@@ -1319,7 +1319,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x63 // LD YH,E
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0xAAAA;
             regs.E = 0x55;
 
@@ -1348,7 +1348,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x65 // LD YH,YL
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0xAABB;
 
             // --- Act
@@ -1377,7 +1377,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x66, 0x54  // LD H,(IY+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x7C;
 
@@ -1406,7 +1406,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x67 // LD YH,A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0xAAAA;
             regs.A = 0x55;
 
@@ -1435,7 +1435,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x68 // LD YL,B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0xAAAA;
             regs.B = 0x55;
 
@@ -1464,7 +1464,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x69 // LD YL,C
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0xAAAA;
             regs.C = 0x55;
 
@@ -1493,7 +1493,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x6A // LD YL,D
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0xAAAA;
             regs.D = 0x55;
 
@@ -1522,7 +1522,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x6B // LD YL,E
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0xAAAA;
             regs.E = 0x55;
 
@@ -1551,7 +1551,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x6C // LD YL,YH
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0xAABB;
 
             // --- Act
@@ -1580,7 +1580,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x6E, 0x54  // LD L,(IY+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x7C;
 
@@ -1609,7 +1609,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x6F // LD YL,A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0xAAAA;
             regs.A = 0x55;
 
@@ -1639,7 +1639,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x70, 0x52  // LD (IY+52H),B
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.B = 0xA5;
 
@@ -1669,7 +1669,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x71, 0x52  // LD (IY+52H),C
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.C = 0xA5;
 
@@ -1699,7 +1699,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x72, 0x52  // LD (IY+52H),D
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.D = 0xA5;
 
@@ -1729,7 +1729,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x73, 0x52  // LD (IY+52H),E
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.E = 0xA5;
 
@@ -1759,7 +1759,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x74, 0x52  // LD (IY+52H),H
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.H = 0xA5;
 
@@ -1789,7 +1789,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x75, 0x52  // LD (IY+52H),L
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.L = 0xA5;
 
@@ -1819,7 +1819,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x77, 0x52  // LD (IY+52H),A
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             regs.A = 0xA5;
 
@@ -1905,7 +1905,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0x7E, 0x54  // LD A,(IY+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x7C;
 
@@ -2008,7 +2008,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x3E, 0x12,      // LD A,12H
                 0xFD, 0x86, 0x54 // ADD A,(IY+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x24;
 
@@ -2046,7 +2046,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x37,       // SCF
                 0xFD, 0x8C  // ADC A,YH
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0xF0AA;
 
             // --- Act
@@ -2083,7 +2083,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x37,       // SCF
                 0xFD, 0x8D  // ADC A,YL
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0xAAF0;
 
             // --- Act
@@ -2121,7 +2121,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x37,             // SCF
                 0xFD, 0x8E, 0x54  // ADC A,(IY+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0xF0;
 
@@ -2232,7 +2232,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x37,             // SCF
                 0xFD, 0x96, 0x54  // SUB (IY+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x24;
 
@@ -2270,7 +2270,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0xFD, 0x21, 0x3D, 0x24, // LD IY,243DH
                 0xFD, 0x9C              // SBC YH
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.F |= FlagsSetMask.C;
 
             // --- Act
@@ -2307,7 +2307,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0xFD, 0x21, 0x24, 0x3D, // LD IY,3D24H
                 0xFD, 0x9D              // SBC YL
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.F |= FlagsSetMask.C;
 
             // --- Act
@@ -2344,7 +2344,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x37,             // SCF
                 0xFD, 0x9E, 0x54  // SBC (IY+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.F |= FlagsSetMask.C;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x24;
@@ -2382,7 +2382,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x3E, 0x12, // LD A,12H
                 0xFD, 0xA4  // AND YH
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x23AA;
 
             // --- Act
@@ -2418,7 +2418,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x3E, 0x12, // LD A,12H
                 0xFD, 0xA5  // AND YL
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0xAA23;
 
             // --- Act
@@ -2455,7 +2455,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x3E, 0x12,       // LD A,12H
                 0xFD, 0xA6, 0x54  // AND (IY+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x23;
 
@@ -2492,7 +2492,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x3E, 0x12, // LD A,12H
                 0xFD, 0xAC  // XOR YH
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x23AA;
 
             // --- Act
@@ -2528,7 +2528,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x3E, 0x12, // LD A,12H
                 0xFD, 0xAD  // XOR YL
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0xAA23;
 
             // --- Act
@@ -2565,7 +2565,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x3E, 0x12,       // LD A,12H
                 0xFD, 0xAE, 0x54  // XOR (IY+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x23;
 
@@ -2602,7 +2602,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x3E, 0x12, // LD A,12H
                 0xFD, 0xB4  // OR YH
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x23AA;
 
             // --- Act
@@ -2638,7 +2638,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x3E, 0x12, // LD A,12H
                 0xFD, 0xB5  // OR YL
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0xAA23;
 
             // --- Act
@@ -2675,7 +2675,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
                 0x3E, 0x12,       // LD A,12H
                 0xFD, 0xB6, 0x54  // OR (IY+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x23;
 
@@ -2711,7 +2711,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0xB8  // CP YH
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x36;
             regs.IY = 0x24AA;
 
@@ -2746,7 +2746,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0xBD  // CP YL
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x36;
             regs.IY = 0xAA24;
 
@@ -2782,7 +2782,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.IndexedOps
             {
                 0xFD, 0xBE, 0x54 // CP (IY+54H)
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.A = 0x36;
             regs.IY = 0x1000;
             m.Memory[regs.IY + OFFS] = 0x24;
@@ -1,6 +1,7 @@
 ﻿using Microsoft.VisualStudio.TestTools.UnitTesting;
 using Shouldly;
 using Spect.Net.SpectrumEmu.Cpu;
+using Spect.Net.SpectrumEmu.Test.Helpers;
 // ReSharper disable UseObjectOrCollectionInitializer
 
 namespace Spect.Net.SpectrumEmu.Test.Cpu
@@ -179,5 +180,60 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu
             // ReSharper disable once UnusedVariable
             regs[(Reg16Index)12] = 0x00;
         }
+
+        [TestMethod]
+        public void RegistersReferenceModifiesCpu()
+        {
+            // --- Arrange
+            var cpu = new Z80TestMachine(RunMode.OneInstruction).Cpu;
+            ref var regs = ref cpu.Registers;
+
+            // --- Act
+            regs.HL = 0x1234;
+            regs.ExchangeRegisterSet();
+
+            // --- Assert
+            cpu.Registers._HL_.ShouldBe((ushort)0x1234);
+            cpu.Registers.HL.ShouldBe((ushort)0x0000);
+        }
+
+        [TestMethod]
+        public void GetRegistersReturnsSnapshot()
+        {
+            // --- Arrange
+            var cpu = new Z80TestMachine(RunMode.OneInstruction).Cpu;
+            cpu.Registers.BC = 0x1234;
+
+            // --- Act
+            var snapshot = cpu.GetRegisters();
+            cpu.Registers.BC = 0x5678;
+
+            // --- Assert
+            snapshot.BC.ShouldBe((ushort)0x1234);
+            snapshot.B.ShouldBe((byte)0x12);
+            cpu.Registers.BC.ShouldBe((ushort)0x5678);
+        }
+
+        [TestMethod]
+        public void SetRegistersRestoresSnapshot()
+        {
+            // --- Arrange
+            var cpu = new Z80TestMachine(RunMode.OneInstruction).Cpu;
+            cpu.Registers.AF = 0x1234;
+            cpu.Registers.IX = 0xABCD;
+            cpu.Registers.PC = 0x8000;
+            var snapshot = cpu.GetRegisters();
+            cpu.Registers.AF = 0;
+            cpu.Registers.IX = 0;
+            cpu.Registers.PC = 0;
+
+            // --- Act
+            cpu.SetRegisters(snapshot);
+
+            // --- Assert
+            cpu.Registers.AF.ShouldBe((ushort)0x1234);
+            cpu.Registers.IX.ShouldBe((ushort)0xABCD);
+            cpu.Registers.PC.ShouldBe((ushort)0x8000);
+        }
     }
 }
@@ -440,7 +440,7 @@ namespace Spect.Net.SpectrumEmu.Test.Cpu.StandardOps
             {
                 0xD9 // EXX
             });
-            var regs = m.Cpu.Registers;
+            ref var regs = ref m.Cpu.Registers;
             regs.BC = 0xABCD;
             regs._BC_ = 0x2345;
             regs.DE = 0xBCDE;
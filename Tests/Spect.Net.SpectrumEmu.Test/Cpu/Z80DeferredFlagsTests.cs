@@ -0,0 +1,163 @@
+﻿using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Shouldly;
+using Spect.Net.SpectrumEmu.Cpu;
+using Spect.Net.SpectrumEmu.Test.Helpers;
+
+namespace Spect.Net.SpectrumEmu.Test.Cpu
+{
+    [TestClass]
+    public class Z80DeferredFlagsTests
+    {
+        [TestMethod]
+        public void DeferredAluFlagsMatchImmediateFlags()
+        {
+            // --- Arrange
+            var immediate = new Z80TestMachine(RunMode.OneInstruction);
+            var deferred = new Z80TestMachine(RunMode.OneInstruction);
+            deferred.Cpu.DeferredFlags = true;
+
+            for (var opCode = 0x80; opCode < 0xC0; opCode++)
+            {
+                immediate.InitCode(new[] { (byte)opCode });
+                deferred.InitCode(new[] { (byte)opCode });
+                for (var a = 0; a < 0x100; a++)
+                {
+                    for (var operand = 0; operand < 0x100; operand += 3)
+                    {
+                        for (var carry = 0; carry < 2; carry++)
+                        {
+                            // --- Act
+                            var before = new Registers
+                            {
+                                A = (byte)a,
+                                F = (byte)(carry == 0 ? 0x00 : 0xFF),
+                                B = (byte)operand,
+                                C = (byte)operand,
+                                D = (byte)operand,
+                                E = (byte)operand,
+                                HL = 0x8000,
+                                PC = 0x0000
+                            };
+                            if ((opCode & 0x07) == 0x04) before.H = (byte)operand;
+                            if ((opCode & 0x07) == 0x05) before.L = (byte)operand;
+                            immediate.Memory[0x8000] = deferred.Memory[0x8000] = (byte)operand;
+                            immediate.Cpu.SetRegisters(before);
+                            deferred.Cpu.SetRegisters(before);
+                            immediate.Cpu.ExecuteCpuCycle();
+                            deferred.Cpu.ExecuteCpuCycle();
+
+                            // --- Assert
+                            var expected = immediate.Cpu.GetRegisters();
+                            var actual = deferred.Cpu.GetRegisters();
+                            if (actual.AF != expected.AF)
+                            {
+                                Assert.Fail($"Op {opCode:X2}, A={a:X2}, operand={operand:X2}, carry={carry}: "
+                                    + $"AF={actual.AF:X4}, expected {expected.AF:X4}");
+                            }
+                        }
+                    }
+                }
+                immediate.MemoryAccessLog.Clear();
+                deferred.MemoryAccessLog.Clear();
+            }
+        }
+
+        [TestMethod]
+        public void DeferredFlagsAreUsedByConditionalJumps()
+        {
+            // --- Arrange
+            var m = new Z80TestMachine(RunMode.UntilEnd);
+            m.Cpu.DeferredFlags = true;
+            m.InitCode(new byte[]
+            {
+                0x3E, 0x05,       // LD A,05H
+                0x06, 0x05,       // LD B,05H
+                0x90,             // SUB B
+                0x47,             // LD B,A
+                0xCA, 0x0C, 0x00, // JP Z,000CH
+                0x3E, 0x01,       // LD A,01H
+                0x76,             // HALT
+                0x0E, 0x77        // LD C,77H
+            });
+
+            // --- Act
+            m.Run();
+
+            // --- Assert
+            ref var regs = ref m.Cpu.Registers;
+            regs.C.ShouldBe((byte)0x77);
+            regs.ZFlag.ShouldBeTrue();
+            regs.NFlag.ShouldBeTrue();
+        }
+
+        [TestMethod]
+        public void PushAfSavesDeferredFlags()
+        {
+            // --- Arrange
+            var m = new Z80TestMachine(RunMode.UntilEnd);
+            m.Cpu.DeferredFlags = true;
+            m.InitCode(new byte[]
+            {
+                0x31, 0x00, 0x90, // LD SP,9000H
+                0x3E, 0x80,       // LD A,80H
+                0x06, 0x80,       // LD B,80H
+                0x80,             // ADD A,B
+                0x88,             // ADC A,B
+                0xF5              // PUSH AF
+            });
+
+            // --- Act
+            m.Run();
+
+            // --- Assert
+            var expected = new Z80TestMachine(RunMode.UntilEnd);
+            expected.InitCode(new byte[] { 0x31, 0x00, 0x90, 0x3E, 0x80, 0x06, 0x80, 0x80, 0x88, 0xF5 });
+            expected.Run();
+            m.Memory[0x8FFE].ShouldBe(expected.Memory[0x8FFE]);
+            m.Memory[0x8FFF].ShouldBe(expected.Memory[0x8FFF]);
+            m.Cpu.Registers.AF.ShouldBe(expected.Cpu.Registers.AF);
+        }
+
+        [TestMethod]
+        public void TurningOffDeferredFlagsCalculatesF()
+        {
+            // --- Arrange
+            var m = new Z80TestMachine(RunMode.UntilEnd);
+            m.Cpu.DeferredFlags = true;
+            m.InitCode(new byte[]
+            {
+                0x3E, 0xFF, // LD A,FFH
+                0x3C,       // INC A
+                0xB7        // OR A
+            });
+            m.Run();
+
+            // --- Act
+            m.Cpu.DeferredFlags = false;
+
+            // --- Assert
+            m.Cpu.DeferredFlags.ShouldBeFalse();
+            m.Cpu.GetRegisters().F.ShouldBe((byte)(FlagsSetMask.Z | FlagsSetMask.PV));
+        }
+
+        [TestMethod]
+        public void SetRegistersDiscardsDeferredFlags()
+        {
+            // --- Arrange
+            var m = new Z80TestMachine(RunMode.UntilEnd);
+            m.Cpu.DeferredFlags = true;
+            m.InitCode(new byte[]
+            {
+                0xAF // XOR A
+            });
+            m.Run();
+            var regs = new Registers { F = 0x00 };
+
+            // --- Act
+            m.Cpu.SetRegisters(regs);
+
+            // --- Assert
+            m.Cpu.Registers.F.ShouldBe((byte)0x00);
+        }
+    }
+}
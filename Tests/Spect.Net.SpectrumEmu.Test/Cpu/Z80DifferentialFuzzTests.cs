@@ -0,0 +1,64 @@
+﻿using System.Linq;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Shouldly;
+using Spect.Net.SpectrumEmu.Cpu;
+using Spect.Net.SpectrumEmu.Test.Helpers;
+
+namespace Spect.Net.SpectrumEmu.Test.Cpu
+{
+    [TestClass]
+    public class Z80DifferentialFuzzTests
+    {
+        [TestMethod]
+        public void DeferredFlagsMatchReferenceCpu()
+        {
+            // --- Arrange
+            var fuzzer = new Z80DifferentialFuzzer(cpu => cpu.DeferredFlags = true);
+
+            // --- Act
+            var failures = fuzzer.Run(Enumerable.Range(1, 20));
+
+            // --- Assert
+            failures.Count.ShouldBe(0, string.Join("\n", failures));
+        }
+
+        [TestMethod]
+        public void ProfilerDoesNotChangeExecution()
+        {
+            // --- Arrange
+            var fuzzer = new Z80DifferentialFuzzer(cpu => cpu.Profiler = new Z80InstructionProfiler());
+
+            // --- Act
+            var failures = fuzzer.Run(Enumerable.Range(100, 5));
+
+            // --- Assert
+            failures.Count.ShouldBe(0, string.Join("\n", failures));
+        }
+
+        [TestMethod]
+        public void FuzzerReportsShortestSequence()
+        {
+            // --- Arrange
+            var fuzzer = new Z80DifferentialFuzzer(cpu =>
+            {
+                // --- Emulate a faulty fast path for INC A
+                cpu.OperationExecuted += (s, e) =>
+                {
+                    if (e.Instruction.Count == 1 && e.OpCode == 0x3C)
+                    {
+                        cpu.Registers.F ^= FlagsSetMask.H;
+                    }
+                };
+            });
+
+            // --- Act
+            var failure = fuzzer.Run(1);
+
+            // --- Assert
+            failure.ShouldNotBeNull();
+            failure.Message.ShouldContain("AF");
+            failure.Instructions.Count.ShouldBe(1);
+            failure.Instructions[0].ShouldEndWith(": 3C");
+        }
+    }
+}
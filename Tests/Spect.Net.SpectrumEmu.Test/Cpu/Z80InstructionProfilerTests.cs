@@ -0,0 +1,126 @@
+﻿using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Newtonsoft.Json.Linq;
+using Shouldly;
+using Spect.Net.SpectrumEmu.Cpu;
+using Spect.Net.SpectrumEmu.Test.Helpers;
+
+namespace Spect.Net.SpectrumEmu.Test.Cpu
+{
+    [TestClass]
+    public class Z80InstructionProfilerTests
+    {
+        [TestMethod]
+        public void InstructionsAreCountedPerPage()
+        {
+            // --- Arrange
+            var m = new Z80TestMachine(RunMode.UntilEnd);
+            m.InitCode(new byte[]
+            {
+                0x3E, 0x05,             // LD A,05H
+                0x47,                   // LD B,A
+                0x47,                   // LD B,A
+                0xCB, 0x47,             // BIT 0,A
+                0xED, 0x44,             // NEG
+                0xDD, 0x21, 0x00, 0x90, // LD IX,9000H
+                0xDD, 0xCB, 0x01, 0x06, // RLC (IX+01H)
+                0xFD, 0x21, 0x00, 0x90  // LD IY,9000H
+            });
+            var profiler = new Z80InstructionProfiler();
+            m.Cpu.Profiler = profiler;
+            var startTacts = m.Cpu.Tacts;
+
+            // --- Act
+            m.Run();
+
+            // --- Assert
+            profiler.InstructionCount.ShouldBe(8);
+            profiler.InstructionTacts.ShouldBe(m.Cpu.Tacts - startTacts);
+            profiler.GetCount(Z80OpcodePage.Standard, 0x47).ShouldBe(2);
+            profiler.GetTacts(Z80OpcodePage.Standard, 0x47).ShouldBe(8);
+            profiler.GetTacts(Z80OpcodePage.Standard, 0x3E).ShouldBe(7);
+            profiler.GetTacts(Z80OpcodePage.Bit, 0x47).ShouldBe(8);
+            profiler.GetTacts(Z80OpcodePage.Extended, 0x44).ShouldBe(8);
+            profiler.GetTacts(Z80OpcodePage.IndexedIx, 0x21).ShouldBe(14);
+            profiler.GetTacts(Z80OpcodePage.IndexedBitIx, 0x06).ShouldBe(23);
+            profiler.GetCount(Z80OpcodePage.IndexedIy, 0x21).ShouldBe(1);
+            profiler.GetPageCount(Z80OpcodePage.Standard).ShouldBe(3);
+            profiler.GetPageTacts(Z80OpcodePage.Standard).ShouldBe(15);
+        }
+
+        [TestMethod]
+        public void StatisticsAreOrderedByTacts()
+        {
+            // --- Arrange
+            var profiler = new Z80InstructionProfiler();
+
+            // --- Act
+            profiler.RecordInstruction(Z80OpcodePage.Standard, 0x00, 4);
+            profiler.RecordInstruction(Z80OpcodePage.IndexedBitIy, 0x46, 20);
+            profiler.RecordInstruction(Z80OpcodePage.Standard, 0x00, 4);
+            var stats = profiler.GetStatistics();
+
+            // --- Assert
+            stats.Count.ShouldBe(2);
+            stats[0].Prefix.ShouldBe("FD CB");
+            stats[0].OpCode.ShouldBe((byte)0x46);
+            stats[1].Count.ShouldBe(2);
+            stats[1].AverageTacts.ShouldBe(4.0);
+        }
+
+        [TestMethod]
+        public void IoContentionExcludesIoCycle()
+        {
+            // --- Arrange
+            var profiler = new Z80InstructionProfiler();
+
+            // --- Act
+            profiler.RecordIoCycle(4);
+            profiler.RecordIoCycle(7);
+            profiler.RecordMemoryContention(0);
+            profiler.RecordMemoryContention(6);
+
+            // --- Assert
+            profiler.IoContentionTacts.ShouldBe(3);
+            profiler.MemoryContentionTacts.ShouldBe(6);
+        }
+
+        [TestMethod]
+        public void RemovedProfilerDoesNotCollect()
+        {
+            // --- Arrange
+            var m = new Z80TestMachine(RunMode.UntilEnd);
+            m.InitCode(new byte[]
+            {
+                0x00, // NOP
+                0x00  // NOP
+            });
+            var profiler = new Z80InstructionProfiler();
+            m.Cpu.Profiler = profiler;
+            m.Cpu.Profiler = null;
+
+            // --- Act
+            m.Run();
+
+            // --- Assert
+            profiler.InstructionCount.ShouldBe(0);
+        }
+
+        [TestMethod]
+        public void ToJsonExportsOpCodes()
+        {
+            // --- Arrange
+            var profiler = new Z80InstructionProfiler();
+            profiler.RecordInstruction(Z80OpcodePage.Extended, 0xB0, 21);
+
+            // --- Act
+            var json = JObject.Parse(profiler.ToJson());
+
+            // --- Assert
+            json["InstructionTacts"].Value<long>().ShouldBe(21);
+            ((JArray)json["Pages"]).Count.ShouldBe(Z80InstructionProfiler.PAGE_COUNT);
+            json["OpCodes"][0]["Prefix"].Value<string>().ShouldBe("ED");
+            json["OpCodes"][0]["OpCode"].Value<string>().ShouldBe("B0");
+            profiler.ToTable().ShouldContain("ED");
+        }
+    }
+}
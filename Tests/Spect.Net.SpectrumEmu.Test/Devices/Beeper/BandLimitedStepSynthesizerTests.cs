@@ -0,0 +1,82 @@
+﻿using System;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Shouldly;
+using Spect.Net.SpectrumEmu.Devices.Beeper;
+
+namespace Spect.Net.SpectrumEmu.Test.Devices.Beeper
+{
+    [TestClass]
+    public class BandLimitedStepSynthesizerTests
+    {
+        private const int TACTS_PER_SAMPLE = 100;
+
+        [TestMethod]
+        public void StepSettlesBeforeAndAfterEdge()
+        {
+            // --- Arrange
+            var synth = new BandLimitedStepSynthesizer(TACTS_PER_SAMPLE);
+            var samples = new float[200];
+            synth.AddEdge(5050, 1.0f);
+
+            // --- Act
+            synth.Render(samples, 0, samples.Length, 0);
+
+            // --- Assert: the edge appears after the synthesis delay
+            var edgeSample = (5050 + synth.Delay) / TACTS_PER_SAMPLE;
+            for (var i = 0; i < edgeSample - BandLimitedStepSynthesizer.DEFAULT_HALF_WIDTH; i++)
+            {
+                samples[i].ShouldBe(0.0f);
+            }
+            for (var i = edgeSample + BandLimitedStepSynthesizer.DEFAULT_HALF_WIDTH + 1; i < samples.Length; i++)
+            {
+                samples[i].ShouldBe(1.0f);
+            }
+            samples[edgeSample].ShouldBeInRange(0.0f, 1.0f);
+        }
+
+        [TestMethod]
+        public void ContiguousBlocksMatchSingleBlock()
+        {
+            // --- Arrange
+            var single = new BandLimitedStepSynthesizer(TACTS_PER_SAMPLE);
+            var split = new BandLimitedStepSynthesizer(TACTS_PER_SAMPLE);
+            var expected = new float[300];
+            var actual = new float[300];
+            var level = false;
+            foreach (var tact in new long[] { 1234, 1299, 4567, 9950, 10010, 14999, 20000, 27123 })
+            {
+                level = !level;
+                single.AddEdge(tact, level ? 1.0f : -1.0f);
+                split.AddEdge(tact, level ? 1.0f : -1.0f);
+            }
+
+            // --- Act
+            single.Render(expected, 0, expected.Length, 0);
+            split.Render(actual, 0, 100, 0);
+            split.Render(actual, 100, 130, 100 * TACTS_PER_SAMPLE);
+            split.Render(actual, 230, 70, 230 * TACTS_PER_SAMPLE);
+
+            // --- Assert
+            for (var i = 0; i < expected.Length; i++)
+            {
+                Math.Abs(actual[i] - expected[i]).ShouldBeLessThan(1e-6f);
+            }
+        }
+
+        [TestMethod]
+        public void RenderDropsSettledEdges()
+        {
+            // --- Arrange
+            var synth = new BandLimitedStepSynthesizer(TACTS_PER_SAMPLE);
+            var samples = new float[100];
+            synth.AddEdge(1000, 1.0f);
+            synth.AddEdge(9900, -1.0f);
+
+            // --- Act
+            synth.Render(samples, 0, samples.Length, 0);
+
+            // --- Assert: only the edge close to the block end is kept
+            synth.EdgeCount.ShouldBe(1);
+        }
+    }
+}
@@ -0,0 +1,148 @@
+﻿using System;
+using System.IO;
+using System.Linq;
+using System.Threading;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Shouldly;
+using Spect.Net.RomResources;
+using Spect.Net.SpectrumEmu.Abstraction.Devices;
+using Spect.Net.SpectrumEmu.Abstraction.Providers;
+using Spect.Net.SpectrumEmu.Devices.Floppy;
+using Spect.Net.SpectrumEmu.Machine;
+using Spect.Net.SpectrumEmu.Scripting;
+
+namespace Spect.Net.SpectrumEmu.Test.Devices.Floppy
+{
+    [TestClass]
+    public class FloppyDeviceTest
+    {
+        private const ushort CODE_ADDRESS = 0x8000;
+        private const ushort XDPB_ADDRESS = 0x9000;
+        private const ushort BUFFER_ADDRESS = 0xA000;
+        private const ushort DD_READ_SECTOR = 0x1C75;
+        private const ushort DD_WRITE_SECTOR = 0x1C83;
+
+        public static string TestFile { get; set; }
+
+        [ClassInitialize]
+        public static void ClassInitialize(TestContext context)
+        {
+            TestFile = Path.Combine(Environment.GetFolderPath(Environment.SpecialFolder.UserProfile), "FastDisk.vfdd");
+        }
+
+        [TestInitialize]
+        public void TestInitialize()
+        {
+            SpectrumMachine.Reset();
+            SpectrumMachine.RegisterProvider<IRomProvider>(()
+                => new ResourceRomProvider(typeof(RomResourcesPlaceHolder).Assembly));
+        }
+
+        [TestMethod]
+        public void FastDiskModeReadsSector()
+        {
+            // --- Arrange
+            var floppy = VirtualFloppyFile.CreateSpectrumFloppyFile(TestFile);
+            var sector = Enumerable.Range(0, 512).Select(i => (byte)i).ToArray();
+            floppy.WriteData(0, 3, 2, sector);
+            floppy.Flush();
+            var vm = CreateVm(DD_READ_SECTOR);
+
+            // --- Act
+            var completed = vm.ExecuteCycle(CancellationToken.None, CreateOptions(true));
+
+            // --- Assert
+            completed.ShouldBeTrue();
+            vm.Cpu.PC.ShouldBe((ushort)(CODE_ADDRESS + 3));
+            (vm.Cpu.Registers.F & 0x01).ShouldBe(0x01);
+            for (var i = 0; i < sector.Length; i++)
+            {
+                vm.MemoryDevice.Read((ushort)(BUFFER_ADDRESS + i), true).ShouldBe(sector[i]);
+            }
+        }
+
+        [TestMethod]
+        public void FastDiskModeWritesSector()
+        {
+            // --- Arrange
+            VirtualFloppyFile.CreateSpectrumFloppyFile(TestFile);
+            var vm = CreateVm(DD_WRITE_SECTOR);
+            for (var i = 0; i < 512; i++)
+            {
+                vm.MemoryDevice.Write((ushort)(BUFFER_ADDRESS + i), (byte)(i ^ 0x55), true);
+            }
+
+            // --- Act
+            var completed = vm.ExecuteCycle(CancellationToken.None, CreateOptions(true));
+            vm.FloppyDevice.Flush();
+
+            // --- Assert
+            completed.ShouldBeTrue();
+            (vm.Cpu.Registers.F & 0x01).ShouldBe(0x01);
+            var data = vm.FloppyDevice.DriveAFloppy.ReadData(0, 3, 2, 512);
+            for (var i = 0; i < data.Length; i++)
+            {
+                data[i].ShouldBe((byte)(i ^ 0x55));
+            }
+        }
+
+        [TestMethod]
+        public void SectorRoutineIsNotTrappedWithoutFastDiskMode()
+        {
+            // --- Arrange
+            VirtualFloppyFile.CreateSpectrumFloppyFile(TestFile);
+            var vm = CreateVm(DD_READ_SECTOR);
+            vm.MemoryDevice.Write(BUFFER_ADDRESS, 0xA5, true);
+
+            // --- Act
+            var completed = vm.ExecuteCycle(CancellationToken.None, CreateOptions(false));
+
+            // --- Assert
+            completed.ShouldBeFalse();
+            vm.MemoryDevice.Read(BUFFER_ADDRESS, true).ShouldBe((byte)0xA5);
+        }
+
+        /// <summary>
+        /// Creates a +3 machine that calls the specified +3DOS routine
+        /// to transfer logical sector 1 of track 3 of drive A:
+        /// </summary>
+        private static ISpectrumVm CreateVm(ushort routine)
+        {
+            var vm = SpectrumMachine.CreateMachine(SpectrumModels.ZX_SPECTRUM_P3_E, SpectrumModels.PAL).SpectrumVm;
+            vm.Reset();
+            vm.FloppyDevice.InsertDriveA(TestFile).Wait();
+
+            // --- CALL routine; HALT
+            var memory = vm.MemoryDevice;
+            memory.SelectRom(2);
+            var code = new byte[] { 0xCD, (byte)routine, (byte)(routine >> 8), 0x76 };
+            for (var i = 0; i < code.Length; i++)
+            {
+                memory.Write((ushort)(CODE_ADDRESS + i), code[i], true);
+            }
+
+            // --- Single-sided, 40 tracks, 9 sectors of 512 bytes
+            memory.Write(XDPB_ADDRESS + 17, 0x00, true);
+            memory.Write(XDPB_ADDRESS + 18, 40, true);
+            memory.Write(XDPB_ADDRESS + 19, 9, true);
+            memory.Write(XDPB_ADDRESS + 20, 1, true);
+            memory.Write(XDPB_ADDRESS + 21, 2, true);
+
+            ref var regs = ref vm.Cpu.Registers;
+            regs.PC = CODE_ADDRESS;
+            regs.SP = 0x7000;
+            regs.BC = 0x0000;
+            regs.DE = 0x0301;
+            regs.HL = BUFFER_ADDRESS;
+            regs.IX = XDPB_ADDRESS;
+            return vm;
+        }
+
+        private static ExecuteCycleOptions CreateOptions(bool fastDiskMode)
+            => new ExecuteCycleOptions(EmulationMode.UntilExecutionPoint,
+                terminationPoint: CODE_ADDRESS + 3,
+                fastVmMode: true,
+                timeoutTacts: 2000,
+                fastDiskMode: fastDiskMode);
+    }
+}
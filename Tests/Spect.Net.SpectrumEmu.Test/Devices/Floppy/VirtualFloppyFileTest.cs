@@ -58,19 +58,21 @@ namespace Spect.Net.SpectrumEmu.Test.Devices.Floppy
             // --- Arrange
             var floppy = VirtualFloppyFile.CreateSpectrumFloppyFile(TestFile);
             var data = new byte[] {0x01, 0x02, 0x03, 0x04};
-            floppy.WriteData(1, 3, 5, data);
+            floppy.WriteData(0, 3, 5, data);
+            floppy.Close();
 
             // --- Act
             floppy = VirtualFloppyFile.OpenOrCreateFloppyFile(TestFile);
 
             // --- Assert
-            var dataBack = floppy.ReadData(1, 3, 5, data.Length);
+            var dataBack = floppy.ReadData(0, 3, 5, data.Length);
             dataBack.SequenceEqual(data).ShouldBeTrue();
         }
 
         [TestMethod]
         [ExpectedException(typeof(ArgumentException))]
         [DataRow(2, 1, 1, 1)]
+        [DataRow(1, 1, 1, 1)]
         [DataRow(0, -1, 1, 1)]
         [DataRow(0, 40, 1, 1)]
         [DataRow(0, 30, 0, 1)]
@@ -89,6 +91,7 @@ namespace Spect.Net.SpectrumEmu.Test.Devices.Floppy
         [TestMethod]
         [ExpectedException(typeof(ArgumentException))]
         [DataRow(2, 1, 1, 1)]
+        [DataRow(1, 1, 1, 1)]
         [DataRow(0, -1, 1, 1)]
         [DataRow(0, 40, 1, 1)]
         [DataRow(0, 30, 0, 1)]
@@ -105,5 +108,76 @@ namespace Spect.Net.SpectrumEmu.Test.Devices.Floppy
             floppy.WriteData(head, track, sector, data);
         }
 
+        [TestMethod]
+        public void WriteIsKeptInJournalUntilFlush()
+        {
+            // --- Arrange
+            var floppy = VirtualFloppyFile.CreateSpectrumFloppyFile(TestFile);
+            var data = new byte[] {0x01, 0x02, 0x03, 0x04};
+
+            // --- Act
+            floppy.WriteData(0, 2, 3, data);
+
+            // --- Assert
+            floppy.HasPendingWrites.ShouldBeTrue();
+            File.Exists(floppy.JournalFilename).ShouldBeTrue();
+            floppy.ReadData(0, 2, 3, data.Length).SequenceEqual(data).ShouldBeTrue();
+            ReadImage(floppy, 0, 2, 3, data.Length).ShouldBe(new byte[] {0xE5, 0xE5, 0xE5, 0xE5});
+            floppy.Close();
+        }
+
+        [TestMethod]
+        public void FlushWritesImageAndRemovesJournal()
+        {
+            // --- Arrange
+            var floppy = VirtualFloppyFile.CreateSpectrumFloppyFile(TestFile);
+            var data = new byte[] {0x01, 0x02, 0x03, 0x04};
+            floppy.WriteData(0, 2, 3, data);
+            floppy.WriteData(0, 2, 4, data);
+
+            // --- Act
+            floppy.Flush();
+
+            // --- Assert
+            floppy.HasPendingWrites.ShouldBeFalse();
+            File.Exists(floppy.JournalFilename).ShouldBeFalse();
+            ReadImage(floppy, 0, 2, 3, data.Length).ShouldBe(data);
+            ReadImage(floppy, 0, 2, 4, data.Length).ShouldBe(data);
+        }
+
+        [TestMethod]
+        public void OpeningReplaysJournalOfUnflushedWrites()
+        {
+            // --- Arrange
+            var floppy = VirtualFloppyFile.CreateSpectrumFloppyFile(TestFile);
+            floppy.WriteData(0, 3, 5, new byte[] {0x01, 0x02});
+            floppy.WriteData(0, 3, 5, new byte[] {0x03});
+            floppy.Close();
+
+            // --- Simulate a crash within the third record
+            using (var journal = new FileStream(floppy.JournalFilename, FileMode.Append))
+            {
+                journal.Write(new byte[] {0x08, 0x00, 0x00}, 0, 3);
+            }
+
+            // --- Act
+            var reopened = VirtualFloppyFile.OpenFloppyFile(TestFile);
+
+            // --- Assert
+            File.Exists(reopened.JournalFilename).ShouldBeFalse();
+            ReadImage(reopened, 0, 3, 5, 3).ShouldBe(new byte[] {0x03, 0x02, 0xE5});
+            reopened.ReadData(0, 3, 5, 3).ShouldBe(new byte[] {0x03, 0x02, 0xE5});
+        }
+
+        /// <summary>
+        /// Reads sector data directly from the image file
+        /// </summary>
+        private static byte[] ReadImage(VirtualFloppyFile floppy, int head, int track, int sector, int length)
+        {
+            var position = VirtualFloppyFile.HEADER_SIZE
+                + (head * floppy.Tracks * floppy.SectorsPerTrack + track * floppy.SectorsPerTrack + sector - 1)
+                * VirtualFloppyFile.SECTOR_SIZE;
+            return File.ReadAllBytes(floppy.Filename).Skip(position).Take(length).ToArray();
+        }
     }
 }
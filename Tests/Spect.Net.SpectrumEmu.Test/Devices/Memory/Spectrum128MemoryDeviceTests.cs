@@ -458,5 +458,34 @@ namespace Spect.Net.SpectrumEmu.Test.Devices.Memory
                 dev.Read((ushort)i).ShouldBe((byte)bank);
             }
         }
+
+        [TestMethod]
+        public void RestoreStateRemapsPages()
+        {
+            // --- Arrange
+            var dev = new Spectrum128MemoryDevice();
+            dev.OnAttachedToVm(null);
+            for (var i = 0; i < 0x4000; i++)
+            {
+                for (var b = 0; b < 8; b++)
+                {
+                    dev.RamBanks[b][i] = (byte)b;
+                }
+            }
+            dev.PageIn(3, 6);
+            var state = dev.GetState();
+            var other = new Spectrum128MemoryDevice();
+            other.OnAttachedToVm(null);
+
+            // --- Act
+            other.RestoreState(state);
+            other.Write(0xC000, 0x3C);
+
+            // --- Assert
+            other.GetSelectedBankIndex(3).ShouldBe(6);
+            other.Read(0x4000).ShouldBe((byte)0x05);
+            other.Read(0xC001).ShouldBe((byte)0x06);
+            other.RamBanks[6][0].ShouldBe((byte)0x3C);
+        }
     }
 }
@@ -0,0 +1,70 @@
+﻿using System.Linq;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Shouldly;
+using Spect.Net.SpectrumEmu.Devices.Ports;
+
+namespace Spect.Net.SpectrumEmu.Test.Devices.Port
+{
+    [TestClass]
+    public class PortHandlerDispatchTableTests
+    {
+        [TestMethod]
+        public void DispatchTableMatchesLinearScanForSpectrum48()
+        {
+            DispatchTableMatchesLinearScan(new Spectrum48PortDevice());
+        }
+
+        [TestMethod]
+        public void DispatchTableMatchesLinearScanForSpectrum128()
+        {
+            DispatchTableMatchesLinearScan(new Spectrum128PortDevice());
+        }
+
+        [TestMethod]
+        public void DispatchTableMatchesLinearScanForSpectrumP3()
+        {
+            DispatchTableMatchesLinearScan(new SpectrumP3PortDevice());
+        }
+
+        [TestMethod]
+        public void DispatchTableMatchesLinearScanForSpectrumNext()
+        {
+            DispatchTableMatchesLinearScan(new SpectrumNextPortDevice());
+        }
+
+        [TestMethod]
+        public void UndecodedPortHasNoHandlers()
+        {
+            // --- Arrange
+            var device = new Spectrum48PortDevice();
+
+            // --- Act
+            var table = new PortHandlerDispatchTable(device.Handlers);
+
+            // --- Assert: odd address with A0-A4 not all set is neither ULA nor Kempston
+            table.GetReadHandlers(0x00FD).Length.ShouldBe(0);
+            table.GetWriteHandlers(0x00FD).Length.ShouldBe(0);
+        }
+
+        private static void DispatchTableMatchesLinearScan(GenericPortDeviceBase device)
+        {
+            // --- Act
+            var table = new PortHandlerDispatchTable(device.Handlers);
+
+            // --- Assert
+            table.HandlerCount.ShouldBe(device.Handlers.Count);
+            for (var addr = 0; addr < 0x1_0000; addr++)
+            {
+                var port = (ushort)addr;
+                var expectedRead = device.Handlers
+                    .Where(h => h.CanRead && (port & h.PortMask) == h.Port)
+                    .ToArray();
+                var expectedWrite = device.Handlers
+                    .Where(h => h.CanWrite && (port & h.PortMask) == h.Port)
+                    .ToArray();
+                table.GetReadHandlers(port).SequenceEqual(expectedRead).ShouldBeTrue();
+                table.GetWriteHandlers(port).SequenceEqual(expectedWrite).ShouldBeTrue();
+            }
+        }
+    }
+}
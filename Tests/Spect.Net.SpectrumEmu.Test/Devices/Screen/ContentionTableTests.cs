@@ -0,0 +1,51 @@
+﻿using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Shouldly;
+using Spect.Net.SpectrumEmu.Devices.Screen;
+using Spect.Net.SpectrumEmu.Test.Helpers;
+
+namespace Spect.Net.SpectrumEmu.Test.Devices.Screen
+{
+    [TestClass]
+    public class ContentionTableTests
+    {
+        [TestMethod]
+        [DataRow(1)]
+        [DataRow(2)]
+        [DataRow(4)]
+        public void ContentionTableMatchesStepByStepCalculation(int multiplier)
+        {
+            // --- Arrange
+            var spectrum = new SpectrumAdvancedTestMachine();
+            var renderingTable = spectrum.ScreenDevice.RenderingTactTable;
+            var frameTacts = renderingTable.Length;
+
+            // --- Act
+            var table = new ContentionTable(renderingTable, multiplier);
+
+            // --- Assert
+            table.FrameTactCount.ShouldBe(frameTacts);
+            for (var cpuTact = 0; cpuTact < frameTacts * multiplier + 100; cpuTact++)
+            {
+                var tact = cpuTact;
+                byte C(int delay) => renderingTable[(tact + delay) / multiplier % frameTacts].ContentionDelay;
+
+                table.GetMemoryDelay(cpuTact).ShouldBe(C(0));
+
+                var d = 0;
+                for (var i = 0; i < 4; i++)
+                {
+                    d += C(d) + 1;
+                }
+                table.GetIoC1X4Delay(cpuTact).ShouldBe((byte)d);
+
+                d = C(0) + 1;
+                d += C(d) + 3;
+                table.GetIoC1C3Delay(cpuTact).ShouldBe((byte)d);
+
+                d = 1;
+                d += C(d) + 3;
+                table.GetIoN1C3Delay(cpuTact).ShouldBe((byte)d);
+            }
+        }
+    }
+}
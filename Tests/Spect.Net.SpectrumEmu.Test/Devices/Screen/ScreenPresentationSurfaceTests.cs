@@ -0,0 +1,135 @@
+﻿using System.Threading;
+using System.Threading.Tasks;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Shouldly;
+using Spect.Net.SpectrumEmu.Devices.Screen;
+
+namespace Spect.Net.SpectrumEmu.Test.Devices.Screen
+{
+    [TestClass]
+    public class ScreenPresentationSurfaceTests
+    {
+        [TestMethod]
+        [DataRow(8)]
+        [DataRow(13)]
+        [DataRow(352)]
+        public void ConvertScanlineUsesSpectrumColors(int width)
+        {
+            // --- Arrange
+            var surface = new ScreenPresentationSurface(width, 3);
+            var pixels = new byte[width * 3];
+            for (var i = 0; i < pixels.Length; i++)
+            {
+                pixels[i] = (byte)(i * 7);
+            }
+
+            // --- Act
+            surface.Present(pixels);
+            var frame = surface.AcquireFrame(out var isNew);
+
+            // --- Assert
+            isNew.ShouldBeTrue();
+            for (var i = 0; i < pixels.Length; i++)
+            {
+                frame[i].ShouldBe(Spectrum48ScreenDevice.SpectrumColors[pixels[i] & 0x0F]);
+            }
+        }
+
+        [TestMethod]
+        public void AcquireFrameReturnsLatestFrameOnce()
+        {
+            // --- Arrange
+            var surface = new ScreenPresentationSurface(8, 1);
+
+            // --- Act
+            surface.Present(Frame(1));
+            surface.Present(Frame(2));
+            var first = surface.AcquireFrame(out var firstIsNew);
+            var firstColor = first[0];
+            var second = surface.AcquireFrame(out var secondIsNew);
+
+            // --- Assert
+            firstIsNew.ShouldBeTrue();
+            firstColor.ShouldBe(Spectrum48ScreenDevice.SpectrumColors[2]);
+            secondIsNew.ShouldBeFalse();
+            second.ShouldBeSameAs(first);
+            surface.PresentedFrames.ShouldBe(2);
+        }
+
+        [TestMethod]
+        public void PresentDoesNotOverwriteDisplayedFrame()
+        {
+            // --- Arrange
+            var surface = new ScreenPresentationSurface(8, 1);
+            surface.Present(Frame(3));
+            var displayed = surface.AcquireFrame(out _);
+
+            // --- Act
+            surface.Present(Frame(4));
+            surface.Present(Frame(5));
+            surface.Present(Frame(6));
+
+            // --- Assert
+            displayed[0].ShouldBe(Spectrum48ScreenDevice.SpectrumColors[3]);
+            surface.AcquireFrame(out _)[0].ShouldBe(Spectrum48ScreenDevice.SpectrumColors[6]);
+        }
+
+        [TestMethod]
+        public void SetPaletteChangesNextConversion()
+        {
+            // --- Arrange
+            var surface = new ScreenPresentationSurface(8, 1);
+
+            // --- Act
+            surface.SetPalette(new uint[] { 0xFF112233, 0xFF445566 });
+            surface.Present(Frame(3));
+
+            // --- Assert
+            surface.AcquireFrame(out _)[0].ShouldBe(0xFF445566u);
+        }
+
+        [TestMethod]
+        public void UiThreadNeverSeesHalfConvertedFrame()
+        {
+            // --- Arrange
+            const int FRAMES = 2000;
+            var surface = new ScreenPresentationSurface(256, 8);
+            var done = 0;
+            var torn = 0;
+
+            // --- Act
+            var producer = Task.Run(() =>
+            {
+                for (var i = 0; i < FRAMES; i++)
+                {
+                    surface.Present(Frame(i & 0x0F, 256 * 8));
+                }
+                Volatile.Write(ref done, 1);
+            });
+            while (Volatile.Read(ref done) == 0)
+            {
+                var frame = surface.AcquireFrame(out var isNew);
+                if (!isNew) continue;
+                for (var i = 1; i < frame.Length; i++)
+                {
+                    if (frame[i] != frame[0]) torn++;
+                }
+            }
+            producer.Wait();
+
+            // --- Assert
+            torn.ShouldBe(0);
+            surface.AcquireFrame(out _)[0].ShouldBe(Spectrum48ScreenDevice.SpectrumColors[(FRAMES - 1) & 0x0F]);
+        }
+
+        private static byte[] Frame(int color, int length = 8)
+        {
+            var pixels = new byte[length];
+            for (var i = 0; i < pixels.Length; i++)
+            {
+                pixels[i] = (byte)color;
+            }
+            return pixels;
+        }
+    }
+}
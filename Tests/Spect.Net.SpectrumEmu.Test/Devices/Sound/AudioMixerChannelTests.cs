@@ -0,0 +1,101 @@
+﻿using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Shouldly;
+using Spect.Net.SpectrumEmu.Devices.Sound;
+
+namespace Spect.Net.SpectrumEmu.Test.Devices.Sound
+{
+    [TestClass]
+    public class AudioMixerChannelTests
+    {
+        [TestMethod]
+        public void SameRatePassesSamplesThrough()
+        {
+            // --- Arrange
+            var channel = new AudioMixerChannel("Test", null, 100, 100);
+            var input = new[] { 0.1f, 0.2f, 0.3f, 0.4f };
+            var output = new float[4];
+
+            // --- Act
+            channel.Consume(input, input.Length);
+            channel.MixInto(output, output.Length);
+
+            // --- Assert: the output is delayed by one sample
+            output[0].ShouldBe(0.0f);
+            output[1].ShouldBe(0.1f);
+            output[3].ShouldBe(0.3f);
+            channel.PendingCount.ShouldBe(0);
+        }
+
+        [TestMethod]
+        [DataRow(128, 100)]
+        [DataRow(64, 100)]
+        [DataRow(100, 128)]
+        public void ResamplingKeepsTheTactRatio(int sourceTacts, int outputTacts)
+        {
+            // --- Arrange
+            var channel = new AudioMixerChannel("Test", null, sourceTacts, outputTacts);
+            const int FRAMES = 50;
+            const int FRAME_TACTS = 69888;
+            var produced = 0L;
+            var sourceTact = 0L;
+
+            // --- Act
+            for (var frame = 1; frame <= FRAMES; frame++)
+            {
+                var count = 0;
+                while (sourceTact < (long)frame * FRAME_TACTS)
+                {
+                    sourceTact += sourceTacts;
+                    count++;
+                }
+                channel.Consume(new float[count], count);
+                produced += channel.PendingCount;
+                channel.MixInto(new float[channel.PendingCount], channel.PendingCount);
+            }
+
+            // --- Assert
+            var expected = (double)FRAMES * FRAME_TACTS / outputTacts;
+            produced.ShouldBeInRange((long)expected - 2, (long)expected + 2);
+        }
+
+        [TestMethod]
+        public void GainAndMuteAreApplied()
+        {
+            // --- Arrange
+            var channel = new AudioMixerChannel("Test", null, 100, 100, 0.5f);
+            var output = new float[] { 0.25f, 0.25f, 0.25f };
+
+            // --- Act
+            channel.Consume(new[] { 1.0f, 1.0f, 1.0f, 1.0f }, 4);
+            channel.MixInto(output, 3);
+            channel.Muted = true;
+            channel.Consume(new[] { 1.0f }, 1);
+            var muted = new float[2];
+            channel.MixInto(muted, 2);
+
+            // --- Assert
+            output[0].ShouldBe(0.25f);
+            output[1].ShouldBe(0.75f);
+            output[2].ShouldBe(0.75f);
+            muted[0].ShouldBe(0.0f);
+            muted[1].ShouldBe(0.0f);
+        }
+
+        [TestMethod]
+        public void ShortChannelHoldsLastSample()
+        {
+            // --- Arrange
+            var channel = new AudioMixerChannel("Test", null, 100, 100);
+            var output = new float[4];
+
+            // --- Act
+            channel.Consume(new[] { 0.5f, 0.5f }, 2);
+            channel.MixInto(output, output.Length);
+
+            // --- Assert
+            output[1].ShouldBe(0.5f);
+            output[2].ShouldBe(0.5f);
+            output[3].ShouldBe(0.5f);
+        }
+    }
+}
@@ -0,0 +1,136 @@
+﻿using System.IO;
+using System.Text;
+using System.Threading;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Shouldly;
+using Spect.Net.SpectrumEmu.Devices.Sound;
+using Spect.Net.SpectrumEmu.Machine;
+using Spect.Net.SpectrumEmu.Providers;
+using Spect.Net.SpectrumEmu.Test.Helpers;
+
+namespace Spect.Net.SpectrumEmu.Test.Devices.Sound
+{
+    [TestClass]
+    public class AudioMixerDeviceTests
+    {
+        [TestMethod]
+        public void MixerHasBeeperAndPsgChannels()
+        {
+            // --- Arrange
+            var spectrum = new Spectrum128AdvancedTestMachine();
+            var mixer = new AudioMixerDevice();
+
+            // --- Act
+            mixer.OnAttachedToVm(spectrum);
+
+            // --- Assert
+            mixer.TactsPerSample.ShouldBe(100);
+            mixer.Channels.Count.ShouldBe(2);
+            mixer.GetChannel(AudioMixerDevice.BEEPER_CHANNEL).SourceTactsPerSample.ShouldBe(100);
+            mixer.GetChannel(AudioMixerDevice.PSG_CHANNEL).SourceTactsPerSample.ShouldBe(64);
+        }
+
+        [TestMethod]
+        public void ChannelsAtFullLevelDoNotClip()
+        {
+            // --- Arrange
+            var spectrum = new Spectrum128AdvancedTestMachine();
+            var mixer = new AudioMixerDevice();
+            mixer.OnAttachedToVm(spectrum);
+            var beeper = mixer.GetChannel(AudioMixerDevice.BEEPER_CHANNEL);
+            var psg = mixer.GetChannel(AudioMixerDevice.PSG_CHANNEL);
+            var full = new[] { 1.0f, 1.0f, 1.0f, 1.0f };
+            var samples = new float[3];
+
+            // --- Act
+            beeper.Consume(full, full.Length);
+            psg.Consume(full, full.Length);
+            beeper.MixInto(samples, samples.Length);
+            psg.MixInto(samples, samples.Length);
+
+            // --- Assert
+            beeper.Gain.ShouldBe(0.5f);
+            psg.Gain.ShouldBe(0.5f);
+            samples[samples.Length - 1].ShouldBeLessThanOrEqualTo(1.0f);
+            samples[samples.Length - 1].ShouldBeGreaterThan(0.5f);
+        }
+
+        [TestMethod]
+        public void MixedFrameFollowsBeeper()
+        {
+            // --- Arrange
+            var spectrum = new Spectrum128AdvancedTestMachine();
+            var mixer = new AudioMixerDevice();
+            mixer.OnAttachedToVm(spectrum);
+            mixer.GetChannel(AudioMixerDevice.PSG_CHANNEL).Muted = true;
+            spectrum.InitCode(new byte[]
+            {
+                0x3E, 0x10,       // LD A,$10
+                0xD3, 0xFE,       // OUT ($FE),A
+                0x76              // HALT
+            });
+
+            // --- Act
+            spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.UntilFrameEnds));
+            mixer.OnFrameCompleted();
+
+            // --- Assert
+            var beeper = spectrum.BeeperDevice;
+            var gain = mixer.GetChannel(AudioMixerDevice.BEEPER_CHANNEL).Gain;
+            mixer.NextSampleIndex.ShouldBe(beeper.NextSampleIndex);
+            for (var i = 1; i < mixer.NextSampleIndex; i++)
+            {
+                mixer.AudioSamples[i].ShouldBe(beeper.AudioSamples[i - 1] * gain);
+            }
+        }
+
+        [TestMethod]
+        public void WaveFileProviderWritesHeaderAndSamples()
+        {
+            // --- Arrange
+            var spectrum = new Spectrum128AdvancedTestMachine();
+            var stream = new MemoryStream();
+            var provider = new WaveFileAudioProvider(stream);
+            provider.OnAttachedToVm(spectrum);
+
+            // --- Act
+            provider.AddSoundFrame(new[] { 0.0f, 1.0f, -1.0f, 2.0f });
+            provider.Flush();
+
+            // --- Assert
+            var bytes = stream.ToArray();
+            bytes.Length.ShouldBe(44 + 8);
+            Encoding.ASCII.GetString(bytes, 0, 4).ShouldBe("RIFF");
+            Encoding.ASCII.GetString(bytes, 8, 4).ShouldBe("WAVE");
+            var reader = new BinaryReader(new MemoryStream(bytes));
+            reader.BaseStream.Position = 4;
+            reader.ReadInt32().ShouldBe(36 + 8);
+            reader.BaseStream.Position = 24;
+            reader.ReadInt32().ShouldBe(35000);
+            reader.BaseStream.Position = 40;
+            reader.ReadInt32().ShouldBe(8);
+            reader.ReadInt16().ShouldBe((short)0);
+            reader.ReadInt16().ShouldBe(short.MaxValue);
+            reader.ReadInt16().ShouldBe((short)-short.MaxValue);
+            reader.ReadInt16().ShouldBe(short.MaxValue);
+            provider.SamplesWritten.ShouldBe(4);
+        }
+
+        [TestMethod]
+        public void RawProviderWritesSamplesOnly()
+        {
+            // --- Arrange
+            var spectrum = new Spectrum128AdvancedTestMachine();
+            var stream = new MemoryStream();
+            var provider = new WaveFileAudioProvider(stream, AudioFileFormat.RawPcm16);
+            provider.OnAttachedToVm(spectrum);
+
+            // --- Act
+            provider.AddSoundFrame(new[] { 0.5f, -0.5f });
+            provider.Flush();
+
+            // --- Assert
+            stream.ToArray().Length.ShouldBe(4);
+        }
+    }
+}
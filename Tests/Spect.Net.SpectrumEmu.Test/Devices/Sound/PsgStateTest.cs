@@ -729,6 +729,64 @@ namespace Spect.Net.SpectrumEmu.Test.Devices.Sound
             psg.Register14.ShouldBe((byte)14);
         }
 
+        [TestMethod]
+        [DataRow(0x0123, 0x0000, 0x00, 0x38, 0x0F, 0x0000, 0x00)]
+        [DataRow(0x0007, 0x0FFF, 0x00, 0x38, 0x0C, 0x0000, 0x00)]
+        [DataRow(0x0045, 0x0100, 0x0A, 0x00, 0x1F, 0x0003, 0x0E)]
+        [DataRow(0x0200, 0x0033, 0x1F, 0x12, 0x10, 0x0010, 0x0A)]
+        [DataRow(0x0000, 0x0001, 0x01, 0x07, 0x18, 0x0001, 0x08)]
+        [DataRow(0x0C00, 0x0050, 0x05, 0x2A, 0x13, 0x0040, 0x04)]
+        public void RenderSamplesMatchesPerSampleCalculation(int toneA, int toneB, int noise, 
+            int mixer, int volume, int envelope, int shape)
+        {
+            // --- Arrange
+            const int TACTS_PER_SAMPLE = 100;
+            const int SAMPLE_COUNT = 20000;
+            var hostVm = new SpectrumSoundTestMachine();
+            var blockPsg = new PsgState(hostVm);
+            var samplePsg = new PsgState(hostVm);
+            hostVm.SetCurrentCpuTact(123);
+            foreach (var psg in new[] { blockPsg, samplePsg })
+            {
+                psg[0] = (byte)toneA;
+                psg[1] = (byte)(toneA >> 8);
+                psg[2] = (byte)toneB;
+                psg[3] = (byte)(toneB >> 8);
+                psg[4] = (byte)(toneA + toneB);
+                psg[5] = (byte)((toneA + toneB) >> 8);
+                psg[6] = (byte)noise;
+                psg[7] = (byte)mixer;
+                psg[8] = (byte)volume;
+                psg[9] = (byte)(volume ^ 0x10);
+                psg[10] = (byte)(volume & 0x0F);
+                psg[11] = (byte)envelope;
+                psg[12] = (byte)(envelope >> 8);
+                psg[13] = (byte)shape;
+            }
+            var blockSamples = new float[SAMPLE_COUNT];
+
+            // --- Act
+            blockPsg.RenderSamples(blockSamples, 0, 7, 123, TACTS_PER_SAMPLE);
+            blockPsg.RenderSamples(blockSamples, 7, SAMPLE_COUNT - 7, 823, TACTS_PER_SAMPLE);
+
+            // --- Assert
+            for (var i = 0; i < SAMPLE_COUNT; i++)
+            {
+                long tact = 123 + i * TACTS_PER_SAMPLE;
+                var noiseValue = samplePsg.GetNoiseSample(tact);
+                var channelA = samplePsg.GetChannelASample(tact);
+                if (samplePsg.NoiseAEnabled && noiseValue > channelA) channelA = noiseValue;
+                var channelB = samplePsg.GetChannelBSample(tact);
+                if (samplePsg.NoiseBEnabled && noiseValue > channelB) channelB = noiseValue;
+                var channelC = samplePsg.GetChannelCSample(tact);
+                if (samplePsg.NoiseCEnabled && noiseValue > channelC) channelC = noiseValue;
+                var expected = (channelA * samplePsg.GetAmplitudeA(tact)
+                    + channelB * samplePsg.GetAmplitudeB(tact)
+                    + channelC * samplePsg.GetAmplitudeC(tact)) / 3;
+                blockSamples[i].ShouldBe(expected);
+            }
+        }
+
         /// <summary>
         /// VM to test the beeper
         /// </summary>
@@ -0,0 +1,157 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Shouldly;
+using Spect.Net.SpectrumEmu.Cpu;
+using Spect.Net.SpectrumEmu.Disassembler;
+
+namespace Spect.Net.SpectrumEmu.Test.Disassembler
+{
+    [TestClass]
+    public class CodeFlowAnalyzerTests
+    {
+        [TestMethod]
+        public void DataAfterUnconditionalJumpIsDetected()
+        {
+            // --- Arrange
+            var memory = new byte[]
+            {
+                0x3E, 0x01,       // 0000: ld a,#01
+                0xC3, 0x07, 0x00, // 0002: jp #0007
+                0xAA, 0xBB,       // 0005: data
+                0xC9              // 0007: ret
+            };
+            var analyzer = new CodeFlowAnalyzer(memory);
+
+            // --- Act
+            var map = analyzer.Analyze(new ushort[] { 0x0000 });
+
+            // --- Assert
+            map.Count.ShouldBe(3);
+            map[0].ShouldBe(new MemorySection(0x0000, 0x0004));
+            map[1].ShouldBe(new MemorySection(0x0005, 0x0006, MemorySectionType.ByteArray));
+            map[2].ShouldBe(new MemorySection(0x0007, 0x0007));
+        }
+
+        [TestMethod]
+        public void CallsAndRelativeJumpsAreFollowed()
+        {
+            // --- Arrange
+            var memory = new byte[]
+            {
+                0xCD, 0x08, 0x00, // 0000: call #0008
+                0x28, 0x02,       // 0003: jr z,#0007
+                0xC9,             // 0005: ret
+                0xFF,             // 0006: data
+                0xC9,             // 0007: ret
+                0x00,             // 0008: nop
+                0xC9              // 0009: ret
+            };
+            var analyzer = new CodeFlowAnalyzer(memory);
+
+            // --- Act
+            var map = analyzer.Analyze(new ushort[] { 0x0000 });
+
+            // --- Assert
+            map.Count.ShouldBe(3);
+            map[0].ShouldBe(new MemorySection(0x0000, 0x0005));
+            map[1].ShouldBe(new MemorySection(0x0006, 0x0006, MemorySectionType.ByteArray));
+            map[2].ShouldBe(new MemorySection(0x0007, 0x0009));
+        }
+
+        [TestMethod]
+        public void ExecutionCoverageFindsIndirectlyReachedCode()
+        {
+            // --- Arrange
+            var memory = new byte[]
+            {
+                0xE9,             // 0000: jp (hl)
+                0xAA,             // 0001: data
+                0x00,             // 0002: nop (reached via jp (hl))
+                0xC9              // 0003: ret
+            };
+            var coverage = new MemoryStatusArray();
+            coverage.Touch(0x0000);
+            coverage.Touch(0x0002);
+            var analyzer = new CodeFlowAnalyzer(memory)
+            {
+                ExecutionCoverage = coverage
+            };
+
+            // --- Act
+            var map = analyzer.Analyze(new ushort[] { 0x0000 });
+
+            // --- Assert
+            map.Count.ShouldBe(3);
+            map[0].ShouldBe(new MemorySection(0x0000, 0x0000));
+            map[1].ShouldBe(new MemorySection(0x0001, 0x0001, MemorySectionType.ByteArray));
+            map[2].ShouldBe(new MemorySection(0x0002, 0x0003));
+        }
+
+        [TestMethod]
+        public void VectorTableIsDetected()
+        {
+            // --- Arrange
+            var memory = new byte[]
+            {
+                0x18, 0x04,       // 0000: jr #0006
+                0x06, 0x00,       // 0002: .defw #0006
+                0x07, 0x00,       // 0004: .defw #0007
+                0x00,             // 0006: nop
+                0xC9              // 0007: ret
+            };
+            var analyzer = new CodeFlowAnalyzer(memory);
+
+            // --- Act
+            var map = analyzer.Analyze(new ushort[] { 0x0000 });
+
+            // --- Assert
+            map.Count.ShouldBe(3);
+            map[1].ShouldBe(new MemorySection(0x0002, 0x0005, MemorySectionType.WordArray));
+        }
+
+        [TestMethod]
+        public void SpectrumRst08EndsThePath()
+        {
+            // --- Arrange
+            var memory = new byte[]
+            {
+                0xCF,             // 0000: rst #08
+                0x0A,             // 0001: error code
+                0xC9              // 0002: ret
+            };
+            var flags = new Dictionary<int, SpectrumSpecificDisassemblyFlags>
+            {
+                { 0, SpectrumSpecificDisassemblyFlags.Spectrum48 }
+            };
+            var analyzer = new CodeFlowAnalyzer(memory, flags);
+
+            // --- Act
+            var map = analyzer.Analyze(new ushort[] { 0x0000 }, 0x0000, 0x0002);
+
+            // --- Assert
+            map[0].ShouldBe(new MemorySection(0x0000, 0x0000));
+            map[1].ShouldBe(new MemorySection(0x0001, 0x0002, MemorySectionType.ByteArray));
+        }
+
+        [TestMethod]
+        public void AnalyzedMapDisassemblesTheWholeMemory()
+        {
+            // --- Arrange
+            var memory = new byte[0x10000];
+            new Random(0x4321).NextBytes(memory);
+            var analyzer = new CodeFlowAnalyzer(memory);
+
+            // --- Act
+            var map = analyzer.Analyze(CodeFlowAnalyzer.RestartVectors);
+
+            // --- Assert
+            map.First().StartAddress.ShouldBe((ushort)0x0000);
+            map.Last().EndAddress.ShouldBe((ushort)0xFFFF);
+            map.Sum(s => s.EndAddress - s.StartAddress + 1).ShouldBe(0x10000);
+            var output = new Z80Disassembler(map, memory).Disassemble();
+            output.OutputItems.Count.ShouldBeGreaterThan(0);
+        }
+    }
+}
@@ -0,0 +1,152 @@
+﻿using System;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Shouldly;
+using Spect.Net.SpectrumEmu.Disassembler;
+
+namespace Spect.Net.SpectrumEmu.Test.Disassembler
+{
+    [TestClass]
+    public class DisassemblyDecodeCacheTests
+    {
+        [DataTestMethod]
+        [DataRow(false)]
+        [DataRow(true)]
+        public void CachedDisassemblyMatchesUncached(bool extendedSet)
+        {
+            // --- Arrange
+            var memory = CreateMemory(0x4000, 0x1234);
+            var cache = new DisassemblyDecodeCache();
+
+            // --- Act
+            var first = Disassemble(memory, cache, extendedSet);
+            var second = Disassemble(memory, cache, extendedSet);
+
+            // --- Assert
+            var expected = Disassemble(memory, null, extendedSet);
+            ShouldBeSame(first, expected);
+            ShouldBeSame(second, expected);
+            // --- An instruction running over the memory end is not cached
+            cache.Hits.ShouldBeGreaterThanOrEqualTo(second.OutputItems.Count - 1);
+        }
+
+        [TestMethod]
+        public void CachedDisassemblyFollowsMemoryChanges()
+        {
+            // --- Arrange
+            var memory = CreateMemory(0x4000, 0x5678);
+            var cache = new DisassemblyDecodeCache();
+            Disassemble(memory, cache, false);
+
+            // --- Act
+            var random = new Random(0x9ABC);
+            for (var i = 0; i < 200; i++)
+            {
+                memory[random.Next(memory.Length)] = (byte)random.Next(256);
+            }
+            var changed = Disassemble(memory, cache, false);
+
+            // --- Assert
+            ShouldBeSame(changed, Disassemble(memory, null, false));
+        }
+
+        [TestMethod]
+        public void DifferentBanksDoNotShareRecords()
+        {
+            // --- Arrange
+            var cache = new DisassemblyDecodeCache();
+            var memory = new byte[] { 0x00, 0x00, 0x00 };
+            var disassembler = new Z80Disassembler(new MemoryMap { new MemorySection(0, 2) }, memory)
+            {
+                DecodeCache = cache,
+                BankKeys = new[] { 3 }
+            };
+            disassembler.Disassemble();
+
+            // --- Act
+            disassembler.BankKeys = new[] { 4 };
+            disassembler.Disassemble();
+
+            // --- Assert
+            cache.Hits.ShouldBe(0);
+            cache.Count.ShouldBe(6);
+        }
+
+        [TestMethod]
+        public void InvalidateRemovesOverlappingRecords()
+        {
+            // --- Arrange
+            var cache = new DisassemblyDecodeCache();
+            var memory = new byte[] { 0x21, 0x34, 0x12, 0x00, 0x00 };
+            var disassembler = new Z80Disassembler(new MemoryMap { new MemorySection(0, 4) }, memory)
+            {
+                DecodeCache = cache
+            };
+            disassembler.Disassemble();
+
+            // --- Act
+            cache.Invalidate(0, 0x0002, 0x0002);
+
+            // --- Assert
+            cache.Count.ShouldBe(2);
+        }
+
+        [TestMethod]
+        public void ItemTextIsFormattedOnDemand()
+        {
+            // --- Arrange
+            var memory = new byte[] { 0xDD, 0x36, 0xFE, 0x12 };
+            var disassembler = new Z80Disassembler(new MemoryMap { new MemorySection(0, 3) }, memory);
+
+            // --- Act
+            var item = disassembler.Disassemble().OutputItems[0];
+
+            // --- Assert
+            item.HasSymbol.ShouldBeTrue();
+            item.SymbolValue.ShouldBe((ushort)0x12);
+            item.OpCodes.ShouldBe("DD 36 FE 12 ");
+            item.Instruction.ShouldBe("ld (ix-#02),#12");
+            item.TokenPosition.ShouldBe(12);
+            item.TokenLength.ShouldBe(3);
+        }
+
+        private static byte[] CreateMemory(int length, int seed)
+        {
+            var memory = new byte[length];
+            new Random(seed).NextBytes(memory);
+            return memory;
+        }
+
+        private static DisassemblyOutput Disassemble(byte[] memory, DisassemblyDecodeCache cache, 
+            bool extendedSet)
+        {
+            var map = new MemoryMap { new MemorySection(0, (ushort)(memory.Length - 1)) };
+            var disassembler = new Z80Disassembler(map, memory, extendedSet: extendedSet)
+            {
+                DecodeCache = cache
+            };
+            return disassembler.Disassemble();
+        }
+
+        private static void ShouldBeSame(DisassemblyOutput output, DisassemblyOutput expected)
+        {
+            output.OutputItems.Count.ShouldBe(expected.OutputItems.Count);
+            output.Labels.Count.ShouldBe(expected.Labels.Count);
+            for (var i = 0; i < expected.OutputItems.Count; i++)
+            {
+                var item = output.OutputItems[i];
+                var exp = expected.OutputItems[i];
+                item.Address.ShouldBe(exp.Address);
+                item.LastAddress.ShouldBe(exp.LastAddress);
+                item.OpCodes.ShouldBe(exp.OpCodes);
+                item.Instruction.ShouldBe(exp.Instruction);
+                item.HasLabel.ShouldBe(exp.HasLabel);
+                item.TargetAddress.ShouldBe(exp.TargetAddress);
+                item.TokenPosition.ShouldBe(exp.TokenPosition);
+                item.TokenLength.ShouldBe(exp.TokenLength);
+                item.HasSymbol.ShouldBe(exp.HasSymbol);
+                item.SymbolValue.ShouldBe(exp.SymbolValue);
+                item.HasLabelSymbol.ShouldBe(exp.HasLabelSymbol);
+            }
+        }
+    }
+}
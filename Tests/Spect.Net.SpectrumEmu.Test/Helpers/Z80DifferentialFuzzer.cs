@@ -0,0 +1,390 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+using Spect.Net.SpectrumEmu.Cpu;
+
+namespace Spect.Net.SpectrumEmu.Test.Helpers
+{
+    /// <summary>
+    /// This class runs two differently configured Z80 CPUs in lockstep on
+    /// random instruction streams, and compares them after each instruction.
+    /// </summary>
+    /// <remarks>
+    /// Both CPUs start from the same random memory and registers. Port reads
+    /// return values calculated from the port address and the CPU tacts, and
+    /// interrupt requests are raised at pseudo-random instructions, so a run
+    /// is fully defined by its seed. When the CPUs diverge, the fuzzer looks
+    /// for the shortest instruction sequence that still reproduces the
+    /// difference when started from the reference state before it.
+    /// </remarks>
+    public class Z80DifferentialFuzzer
+    {
+        private readonly Action<Z80Cpu> _configureCandidate;
+        private readonly Action<Z80Cpu> _configureReference;
+
+        /// <summary>
+        /// Number of instructions executed in a run
+        /// </summary>
+        public int InstructionsPerRun { get; set; } = 5000;
+
+        /// <summary>
+        /// One of this many instructions gets an interrupt request
+        /// </summary>
+        public int InterruptPeriod { get; set; } = 64;
+
+        /// <summary>
+        /// Creates a fuzzer
+        /// </summary>
+        /// <param name="configureCandidate">Sets up the CPU under test</param>
+        /// <param name="configureReference">Sets up the reference CPU</param>
+        public Z80DifferentialFuzzer(Action<Z80Cpu> configureCandidate, Action<Z80Cpu> configureReference = null)
+        {
+            _configureCandidate = configureCandidate;
+            _configureReference = configureReference;
+        }
+
+        /// <summary>
+        /// Runs the CPUs with the specified seed
+        /// </summary>
+        /// <param name="seed">Seed of the random machine state</param>
+        /// <returns>Null, if the CPUs did not diverge; otherwise, the failure</returns>
+        public Z80FuzzFailure Run(int seed)
+        {
+            var initial = CreateInitialState(seed);
+            var reference = CreateMachine(seed, initial, _configureReference);
+            var candidate = CreateMachine(seed, initial, _configureCandidate);
+            var message = RunLockstep(reference, candidate, 0, InstructionsPerRun, out var failedStep);
+            return message == null ? null : Shrink(seed, initial, failedStep, message);
+        }
+
+        /// <summary>
+        /// Runs the CPUs with each of the specified seeds
+        /// </summary>
+        /// <param name="seeds">Seeds to use</param>
+        /// <returns>The failures found</returns>
+        public IList<Z80FuzzFailure> Run(IEnumerable<int> seeds)
+            => seeds.Select(Run).Where(f => f != null).ToList();
+
+        /// <summary>
+        /// Executes the instructions on both CPUs, and compares them
+        /// </summary>
+        /// <returns>Null, if the CPUs did not diverge; otherwise, the difference</returns>
+        private string RunLockstep(FuzzMachine reference, FuzzMachine candidate, int firstStep, int count,
+            out int failedStep)
+        {
+            for (var step = firstStep; step < firstStep + count; step++)
+            {
+                var raiseInterrupt = Hash(reference.Seed, step, 0x1F) % InterruptPeriod == 0;
+                reference.ExecuteInstruction(raiseInterrupt);
+                candidate.ExecuteInstruction(raiseInterrupt);
+                var message = Compare(reference, candidate);
+                if (message != null)
+                {
+                    failedStep = step;
+                    return message;
+                }
+                reference.ReleaseHalt();
+                candidate.ReleaseHalt();
+            }
+            failedStep = -1;
+            return null;
+        }
+
+        /// <summary>
+        /// Looks for the shortest instruction sequence that reproduces the failure
+        /// </summary>
+        private Z80FuzzFailure Shrink(int seed, InitialState initial, int failedStep, string message)
+        {
+            for (var length = 1; length <= failedStep; length++)
+            {
+                var firstStep = failedStep - length + 1;
+                var startState = GetReferenceState(seed, initial, firstStep);
+                var reference = CreateMachine(seed, startState, _configureReference);
+                var candidate = CreateMachine(seed, startState, _configureCandidate);
+                reference.RecordInstructions = true;
+                var shortMessage = RunLockstep(reference, candidate, firstStep, length, out _);
+                if (shortMessage != null)
+                {
+                    return new Z80FuzzFailure(seed, failedStep, shortMessage, startState.Registers,
+                        reference.Instructions);
+                }
+            }
+
+            // --- The failure depends on the whole run
+            var fullReference = CreateMachine(seed, initial, _configureReference);
+            fullReference.RecordInstructions = true;
+            var fullCandidate = CreateMachine(seed, initial, _configureCandidate);
+            RunLockstep(fullReference, fullCandidate, 0, failedStep + 1, out _);
+            return new Z80FuzzFailure(seed, failedStep, message, initial.Registers, fullReference.Instructions);
+        }
+
+        /// <summary>
+        /// Gets the state of the reference CPU before the specified step
+        /// </summary>
+        private InitialState GetReferenceState(int seed, InitialState initial, int step)
+        {
+            var reference = CreateMachine(seed, initial, _configureReference);
+            for (var i = 0; i < step; i++)
+            {
+                reference.ExecuteInstruction(Hash(seed, i, 0x1F) % InterruptPeriod == 0);
+                reference.ReleaseHalt();
+            }
+            return new InitialState
+            {
+                Memory = (byte[])reference.Memory.Clone(),
+                Registers = reference.Cpu.GetRegisters(),
+                CpuState = new Z80Cpu.Z80DeviceState(reference.Cpu)
+            };
+        }
+
+        /// <summary>
+        /// Compares the state of the CPUs after an instruction
+        /// </summary>
+        private static string Compare(FuzzMachine reference, FuzzMachine candidate)
+        {
+            var refRegs = reference.Cpu.GetRegisters();
+            var candRegs = candidate.Cpu.GetRegisters();
+            var sb = new StringBuilder();
+            CompareValue(sb, "AF", refRegs.AF, candRegs.AF);
+            CompareValue(sb, "BC", refRegs.BC, candRegs.BC);
+            CompareValue(sb, "DE", refRegs.DE, candRegs.DE);
+            CompareValue(sb, "HL", refRegs.HL, candRegs.HL);
+            CompareValue(sb, "AF'", refRegs._AF_, candRegs._AF_);
+            CompareValue(sb, "BC'", refRegs._BC_, candRegs._BC_);
+            CompareValue(sb, "DE'", refRegs._DE_, candRegs._DE_);
+            CompareValue(sb, "HL'", refRegs._HL_, candRegs._HL_);
+            CompareValue(sb, "IX", refRegs.IX, candRegs.IX);
+            CompareValue(sb, "IY", refRegs.IY, candRegs.IY);
+            CompareValue(sb, "SP", refRegs.SP, candRegs.SP);
+            CompareValue(sb, "PC", refRegs.PC, candRegs.PC);
+            CompareValue(sb, "IR", refRegs.IR, candRegs.IR);
+            CompareValue(sb, "WZ", refRegs.WZ, candRegs.WZ);
+            CompareValue(sb, "Tacts", reference.Cpu.Tacts, candidate.Cpu.Tacts);
+            CompareValue(sb, "StateFlags", reference.Cpu.StateFlags, candidate.Cpu.StateFlags);
+            CompareValue(sb, "IFF1", reference.Cpu.IFF1, candidate.Cpu.IFF1);
+            CompareValue(sb, "IFF2", reference.Cpu.IFF2, candidate.Cpu.IFF2);
+            CompareValue(sb, "IM", reference.Cpu.InterruptMode, candidate.Cpu.InterruptMode);
+            CompareValue(sb, "Memory writes", FormatWrites(reference), FormatWrites(candidate));
+            CompareValue(sb, "Port accesses", FormatPorts(reference), FormatPorts(candidate));
+            return sb.Length == 0 ? null : sb.ToString();
+        }
+
+        /// <summary>
+        /// Appends the difference of the values, if there is any
+        /// </summary>
+        private static void CompareValue<T>(StringBuilder sb, string name, T expected, T actual)
+        {
+            if (EqualityComparer<T>.Default.Equals(expected, actual)) return;
+            var format = typeof(T) == typeof(ushort) ? "{0}: {1:X4} instead of {2:X4}" : "{0}: {1} instead of {2}";
+            sb.AppendLine(string.Format(format, name, actual, expected));
+        }
+
+        /// <summary>
+        /// Gets the text of the memory writes of the last instruction
+        /// </summary>
+        private static string FormatWrites(FuzzMachine machine)
+            => string.Join(", ", machine.Writes.Select(w => $"({w.Address:X4})={w.Values:X2}"));
+
+        /// <summary>
+        /// Gets the text of the port accesses of the last instruction
+        /// </summary>
+        private static string FormatPorts(FuzzMachine machine)
+            => string.Join(", ", machine.Ports.Select(p => $"{(p.IsOutput ? "OUT" : "IN")} ({p.Address:X4})={p.Value:X2}"));
+
+        /// <summary>
+        /// Creates the random memory and registers of a run
+        /// </summary>
+        private static InitialState CreateInitialState(int seed)
+        {
+            var random = new Random(seed);
+            var memory = new byte[0x10000];
+            random.NextBytes(memory);
+            var regs = new Registers
+            {
+                AF = (ushort)random.Next(0x10000),
+                BC = (ushort)random.Next(0x10000),
+                DE = (ushort)random.Next(0x10000),
+                HL = (ushort)random.Next(0x10000),
+                _AF_ = (ushort)random.Next(0x10000),
+                _BC_ = (ushort)random.Next(0x10000),
+                _DE_ = (ushort)random.Next(0x10000),
+                _HL_ = (ushort)random.Next(0x10000),
+                IX = (ushort)random.Next(0x10000),
+                IY = (ushort)random.Next(0x10000),
+                SP = (ushort)random.Next(0x10000),
+                PC = (ushort)random.Next(0x10000),
+                IR = (ushort)random.Next(0x10000),
+                WZ = (ushort)random.Next(0x10000)
+            };
+            return new InitialState
+            {
+                Memory = memory,
+                Registers = regs
+            };
+        }
+
+        /// <summary>
+        /// Creates a machine with the specified state
+        /// </summary>
+        private static FuzzMachine CreateMachine(int seed, InitialState state, Action<Z80Cpu> configure)
+        {
+            var machine = new FuzzMachine(seed);
+            state.Memory.CopyTo(machine.Memory, 0);
+            state.CpuState?.RestoreDeviceState(machine.Cpu);
+            machine.Cpu.SetRegisters(state.Registers);
+            configure?.Invoke(machine.Cpu);
+            return machine;
+        }
+
+        /// <summary>
+        /// Calculates a pseudo-random value from the specified inputs
+        /// </summary>
+        private static uint Hash(int seed, long value, int salt)
+        {
+            var hash = (uint)seed * 0x9E3779B1u ^ (uint)value * 0x85EBCA6Bu ^ (uint)(value >> 32) ^ (uint)salt;
+            hash ^= hash >> 15;
+            hash *= 0x2C1B3C6Du;
+            hash ^= hash >> 12;
+            return hash;
+        }
+
+        /// <summary>
+        /// The state a run starts from
+        /// </summary>
+        private class InitialState
+        {
+            public byte[] Memory;
+            public Registers Registers;
+            public Z80Cpu.Z80DeviceState CpuState;
+        }
+
+        /// <summary>
+        /// The test machine that logs the memory writes and port accesses
+        /// of the last instruction
+        /// </summary>
+        private class FuzzMachine : Z80TestMachine
+        {
+            public int Seed { get; }
+            public List<MemoryOp> Writes { get; } = new List<MemoryOp>();
+            public List<IoOp> Ports { get; } = new List<IoOp>();
+            public bool RecordInstructions { get; set; }
+            public List<string> Instructions { get; } = new List<string>();
+
+            public FuzzMachine(int seed) : base(RunMode.OneInstruction)
+            {
+                Seed = seed;
+                Cpu.OperationExecuted += (s, e) =>
+                {
+                    if (RecordInstructions)
+                    {
+                        Instructions.Add($"{e.PcBefore:X4}: {string.Join(" ", e.Instruction.Select(b => b.ToString("X2")))}");
+                    }
+                };
+            }
+
+            /// <summary>
+            /// Executes the next instruction
+            /// </summary>
+            /// <param name="raiseInterrupt">Signs an interrupt request before the instruction</param>
+            public void ExecuteInstruction(bool raiseInterrupt)
+            {
+                Writes.Clear();
+                Ports.Clear();
+                if (raiseInterrupt)
+                {
+                    Cpu.StateFlags |= Z80StateFlags.Int;
+                }
+                do
+                {
+                    Cpu.ExecuteCpuCycle();
+                } while (Cpu.IsInOpExecution);
+                Cpu.StateFlags &= Z80StateFlags.InvInt;
+            }
+
+            /// <summary>
+            /// Continues after a HALT, so that the run does not stall
+            /// </summary>
+            public void ReleaseHalt() => Cpu.RemoveFromHaltedState();
+
+            protected override byte ReadMemory(ushort addr, bool noContention = false) => Memory[addr];
+
+            protected override void WriteMemory(ushort addr, byte value)
+            {
+                Memory[addr] = value;
+                Writes.Add(new MemoryOp(addr, value, true));
+            }
+
+            protected override byte ReadPort(ushort addr)
+            {
+                var value = (byte)Hash(Seed, Cpu.Tacts, addr);
+                Ports.Add(new IoOp(addr, value, false));
+                return value;
+            }
+
+            protected override void WritePort(ushort addr, byte value)
+            {
+                Ports.Add(new IoOp(addr, value, true));
+            }
+        }
+    }
+
+    /// <summary>
+    /// Describes a difference found by the differential fuzzer
+    /// </summary>
+    public class Z80FuzzFailure
+    {
+        /// <summary>
+        /// Seed of the run
+        /// </summary>
+        public int Seed { get; }
+
+        /// <summary>
+        /// Index of the instruction after which the CPUs differed
+        /// </summary>
+        public int Step { get; }
+
+        /// <summary>
+        /// Description of the difference
+        /// </summary>
+        public string Message { get; }
+
+        /// <summary>
+        /// Registers before the reproducing sequence
+        /// </summary>
+        public Registers StartRegisters { get; }
+
+        /// <summary>
+        /// The shortest instruction sequence that reproduces the difference
+        /// </summary>
+        public IList<string> Instructions { get; }
+
+        public Z80FuzzFailure(int seed, int step, string message, Registers startRegisters,
+            IList<string> instructions)
+        {
+            Seed = seed;
+            Step = step;
+            Message = message;
+            StartRegisters = startRegisters;
+            Instructions = instructions;
+        }
+
+        /// <summary>
+        /// Gets the report of the failure
+        /// </summary>
+        public override string ToString()
+        {
+            var regs = StartRegisters;
+            var sb = new StringBuilder();
+            sb.AppendLine($"Seed {Seed}, instruction #{Step}:");
+            sb.Append(Message);
+            sb.AppendLine($"Start: AF={regs.AF:X4} BC={regs.BC:X4} DE={regs.DE:X4} HL={regs.HL:X4} "
+                + $"IX={regs.IX:X4} IY={regs.IY:X4} SP={regs.SP:X4} PC={regs.PC:X4} WZ={regs.WZ:X4}");
+            foreach (var instruction in Instructions)
+            {
+                sb.AppendLine(instruction);
+            }
+            return sb.ToString();
+        }
+    }
+}
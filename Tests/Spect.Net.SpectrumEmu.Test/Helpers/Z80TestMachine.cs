@@ -110,7 +110,7 @@ namespace Spect.Net.SpectrumEmu.Test.Helpers
         /// <returns>True, if break signal received; otherwise, false</returns>
         public bool Run()
         {
-            RegistersBeforeRun = Clone(Cpu.Registers);
+            RegistersBeforeRun = Cpu.GetRegisters();
             MemoryBeforeRun = new byte[ushort.MaxValue + 1];
             Memory.CopyTo(MemoryBeforeRun, 0);
             var stopped = false;
@@ -135,7 +135,7 @@ namespace Spect.Net.SpectrumEmu.Test.Helpers
                         stopped = (Cpu.StateFlags & Z80StateFlags.Halted) != 0;
                         break;
                     case RunMode.UntilEnd:
-                        stopped = Cpu.Registers.PC >= CodeEndsAt;
+                        stopped = Cpu.PC >= CodeEndsAt;
                         break;
                     default:
                         throw new ArgumentOutOfRangeException();
@@ -176,32 +176,6 @@ namespace Spect.Net.SpectrumEmu.Test.Helpers
             IoAccessLog.Add(new IoOp(addr, value, true));
         }
 
-        /// <summary>
-        /// Clones the current set of registers
-        /// </summary>
-        /// <param name="regs"></param>
-        /// <returns></returns>
-        private static Registers Clone(Registers regs)
-        {
-            return new Registers
-            {
-                _AF_ = regs._AF_,
-                _BC_ = regs._BC_,
-                _DE_ = regs._DE_,
-                _HL_ = regs._HL_,
-                AF = regs.AF,
-                BC = regs.BC,
-                DE = regs.DE,
-                HL = regs.HL,
-                SP = regs.SP,
-                PC = regs.PC,
-                IX = regs.IX,
-                IY = regs.IY,
-                IR = regs.IR,
-                WZ = regs.WZ
-            };
-        }
-
         /// <summary>
         /// Holds information about a memory operation
         /// </summary>
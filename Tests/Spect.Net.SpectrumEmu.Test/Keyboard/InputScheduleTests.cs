@@ -0,0 +1,250 @@
+﻿using System;
+using System.Threading;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Shouldly;
+using Spect.Net.RomResources;
+using Spect.Net.SpectrumEmu.Abstraction.Devices;
+using Spect.Net.SpectrumEmu.Abstraction.Providers;
+using Spect.Net.SpectrumEmu.Devices.Kempston;
+using Spect.Net.SpectrumEmu.Devices.Keyboard;
+using Spect.Net.SpectrumEmu.Machine;
+using Spect.Net.SpectrumEmu.Scripting;
+using Spect.Net.SpectrumEmu.Test.Helpers;
+
+namespace Spect.Net.SpectrumEmu.Test.Keyboard
+{
+    [TestClass]
+    public class InputScheduleTests
+    {
+        [TestMethod]
+        public void EventsAreAppliedInTactOrder()
+        {
+            // --- Arrange
+            var schedule = new InputSchedule();
+            var keyboard = new KeyboardDevice();
+            schedule.KeyUp(200, SpectrumKeyCode.A);
+            schedule.KeyDown(100, SpectrumKeyCode.A);
+            schedule.KeyDown(100, SpectrumKeyCode.B);
+
+            // --- Act
+            var beforeFirst = schedule.ApplyDueEvents(99, keyboard, null);
+            var atFirst = schedule.ApplyDueEvents(150, keyboard, null);
+            var aDown = keyboard.GetStatus(SpectrumKeyCode.A);
+            var next = schedule.NextTact;
+            var atLast = schedule.ApplyDueEvents(200, keyboard, null);
+
+            // --- Assert
+            beforeFirst.ShouldBe(0);
+            atFirst.ShouldBe(2);
+            aDown.ShouldBeTrue();
+            next.ShouldBe(200);
+            atLast.ShouldBe(1);
+            keyboard.GetStatus(SpectrumKeyCode.A).ShouldBeFalse();
+            keyboard.GetStatus(SpectrumKeyCode.B).ShouldBeTrue();
+            schedule.Count.ShouldBe(0);
+            schedule.NextTact.ShouldBe(long.MaxValue);
+        }
+
+        [TestMethod]
+        public void KeyStrokeReleasesBothKeys()
+        {
+            // --- Arrange
+            var schedule = new InputSchedule();
+            var keyboard = new KeyboardDevice();
+
+            // --- Act
+            schedule.KeyStroke(10, 50, SpectrumKeyCode.N6, SpectrumKeyCode.CShift);
+            schedule.ApplyDueEvents(10, keyboard, null);
+            var shiftDown = keyboard.GetStatus(SpectrumKeyCode.CShift);
+            var keyDown = keyboard.GetStatus(SpectrumKeyCode.N6);
+            schedule.ApplyDueEvents(60, keyboard, null);
+
+            // --- Assert
+            shiftDown.ShouldBeTrue();
+            keyDown.ShouldBeTrue();
+            keyboard.GetStatus(SpectrumKeyCode.CShift).ShouldBeFalse();
+            keyboard.GetStatus(SpectrumKeyCode.N6).ShouldBeFalse();
+        }
+
+        [TestMethod]
+        public void KeysAreAppliedAtScheduledTact()
+        {
+            // --- Arrange
+            var spectrum = new SpectrumAdvancedTestMachine();
+            spectrum.InitCode(new byte[]
+            {
+                0x01, 0xFE, 0xFD, // LD BC,FDFEH
+                0xED, 0x78,       // IN A,(C)
+                0x57,             // LD D,A
+                0xED, 0x78,       // IN A,(C)
+                0x76              // HALT
+            });
+            var start = spectrum.Cpu.Tacts;
+            spectrum.InputSchedule.KeyDown(start, SpectrumKeyCode.A);
+            spectrum.InputSchedule.KeyUp(start + 24, SpectrumKeyCode.A);
+
+            // --- Act
+            spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.UntilHalt));
+
+            // --- Assert
+            var regs = spectrum.Cpu.Registers;
+            (regs.D & 0x01).ShouldBe(0x00);
+            (regs.A & 0x01).ShouldBe(0x01);
+        }
+
+        [TestMethod]
+        public void KempstonStateIsApplied()
+        {
+            // --- Arrange
+            var spectrum = new SpectrumAdvancedTestMachine();
+            var provider = spectrum.KempstonProvider as KempstonTestProvider;
+            // ReSharper disable once PossibleNullReferenceException
+            provider.Reset();
+            provider.IsPresent = false;
+            spectrum.InitCode(new byte[]
+            {
+                0x01, 0x1F, 0x00, // LD BC,001FH
+                0xED, 0x78,       // IN A,(C)
+                0x76              // HALT
+            });
+            spectrum.InputSchedule.SetKempston(spectrum.Cpu.Tacts, KempstonButtons.Left | KempstonButtons.Fire);
+
+            // --- Act
+            spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.UntilHalt));
+
+            // --- Assert
+            spectrum.Cpu.Registers.A.ShouldBe((byte)0x12);
+        }
+
+        [TestMethod]
+        public void HistoryCanBeReplayed()
+        {
+            // --- Arrange
+            var spectrum = new SpectrumAdvancedTestMachine();
+            spectrum.InputSchedule.RecordHistory = true;
+            var frameTact = spectrum.InputSchedule.GetFrameTact(1);
+            spectrum.InputSchedule.KeyStroke(frameTact, 1000, SpectrumKeyCode.Q);
+
+            // --- Act
+            for (var i = 0; i < 3; i++)
+            {
+                spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.UntilFrameEnds));
+            }
+            var history = spectrum.InputSchedule.GetHistory();
+            var replay = new InputSchedule();
+            replay.AddRange(history);
+
+            // --- Assert
+            frameTact.ShouldBe(spectrum.FrameTacts);
+            history.Count.ShouldBe(2);
+            history[0].Tact.ShouldBe(frameTact);
+            history[1].Type.ShouldBe(InputEventType.KeyUp);
+            replay.Count.ShouldBe(2);
+            replay.NextTact.ShouldBe(frameTact);
+        }
+
+        [TestMethod]
+        public void ResetClearsSchedule()
+        {
+            // --- Arrange
+            var spectrum = new SpectrumAdvancedTestMachine();
+            spectrum.InputSchedule.KeyDown(1000, SpectrumKeyCode.A);
+
+            // --- Act
+            spectrum.Reset();
+
+            // --- Assert
+            spectrum.InputSchedule.Count.ShouldBe(0);
+            spectrum.InputSchedule.NextTact.ShouldBe(long.MaxValue);
+        }
+
+        [TestMethod]
+        public void ScheduledKeyIsHeldWhileProviderReleasesIt()
+        {
+            // --- Arrange
+            var schedule = new InputSchedule();
+            var keyboard = new KeyboardDevice();
+            schedule.KeyStroke(10, 50, SpectrumKeyCode.Enter);
+
+            // --- Act
+            schedule.ApplyDueEvents(10, keyboard, null);
+            keyboard.SetStatus(SpectrumKeyCode.Enter, false);
+            var heldKey = keyboard.GetStatus(SpectrumKeyCode.Enter);
+            var heldLine = keyboard.GetLineStatus(0xBF);
+            schedule.ApplyDueEvents(60, keyboard, null);
+
+            // --- Assert
+            heldKey.ShouldBeTrue();
+            (heldLine & 0x01).ShouldBe(0x00);
+            keyboard.GetStatus(SpectrumKeyCode.Enter).ShouldBeFalse();
+        }
+
+        [TestMethod]
+        [DataRow(SpectrumModels.ZX_SPECTRUM_128, 1)]
+        [DataRow(SpectrumModels.ZX_SPECTRUM_P3_E, 3)]
+        public void MenuSelectionStartsSpectrum48Basic(string model, int basicRom)
+        {
+            // --- Arrange
+            SpectrumMachine.Reset();
+            SpectrumMachine.RegisterProvider<IRomProvider>(()
+                => new ResourceRomProvider(typeof(RomResourcesPlaceHolder).Assembly));
+            SpectrumMachine.RegisterProvider<IKeyboardProvider>(() => new ReleasingKeyboardProvider());
+            var vm = SpectrumMachine.CreateMachine(model, SpectrumModels.PAL).SpectrumVm;
+            vm.Reset();
+            var menuLoop = model == SpectrumModels.ZX_SPECTRUM_128
+                ? SpectrumVmStateFileManagerBase.SP128_MAIN_WAITING_LOOP
+                : SpectrumVmStateFileManagerBase.SPP3_MAIN_WAITING_LOOP;
+            var timeout = 500L * vm.FrameTacts * vm.ClockMultiplier;
+            var menuReached = vm.ExecuteCycle(CancellationToken.None,
+                new ExecuteCycleOptions(EmulationMode.UntilExecutionPoint,
+                    terminationRom: 0,
+                    terminationPoint: menuLoop,
+                    fastVmMode: true,
+                    timeoutTacts: timeout));
+
+            // --- Act
+            SpectrumVmStateFileManagerBase.ScheduleMenuSelection(vm.InputSchedule, vm.Cpu.Tacts, 3);
+            var basicReached = vm.ExecuteCycle(CancellationToken.None,
+                new ExecuteCycleOptions(EmulationMode.UntilExecutionPoint,
+                    terminationRom: basicRom,
+                    terminationPoint: SpectrumVmStateFileManagerBase.SP48_MAIN_EXEC_ADDR,
+                    fastVmMode: true,
+                    timeoutTacts: timeout));
+
+            // --- Assert
+            menuReached.ShouldBeTrue();
+            basicReached.ShouldBeTrue();
+            vm.ExecutionCompletionReason.ShouldBe(ExecutionCompletionReason.TerminationPointReached);
+        }
+
+        /// <summary>
+        /// Keyboard provider that reports all keys released at every frame,
+        /// as the provider of the IDE does when no physical key is pressed
+        /// </summary>
+        private class ReleasingKeyboardProvider : VmComponentProviderBase, IKeyboardProvider
+        {
+            private Action<SpectrumKeyCode, bool> _statusHandler;
+
+            public void SetKeyStatusHandler(Action<SpectrumKeyCode, bool> statusHandler)
+                => _statusHandler = statusHandler;
+
+            public void Scan(bool allowPhysicalKeyboard)
+            {
+                for (var key = SpectrumKeyCode.CShift; key <= SpectrumKeyCode.B; key++)
+                {
+                    _statusHandler?.Invoke(key, false);
+                }
+            }
+
+            public bool EmulateKeyStroke()
+            {
+                Scan(true);
+                return false;
+            }
+
+            public void QueueKeyPress(EmulatedKeyStroke keypress)
+            {
+            }
+        }
+    }
+}
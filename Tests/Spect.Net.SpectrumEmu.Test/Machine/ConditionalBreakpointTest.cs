@@ -31,7 +31,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, null);
             debugProvider.Breakpoints.Add(0x8000, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -65,7 +65,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -98,7 +98,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint("<2", null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -131,7 +131,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint("<3", null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act/Assert (Run 1)
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -168,7 +168,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint("<1", null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -201,7 +201,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint("<2", null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act/Assert (Run 1)
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -238,7 +238,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint("<=1", null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -271,7 +271,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint("<=2", null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act/Assert (Run 1)
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -308,7 +308,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint("<=0", null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -341,7 +341,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint("<=1", null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act/Assert (Run 1)
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -378,7 +378,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint("=1", null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -411,7 +411,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint("=19", null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -444,7 +444,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint("=999", null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -477,7 +477,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint("=19", null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act/Assert (Run 1)
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -514,7 +514,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(">0", null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -547,7 +547,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(">3", null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -580,7 +580,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(">3", null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act/Assert (Run 1)
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -617,7 +617,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(">127", null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act/Assert (Run 1)
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -654,7 +654,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(">126", null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act/Assert (Run 1)
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -697,7 +697,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(">=1", null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -730,7 +730,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(">=4", null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -763,7 +763,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(">=4", null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act/Assert (Run 1)
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -800,7 +800,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(">=128", null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act/Assert (Run 1)
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -837,7 +837,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(">=127", null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act/Assert (Run 1)
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -880,7 +880,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint("*8", null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -913,7 +913,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint("*8", null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act/Assert (Run 1)
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -950,7 +950,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint("*100", null);
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act/Assert (Run 1)
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -987,7 +987,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "1");
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -1020,7 +1020,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "0");
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -1053,7 +1053,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "/%#");
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -1086,7 +1086,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "UNKNOWN");
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -1119,7 +1119,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "A/0");
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -26,7 +26,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x4F,             // LD C,A
             });
             debugProvider.Breakpoints.Add(0x8000, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -56,7 +56,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             });
             debugProvider.Breakpoints.Add(0x8000, MinimumBreakpointInfo.EmptyBreakpointInfo);
             debugProvider.Breakpoints.Add(0x8002, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
 
             // --- Act
@@ -87,7 +87,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x4F,             // LD C,A
             });
             debugProvider.Breakpoints.Add(0x8003, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -117,7 +117,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             });
             debugProvider.Breakpoints.Add(0x8003, MinimumBreakpointInfo.EmptyBreakpointInfo);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -148,7 +148,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x47,             // LD B,A
                 0x4F,             // LD C,A
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
@@ -176,7 +176,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x47,             // LD B,A
                 0x4F,             // LD C,A
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
@@ -213,7 +213,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x47,             // LD B,A
                 0x4F,             // LD C,A
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepOver));
@@ -242,7 +242,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x47,             // LD B,A
                 0x4F,             // LD C,A
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepOver));
@@ -284,7 +284,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x57,             // LD D,A
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepOver));
@@ -325,7 +325,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x57,             // LD D,A
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepOver));
@@ -366,7 +366,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x57,             // LD D,A
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepOver));
@@ -407,7 +407,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x57,             // LD D,A
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepOver));
@@ -448,7 +448,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x57,             // LD D,A
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepOver));
@@ -489,7 +489,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x57,             // LD D,A
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepOver));
@@ -530,7 +530,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x57,             // LD D,A
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepOver));
@@ -571,7 +571,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x57,             // LD D,A
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepOver));
@@ -612,7 +612,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x57,             // LD D,A
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepOver));
@@ -653,7 +653,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x57,             // LD D,A
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepOver));
@@ -694,7 +694,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x57,             // LD D,A
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepOver));
@@ -735,7 +735,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x57,             // LD D,A
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepOver));
@@ -776,7 +776,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x57,             // LD D,A
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepOver));
@@ -817,7 +817,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x57,             // LD D,A
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepOver));
@@ -858,7 +858,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x57,             // LD D,A
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepOver));
@@ -899,7 +899,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x57,             // LD D,A
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepOver));
@@ -940,7 +940,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x57,             // LD D,A
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepOver));
@@ -977,7 +977,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x7A,       // LD A,D
                 0x76        // HALT
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepOver));
@@ -1015,7 +1015,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x00,             // NOP
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
@@ -1048,7 +1048,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x00,             // NOP
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
@@ -1081,7 +1081,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x00,             // NOP
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
@@ -1114,7 +1114,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x00,             // NOP
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
@@ -1147,7 +1147,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x00,             // NOP
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
@@ -1180,7 +1180,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x00,             // NOP
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
@@ -1213,7 +1213,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x00,             // NOP
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
@@ -1246,7 +1246,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x00,             // NOP
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
@@ -1279,7 +1279,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x00,             // NOP
                 0xC9              // RET
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
@@ -1309,7 +1309,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0xC0,             // RET NZ
                 0x76              // HALT
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
 
             // --- Act
@@ -1337,7 +1337,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0xC8,             // RET Z
                 0x76              // HALT
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
 
             // --- Act
@@ -1365,7 +1365,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0xD0,             // RET NC
                 0x76              // HALT
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
 
             // --- Act
@@ -1393,7 +1393,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0xD8,             // RET C
                 0x76              // HALT
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
 
             // --- Act
@@ -1421,7 +1421,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0xE0,             // RET PO
                 0x76              // HALT
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
 
             // --- Act
@@ -1449,7 +1449,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0xE8,             // RET PE
                 0x76              // HALT
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
 
             // --- Act
@@ -1477,7 +1477,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0xF0,             // RET P
                 0x76              // HALT
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
 
             // --- Act
@@ -1505,7 +1505,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0xF8,             // RET M
                 0x76              // HALT
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
 
             // --- Act
@@ -1539,7 +1539,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0xC9              // RET
 
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger, DebugStepMode.StepInto));
@@ -26,7 +26,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x4F,             // LD C,A
                 0x76              // HALT
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, 
@@ -56,7 +56,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
                 0x4F,             // LD C,A
                 0x76              // HALT
             });
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None,
@@ -30,7 +30,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`Z");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -61,7 +61,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`Z");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -91,7 +91,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`NZ");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -122,7 +122,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`NZ");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -152,7 +152,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`C");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -183,7 +183,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`C");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -213,7 +213,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`NC");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -244,7 +244,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`NC");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -274,7 +274,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`M");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -305,7 +305,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`M");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -335,7 +335,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`P");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -366,7 +366,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`P");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -396,7 +396,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`H");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -427,7 +427,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`H");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -457,7 +457,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`NH");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -488,7 +488,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`NH");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -518,7 +518,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`PE");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -549,7 +549,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`PE");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -579,7 +579,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`PO");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -610,7 +610,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`PO");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -640,7 +640,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`N");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -671,7 +671,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`N");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -701,7 +701,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`NN");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -732,7 +732,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`NN");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -762,7 +762,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`3");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -793,7 +793,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`3");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -823,7 +823,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`N3");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -854,7 +854,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`N3");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -884,7 +884,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`5");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -915,7 +915,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`5");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -945,7 +945,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`N5");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -976,7 +976,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "`N5");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8004, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -32,7 +32,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "AF == 0");
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -65,7 +65,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "AF == 0x10");
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -100,7 +100,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "AF' == 0x0100");
             debugProvider.Breakpoints.Add(0x8006, bp);
             debugProvider.Breakpoints.Add(0x8009, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -135,7 +135,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "AF' == 0xFF00");
             debugProvider.Breakpoints.Add(0x8006, bp);
             debugProvider.Breakpoints.Add(0x8009, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -167,7 +167,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "BC == 0x7E02");
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -199,7 +199,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "BC == 0x0000");
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -233,7 +233,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "BC' == 0x7E03");
             debugProvider.Breakpoints.Add(0x8006, bp);
             debugProvider.Breakpoints.Add(0x8009, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -267,7 +267,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "BC' == 0x0123");
             debugProvider.Breakpoints.Add(0x8006, bp);
             debugProvider.Breakpoints.Add(0x8009, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -299,7 +299,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "DE == 0x4003");
             debugProvider.Breakpoints.Add(0x8005, bp);
             debugProvider.Breakpoints.Add(0x8008, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -332,7 +332,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "DE == 0x6003");
             debugProvider.Breakpoints.Add(0x8005, bp);
             debugProvider.Breakpoints.Add(0x8008, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -366,7 +366,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "DE' == 0x4003");
             debugProvider.Breakpoints.Add(0x8007, bp);
             debugProvider.Breakpoints.Add(0x800A, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -401,7 +401,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "DE' == 0x6003");
             debugProvider.Breakpoints.Add(0x8007, bp);
             debugProvider.Breakpoints.Add(0x800A, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -433,7 +433,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "HL == 0x4003");
             debugProvider.Breakpoints.Add(0x8005, bp);
             debugProvider.Breakpoints.Add(0x8008, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -466,7 +466,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "HL == 0x6003");
             debugProvider.Breakpoints.Add(0x8005, bp);
             debugProvider.Breakpoints.Add(0x8008, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -500,7 +500,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "HL' == 0x4003");
             debugProvider.Breakpoints.Add(0x8007, bp);
             debugProvider.Breakpoints.Add(0x800A, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -535,7 +535,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "HL' == 0x6003");
             debugProvider.Breakpoints.Add(0x8007, bp);
             debugProvider.Breakpoints.Add(0x800A, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -567,7 +567,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "IX == 0x4003");
             debugProvider.Breakpoints.Add(0x8006, bp);
             debugProvider.Breakpoints.Add(0x800A, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -600,7 +600,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "IX == 0x6003");
             debugProvider.Breakpoints.Add(0x8006, bp);
             debugProvider.Breakpoints.Add(0x800A, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -632,7 +632,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "IY == 0x4003");
             debugProvider.Breakpoints.Add(0x8006, bp);
             debugProvider.Breakpoints.Add(0x800A, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -665,7 +665,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "IY == 0x6003");
             debugProvider.Breakpoints.Add(0x8006, bp);
             debugProvider.Breakpoints.Add(0x800A, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -697,7 +697,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "SP == 0x4003");
             debugProvider.Breakpoints.Add(0x8005, bp);
             debugProvider.Breakpoints.Add(0x8008, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -730,7 +730,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "SP == 0x6003");
             debugProvider.Breakpoints.Add(0x8005, bp);
             debugProvider.Breakpoints.Add(0x8008, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -762,7 +762,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "PC == 0x8005");
             debugProvider.Breakpoints.Add(0x8005, bp);
             debugProvider.Breakpoints.Add(0x8008, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -794,7 +794,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "PC == 0x6003");
             debugProvider.Breakpoints.Add(0x8005, bp);
             debugProvider.Breakpoints.Add(0x8008, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -32,7 +32,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "A == 4");
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -65,7 +65,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "A == 0xFF");
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -98,7 +98,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "B == 4");
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -131,7 +131,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "B == 0xFF");
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -164,7 +164,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "C == 4");
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -197,7 +197,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "C == 0xFF");
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -230,7 +230,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "D == 4");
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -263,7 +263,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "D == 0xFF");
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -296,7 +296,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "E == 4");
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -329,7 +329,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "E == 0xFF");
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -362,7 +362,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "H == 4");
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -395,7 +395,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "H == 0xFF");
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -428,7 +428,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "L == 4");
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -461,7 +461,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "L == 0xFF");
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -494,7 +494,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "F == 0");
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -528,7 +528,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "F == 0xFF");
             debugProvider.Breakpoints.Add(0x8004, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -561,7 +561,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "XH == 4");
             debugProvider.Breakpoints.Add(0x8005, bp);
             debugProvider.Breakpoints.Add(0x8009, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -594,7 +594,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "XH == 0xFF");
             debugProvider.Breakpoints.Add(0x8005, bp);
             debugProvider.Breakpoints.Add(0x8009, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -627,7 +627,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "XL == 4");
             debugProvider.Breakpoints.Add(0x8005, bp);
             debugProvider.Breakpoints.Add(0x8009, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -660,7 +660,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "XL == 0xFF");
             debugProvider.Breakpoints.Add(0x8005, bp);
             debugProvider.Breakpoints.Add(0x8009, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -693,7 +693,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "YH == 4");
             debugProvider.Breakpoints.Add(0x8005, bp);
             debugProvider.Breakpoints.Add(0x8009, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -726,7 +726,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "YH == 0xFF");
             debugProvider.Breakpoints.Add(0x8005, bp);
             debugProvider.Breakpoints.Add(0x8009, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -759,7 +759,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "YL == 4");
             debugProvider.Breakpoints.Add(0x8005, bp);
             debugProvider.Breakpoints.Add(0x8009, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -792,7 +792,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "YL == 0xFF");
             debugProvider.Breakpoints.Add(0x8005, bp);
             debugProvider.Breakpoints.Add(0x8009, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -825,7 +825,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "IXH == 4");
             debugProvider.Breakpoints.Add(0x8005, bp);
             debugProvider.Breakpoints.Add(0x8009, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -858,7 +858,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "IXH == 0xFF");
             debugProvider.Breakpoints.Add(0x8005, bp);
             debugProvider.Breakpoints.Add(0x8009, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -891,7 +891,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "IXL == 4");
             debugProvider.Breakpoints.Add(0x8005, bp);
             debugProvider.Breakpoints.Add(0x8009, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -924,7 +924,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "IXL == 0xFF");
             debugProvider.Breakpoints.Add(0x8005, bp);
             debugProvider.Breakpoints.Add(0x8009, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -957,7 +957,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "IYH == 4");
             debugProvider.Breakpoints.Add(0x8005, bp);
             debugProvider.Breakpoints.Add(0x8009, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -990,7 +990,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "IYH == 0xFF");
             debugProvider.Breakpoints.Add(0x8005, bp);
             debugProvider.Breakpoints.Add(0x8009, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -1023,7 +1023,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "IYL == 4");
             debugProvider.Breakpoints.Add(0x8005, bp);
             debugProvider.Breakpoints.Add(0x8009, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -1056,7 +1056,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "IYL == 0xFF");
             debugProvider.Breakpoints.Add(0x8005, bp);
             debugProvider.Breakpoints.Add(0x8009, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -1089,7 +1089,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "I == 4");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -1122,7 +1122,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "I == 0xFF");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -1155,7 +1155,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "R == 14");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -1189,7 +1189,7 @@ namespace Spect.Net.SpectrumEmu.Test.Machine
             var bp = CreateBreakpoint(null, "R == 13");
             debugProvider.Breakpoints.Add(0x8003, bp);
             debugProvider.Breakpoints.Add(0x8007, MinimumBreakpointInfo.EmptyBreakpointInfo);
-            var regs = spectrum.Cpu.Registers;
+            ref var regs = ref spectrum.Cpu.Registers;
 
             // --- Act
             spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.Debugger));
@@ -0,0 +1,160 @@
+﻿using System;
+using System.Diagnostics;
+using System.Threading;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Shouldly;
+using Spect.Net.SpectrumEmu.Machine;
+using Spect.Net.SpectrumEmu.Test.Helpers;
+
+namespace Spect.Net.SpectrumEmu.Test.Machine
+{
+    [TestClass]
+    public class TurboModeTests
+    {
+        private const string FRAMES_VAR = "SPECTNET_TURBO_BENCH_FRAMES";
+        private const int DEFAULT_FRAMES = 250;
+        private const int TURBO_MULTIPLIER = 8;
+
+        public TestContext TestContext { get; set; }
+
+        [TestMethod]
+        [DataRow(1)]
+        [DataRow(2)]
+        [DataRow(4)]
+        [DataRow(8)]
+        public void TurboModeRendersTheSameFrame(int multiplier)
+        {
+            TurboModeRendersTheSameFrame(multiplier, new byte[]
+            {
+                0xF3,             // DI
+                0x3E, 0x05,       // LD A,$05
+                0xD3, 0xFE,       // OUT ($FE),A
+                0x18, 0xFE        // JR $
+            });
+        }
+
+        [TestMethod]
+        [DataRow(1)]
+        [DataRow(2)]
+        [DataRow(4)]
+        [DataRow(8)]
+        public void TurboModeRendersMidScanlineWrites(int multiplier)
+        {
+            // --- The loop changes the border and the screen memory several
+            // --- times within each scanline
+            TurboModeRendersTheSameFrame(multiplier, new byte[]
+            {
+                0xF3,             // DI
+                0x21, 0x00, 0x40, // LD HL,$4000
+                0x04,             // LOOP: INC B
+                0x78,             // LD A,B
+                0xE6, 0x07,       // AND $07
+                0xD3, 0xFE,       // OUT ($FE),A
+                0x70,             // LD (HL),B
+                0x23,             // INC HL
+                0x7C,             // LD A,H
+                0xE6, 0x1F,       // AND $1F
+                0xF6, 0x40,       // OR $40
+                0x67,             // LD H,A
+                0x18, 0xF0        // JR LOOP
+            });
+        }
+
+        private static void TurboModeRendersTheSameFrame(int multiplier, byte[] code)
+        {
+            // --- Arrange
+            var normal = CreateMachine(multiplier);
+            var turbo = CreateMachine(multiplier);
+            normal.InitCode(code);
+            turbo.InitCode(code);
+
+            // --- Act
+            for (var i = 0; i < 2; i++)
+            {
+                normal.ExecuteCycle(CancellationToken.None,
+                    new ExecuteCycleOptions(EmulationMode.UntilFrameEnds));
+                turbo.ExecuteCycle(CancellationToken.None,
+                    new ExecuteCycleOptions(EmulationMode.UntilFrameEnds, turboMode: true));
+            }
+
+            // --- Assert
+            turbo.Cpu.Tacts.ShouldBe(normal.Cpu.Tacts);
+            turbo.LastRenderedUlaTact.ShouldBe(normal.LastRenderedUlaTact);
+            turbo.ScreenDevice.GetPixelBuffer().ShouldBe(normal.ScreenDevice.GetPixelBuffer());
+        }
+
+        [TestMethod]
+        public void CurrentFrameTactUsesClockMultiplier()
+        {
+            // --- Arrange
+            var spectrum = CreateMachine(TURBO_MULTIPLIER);
+            spectrum.InitCode(new byte[]
+            {
+                0xF3,             // DI
+                0x76              // HALT
+            });
+
+            // --- Act
+            spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.UntilHalt));
+
+            // --- Assert
+            spectrum.CurrentFrameTact.ShouldBe(spectrum.CurrentFrameCpuTact / TURBO_MULTIPLIER);
+        }
+
+        /// <summary>
+        /// Runs the ZX Spectrum 48 ROM at 28 MHz and reports the emulation
+        /// speed compared to real time
+        /// </summary>
+        /// <remarks>
+        /// The speed depends on the host, so the test only reports it; a
+        /// real-time factor below 1.0 means turbo mode cannot keep up with
+        /// the 28 MHz target. Run it with the "Benchmark" test category
+        /// filter. The number of emulated frames can be set with the
+        /// SPECTNET_TURBO_BENCH_FRAMES environment variable.
+        /// </remarks>
+        [TestMethod]
+        [TestCategory("Benchmark")]
+        public void TurboModeBenchmark()
+        {
+            var value = Environment.GetEnvironmentVariable(FRAMES_VAR);
+            var frames = int.TryParse(value, out var result) && result > 0 ? result : DEFAULT_FRAMES;
+
+            foreach (var turboMode in new[] { false, true })
+            {
+                // --- Arrange
+                var spectrum = CreateMachine(TURBO_MULTIPLIER);
+                var options = new ExecuteCycleOptions(EmulationMode.UntilFrameEnds,
+                    fastVmMode: true, turboMode: turboMode);
+                var startTacts = spectrum.Cpu.Tacts;
+                var watch = Stopwatch.StartNew();
+
+                // --- Act
+                for (var i = 0; i < frames; i++)
+                {
+                    spectrum.ExecuteCycle(CancellationToken.None, options);
+                }
+                watch.Stop();
+
+                // --- Report
+                var tacts = spectrum.Cpu.Tacts - startTacts;
+                var seconds = watch.Elapsed.TotalSeconds;
+                var targetFrequency = (double)spectrum.BaseClockFrequency * TURBO_MULTIPLIER;
+                var realTimeFactor = tacts / seconds / targetFrequency;
+                TestContext.WriteLine($"Turbo mode: {turboMode}, frames: {frames}, "
+                    + $"time: {seconds * 1000:F0}ms, "
+                    + $"speed: {tacts / seconds / 1_000_000:F2} MHz, "
+                    + $"real-time factor: {realTimeFactor:F2}");
+
+                // --- Assert
+                spectrum.FrameCount.ShouldBe(frames);
+            }
+        }
+
+        private static SpectrumAdvancedTestMachine CreateMachine(int multiplier)
+        {
+            var cpuConfig = SpectrumModels.ZxSpectrum48Pal.Cpu.Clone();
+            cpuConfig.ClockMultiplier = multiplier;
+            return new SpectrumAdvancedTestMachine(cpuConfig: cpuConfig);
+        }
+    }
+}
@@ -0,0 +1,190 @@
+﻿using System.Collections.Generic;
+using System.IO;
+using System.Text;
+using System.Threading;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Shouldly;
+using Spect.Net.SpectrumEmu.Machine;
+using Spect.Net.SpectrumEmu.Recording;
+using Spect.Net.SpectrumEmu.Test.Helpers;
+
+namespace Spect.Net.SpectrumEmu.Test.Recording
+{
+    [TestClass]
+    public class FrameRecorderTests
+    {
+        [TestMethod]
+        public void RecorderWritesEveryFrame()
+        {
+            // --- Arrange
+            var spectrum = new SpectrumAdvancedTestMachine();
+            var video = new MemoryStream();
+            var audio = new MemoryStream();
+            var writer = new RawRecordingWriter(video, audio);
+            var recorder = new FrameRecorder(writer);
+
+            // --- Act
+            recorder.Start(spectrum);
+            RunFrames(spectrum, 3);
+            recorder.Stop();
+
+            // --- Assert
+            var screen = spectrum.ScreenConfiguration;
+            recorder.RecordedFrames.ShouldBe(3);
+            recorder.WrittenFrames.ShouldBe(3);
+            recorder.DroppedFrames.ShouldBe(0);
+            recorder.WriterError.ShouldBeNull();
+            spectrum.FrameRecorder.ShouldBeNull();
+            video.Length.ShouldBe(3L * screen.ScreenWidth * screen.ScreenLines);
+            audio.Length.ShouldBe(writer.SamplesWritten * 2);
+            writer.SamplesWritten.ShouldBeGreaterThanOrEqualTo(3 * 699);
+        }
+
+        [TestMethod]
+        public void SlowWriterDropsFrames()
+        {
+            // --- Arrange
+            var spectrum = new SpectrumAdvancedTestMachine();
+            var writer = new BlockingWriter();
+            var recorder = new FrameRecorder(writer, 1);
+
+            // --- Act
+            recorder.Start(spectrum);
+            RunFrames(spectrum, 5);
+            writer.Gate.Set();
+            recorder.Stop();
+
+            // --- Assert
+            recorder.DroppedFrames.ShouldBeGreaterThan(0);
+            (recorder.RecordedFrames + recorder.DroppedFrames).ShouldBe(5);
+            writer.FrameNumbers.Count.ShouldBe((int)recorder.RecordedFrames);
+            writer.FrameNumbers[0].ShouldBe(0);
+            writer.Ended.ShouldBeTrue();
+        }
+
+        [TestMethod]
+        public void AviWriterCompletesHeadersAndIndex()
+        {
+            // --- Arrange
+            var stream = new MemoryStream();
+            var writer = new AviRecordingWriter(segment => stream);
+            var format = new RecordingFormat(8, 2, new uint[] { 0xFF000000, 0xFFFFFFFF }, 50m, 1000);
+
+            // --- Act
+            writer.Begin(format);
+            writer.WriteFrame(CreateFrame(0, 16, 20));
+            writer.WriteFrame(CreateFrame(2, 16, 20));
+            writer.End();
+
+            // --- Assert
+            var bytes = stream.ToArray();
+            Encoding.ASCII.GetString(bytes, 0, 4).ShouldBe("RIFF");
+            Encoding.ASCII.GetString(bytes, 8, 4).ShouldBe("AVI ");
+            var reader = new BinaryReader(new MemoryStream(bytes));
+            reader.BaseStream.Position = 4;
+            reader.ReadInt32().ShouldBe(bytes.Length - 8);
+
+            // --- The dropped frame is an empty chunk
+            var text = Encoding.ASCII.GetString(bytes);
+            var indexPos = text.IndexOf("idx1");
+            indexPos.ShouldBeGreaterThan(0);
+            reader.BaseStream.Position = indexPos + 4;
+            var entries = reader.ReadInt32() / 16;
+            var videoSizes = new List<int>();
+            var audioSizes = new List<int>();
+            for (var i = 0; i < entries; i++)
+            {
+                var id = Encoding.ASCII.GetString(reader.ReadBytes(4));
+                reader.ReadInt32();
+                reader.ReadInt32();
+                var size = reader.ReadInt32();
+                (id == "00db" ? videoSizes : audioSizes).Add(size);
+            }
+            videoSizes.ShouldBe(new[] { 16, 0, 16 });
+            audioSizes.ShouldBe(new[] { 40, 40, 40 });
+        }
+
+        [TestMethod]
+        public void AviWriterContinuesInNewSegments()
+        {
+            // --- Arrange
+            var streams = new List<MemoryStream>();
+            var writer = new AviRecordingWriter(segment =>
+            {
+                var segmentStream = new MemoryStream();
+                streams.Add(segmentStream);
+                return segmentStream;
+            })
+            {
+                MaxSegmentSize = 2048
+            };
+            var format = new RecordingFormat(32, 16, new uint[] { 0xFF000000 }, 50m, 0);
+
+            // --- Act
+            writer.Begin(format);
+            for (var i = 0; i < 10; i++)
+            {
+                writer.WriteFrame(CreateFrame(i, 32 * 16, 0));
+            }
+            writer.End();
+
+            // --- Assert
+            writer.SegmentCount.ShouldBeGreaterThan(1);
+            streams.Count.ShouldBe(writer.SegmentCount);
+            foreach (var segmentStream in streams)
+            {
+                var bytes = segmentStream.ToArray();
+                Encoding.ASCII.GetString(bytes, 0, 4).ShouldBe("RIFF");
+                (bytes[4] | bytes[5] << 8 | bytes[6] << 16 | bytes[7] << 24).ShouldBe(bytes.Length - 8);
+            }
+        }
+
+        [TestMethod]
+        public void SegmentFileNamesGetSuffix()
+        {
+            AviRecordingWriter.GetSegmentFileName(@"C:\Temp\game.avi", 0).ShouldBe(@"C:\Temp\game.avi");
+            AviRecordingWriter.GetSegmentFileName(@"C:\Temp\game.avi", 2).ShouldBe(@"C:\Temp\game_002.avi");
+        }
+
+        private static void RunFrames(SpectrumAdvancedTestMachine spectrum, int frames)
+        {
+            for (var i = 0; i < frames; i++)
+            {
+                spectrum.ExecuteCycle(CancellationToken.None,
+                    new ExecuteCycleOptions(EmulationMode.UntilFrameEnds));
+            }
+        }
+
+        private static RecordedFrame CreateFrame(long frameNumber, int pixels, int samples)
+        {
+            var frame = new RecordedFrame(pixels, samples) { FrameNumber = frameNumber };
+            frame.SetAudio(new float[samples], samples);
+            return frame;
+        }
+
+        /// <summary>
+        /// Writer that waits until the test opens its gate
+        /// </summary>
+        private class BlockingWriter : IFrameRecordingWriter
+        {
+            public readonly ManualResetEventSlim Gate = new ManualResetEventSlim(false);
+            public readonly List<long> FrameNumbers = new List<long>();
+            public bool Ended;
+
+            public void Begin(RecordingFormat format)
+            {
+            }
+
+            public void WriteFrame(RecordedFrame frame)
+            {
+                Gate.Wait();
+                FrameNumbers.Add(frame.FrameNumber);
+            }
+
+            public void End()
+            {
+                Ended = true;
+            }
+        }
+    }
+}
@@ -434,6 +434,28 @@ namespace Spect.Net.SpectrumEmu.Test.Scripting
             sm.ExecutionCompletionReason.ShouldBe(ExecutionCompletionReason.BreakpointReached);
         }
 
+        [TestMethod]
+        public async Task ProfilingStatisticsAreAvailableAfterStop()
+        {
+            // --- Arrange
+            var sm = SpectrumVmFactory.CreateSpectrum48Pal();
+            var profiler = sm.StartProfiling();
+            sm.TimeoutInMs = 10;
+            sm.Start();
+            await sm.CompletionTask;
+
+            // --- Act
+            var stopped = sm.StopProfiling();
+            var table = sm.GetProfilingTable();
+            var json = sm.GetProfilingJson();
+
+            // --- Assert
+            stopped.ShouldBeSameAs(profiler);
+            sm.Profiler.ShouldBeNull();
+            table.ShouldBe(profiler.ToTable());
+            json.ShouldBe(profiler.ToJson());
+        }
+
         [TestMethod]
         public async Task MachineStopsAfterTimeout()
         {
@@ -521,6 +543,33 @@ namespace Spect.Net.SpectrumEmu.Test.Scripting
             creationTimeBefore.ShouldBe(creationTimeAfter);
         }
 
+        [TestMethod]
+        public async Task Spectrum48StartAndRunToMainPrefersExistingStateFile()
+        {
+            // --- Arrange
+            const string STATE_FILE = SpectrumVmStateFileManagerBase.SPECTRUM_48_STARTUP;
+            var filename = Path.Combine(STATE_FOLDER, STATE_FILE);
+            if (File.Exists(filename))
+            {
+                File.Delete(filename);
+            }
+            var sm = SpectrumVmFactory.CreateSpectrum48Pal();
+            sm.CachedVmStateFolder = STATE_FOLDER;
+            await sm.StartAndRunToMain();
+            sm.Cpu.PC = 0x1234;
+            sm.SaveMachineStateTo(filename);
+            await sm.Stop();
+
+            // --- Act
+            await sm.StartAndRunToMain();
+
+            // --- Assert
+            sm.MachineState.ShouldBe(VmState.Paused);
+            sm.Cpu.PC.ShouldBe((ushort)0x1234);
+            File.Delete(filename);
+            sm.Dispose();
+        }
+
         [TestMethod]
         public async Task Spectrum128StartAndRunToMainWorksWithNoStateFile()
         {
@@ -0,0 +1,180 @@
+﻿using System;
+using System.IO;
+using System.Threading;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Shouldly;
+using Spect.Net.SpectrumEmu.Machine;
+using Spect.Net.SpectrumEmu.Scripting;
+using Spect.Net.SpectrumEmu.Test.Helpers;
+
+namespace Spect.Net.SpectrumEmu.Test.Scripting
+{
+    [TestClass]
+    public class StartupStateCacheTests
+    {
+        private const string MODEL = "ZX Spectrum 48";
+
+        [TestMethod]
+        public void KeyDependsOnStateAndModel()
+        {
+            // --- Arrange
+            var spectrum = new SpectrumAdvancedTestMachine();
+
+            // --- Act
+            var key1 = StartupStateCache.ComputeKey(spectrum, MODEL, "startup.vmstate");
+            var key2 = StartupStateCache.ComputeKey(new SpectrumAdvancedTestMachine(), MODEL, "startup.vmstate");
+            var key3 = StartupStateCache.ComputeKey(spectrum, MODEL, "other.vmstate");
+            var key4 = StartupStateCache.ComputeKey(spectrum, "ZX Spectrum 128", "startup.vmstate");
+
+            // --- Assert
+            key1.Length.ShouldBe(64);
+            key2.ShouldBe(key1);
+            key3.ShouldNotBe(key1);
+            key4.ShouldNotBe(key1);
+        }
+
+        [TestMethod]
+        public void SnapshotRestoresRegistersAndMemory()
+        {
+            // --- Arrange
+            var spectrum = new SpectrumAdvancedTestMachine();
+            spectrum.InitCode(new byte[]
+            {
+                0x21, 0x34, 0x12, // LD HL,1234H
+                0x3E, 0xA5,       // LD A,A5H
+                0x32, 0x00, 0x90, // LD (9000H),A
+                0x76              // HALT
+            });
+            spectrum.ExecuteCycle(CancellationToken.None, new ExecuteCycleOptions(EmulationMode.UntilHalt));
+            var pc = spectrum.Cpu.Registers.PC;
+            var snapshot = spectrum.CreateSnapshot(MODEL);
+
+            // --- Act
+            spectrum.Cpu.Registers.HL = 0;
+            spectrum.MemoryDevice.Write(0x9000, 0x00);
+            spectrum.RestoreSnapshot(snapshot, MODEL);
+
+            // --- Assert
+            spectrum.Cpu.Registers.HL.ShouldBe((ushort)0x1234);
+            spectrum.Cpu.Registers.PC.ShouldBe(pc);
+            spectrum.MemoryDevice.Read(0x9000).ShouldBe((byte)0xA5);
+        }
+
+        [TestMethod]
+        public void SnapshotCanBeRestoredMoreThanOnce()
+        {
+            // --- Arrange
+            var spectrum = new SpectrumAdvancedTestMachine();
+            spectrum.MemoryDevice.Write(0x9000, 0x5A);
+            var snapshot = spectrum.CreateSnapshot(MODEL);
+
+            // --- Act
+            spectrum.RestoreSnapshot(snapshot, MODEL);
+            spectrum.MemoryDevice.Write(0x9000, 0x00);
+            spectrum.RestoreSnapshot(snapshot, MODEL);
+
+            // --- Assert
+            spectrum.MemoryDevice.Read(0x9000).ShouldBe((byte)0x5A);
+        }
+
+        [TestMethod]
+        public void SnapshotOfOtherModelIsRejected()
+        {
+            // --- Arrange
+            var spectrum = new SpectrumAdvancedTestMachine();
+            var snapshot = spectrum.CreateSnapshot(MODEL);
+
+            // --- Act/Assert
+            Should.Throw<InvalidVmStateException>(() => spectrum.RestoreSnapshot(snapshot, "ZX Spectrum 128"));
+        }
+
+        [TestMethod]
+        public void LeastRecentlyUsedSnapshotIsEvicted()
+        {
+            // --- Arrange
+            var cache = new StartupStateCache(null);
+            var snapshot = new SpectrumAdvancedTestMachine().CreateSnapshot(MODEL);
+            for (var i = 0; i < StartupStateCache.MAX_SNAPSHOTS; i++)
+            {
+                cache.StoreSnapshot($"key{i}", snapshot);
+            }
+
+            // --- Act
+            cache.TryGetSnapshot("key0", out _);
+            cache.StoreSnapshot("new", snapshot);
+
+            // --- Assert
+            cache.TryGetSnapshot("key0", out _).ShouldBeTrue();
+            cache.TryGetSnapshot("key1", out _).ShouldBeFalse();
+            cache.TryGetSnapshot("new", out var found).ShouldBeTrue();
+            found.ShouldBeSameAs(snapshot);
+        }
+
+        [TestMethod]
+        public void StateFilesAreSharedThroughFolder()
+        {
+            // --- Arrange
+            var folder = Path.Combine(Path.GetTempPath(), "StartupStateCacheTests", Guid.NewGuid().ToString("N"));
+            var writer = new StartupStateCache(folder);
+            var reader = new StartupStateCache(folder);
+
+            try
+            {
+                // --- Act
+                var missing = reader.TryReadState("abc");
+                var written = writer.WriteState("abc", "{ \"state\": 1 }");
+                var read = reader.TryReadState("abc");
+
+                // --- Assert
+                missing.ShouldBeNull();
+                written.ShouldBeTrue();
+                read.ShouldBe("{ \"state\": 1 }");
+                Directory.GetFiles(folder).Length.ShouldBe(1);
+            }
+            finally
+            {
+                Directory.Delete(folder, true);
+            }
+        }
+
+        [TestMethod]
+        public void RemovedStateIsNotRead()
+        {
+            // --- Arrange
+            var folder = Path.Combine(Path.GetTempPath(), "StartupStateCacheTests", Guid.NewGuid().ToString("N"));
+            var cache = new StartupStateCache(folder);
+            var spectrum = new SpectrumAdvancedTestMachine();
+            cache.WriteState("abc", "{ \"state\": 1 }");
+            cache.StoreSnapshot("abc", spectrum.CreateSnapshot(MODEL));
+
+            try
+            {
+                // --- Act
+                cache.RemoveState("abc");
+
+                // --- Assert
+                cache.TryReadState("abc").ShouldBeNull();
+                cache.TryGetSnapshot("abc", out _).ShouldBeFalse();
+                Directory.GetFiles(folder).Length.ShouldBe(0);
+            }
+            finally
+            {
+                Directory.Delete(folder, true);
+            }
+        }
+
+        [TestMethod]
+        public void MemoryOnlyCacheDoesNotWriteFiles()
+        {
+            // --- Arrange
+            var cache = new StartupStateCache(null);
+
+            // --- Act
+            var written = cache.WriteState("abc", "{}");
+
+            // --- Assert
+            written.ShouldBeFalse();
+            cache.TryReadState("abc").ShouldBeNull();
+        }
+    }
+}
@@ -0,0 +1,89 @@
+﻿using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Shouldly;
+using Spect.Net.SpectrumEmu.Utility;
+
+namespace Spect.Net.SpectrumEmu.Test.Utility
+{
+    [TestClass]
+    public class AdaptiveResamplerTests
+    {
+        [TestMethod]
+        public void FixedRatePassesSamplesThrough()
+        {
+            // --- Arrange
+            var ring = new AudioRingBuffer(64);
+            var input = new float[32];
+            for (var i = 0; i < input.Length; i++) input[i] = i;
+            ring.Write(input, 0, input.Length);
+            var resampler = new AdaptiveResampler(16, 0.0);
+            var output = new float[20];
+
+            // --- Act
+            var missing = resampler.Process(ring, output, 0, output.Length);
+
+            // --- Assert: the output is delayed by one sample
+            missing.ShouldBe(0);
+            output[0].ShouldBe(0.0f);
+            for (var i = 1; i < output.Length; i++)
+            {
+                output[i].ShouldBe(input[i - 1]);
+            }
+            ring.Count.ShouldBe(12);
+        }
+
+        [TestMethod]
+        public void FullBufferIsConsumedFaster()
+        {
+            // --- Arrange
+            var ring = new AudioRingBuffer(4096);
+            ring.Write(new float[4000], 0, 4000);
+            var resampler = new AdaptiveResampler(1000);
+
+            // --- Act
+            for (var i = 0; i < 100; i++)
+            {
+                resampler.Process(ring, new float[10], 0, 10);
+            }
+
+            // --- Assert
+            resampler.Ratio.ShouldBeGreaterThan(1.0);
+            resampler.Ratio.ShouldBeLessThanOrEqualTo(1.0 + AdaptiveResampler.DEFAULT_MAX_DEVIATION);
+        }
+
+        [TestMethod]
+        public void LowBufferIsConsumedSlower()
+        {
+            // --- Arrange
+            var ring = new AudioRingBuffer(4096);
+            ring.Write(new float[2000], 0, 2000);
+            var resampler = new AdaptiveResampler(3000);
+
+            // --- Act
+            for (var i = 0; i < 100; i++)
+            {
+                resampler.Process(ring, new float[10], 0, 10);
+            }
+
+            // --- Assert
+            resampler.Ratio.ShouldBeLessThan(1.0);
+            resampler.Ratio.ShouldBeGreaterThanOrEqualTo(1.0 - AdaptiveResampler.DEFAULT_MAX_DEVIATION);
+        }
+
+        [TestMethod]
+        public void UnderrunHoldsLastSample()
+        {
+            // --- Arrange
+            var ring = new AudioRingBuffer(16);
+            ring.Write(new[] { 0.5f, 0.5f, 0.5f }, 0, 3);
+            var resampler = new AdaptiveResampler(8, 0.0);
+            var output = new float[8];
+
+            // --- Act
+            var missing = resampler.Process(ring, output, 0, output.Length);
+
+            // --- Assert
+            missing.ShouldBe(5);
+            output[7].ShouldBe(0.5f);
+        }
+    }
+}
@@ -0,0 +1,116 @@
+﻿using System.Threading.Tasks;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Shouldly;
+using Spect.Net.SpectrumEmu.Utility;
+
+namespace Spect.Net.SpectrumEmu.Test.Utility
+{
+    [TestClass]
+    public class AudioRingBufferTests
+    {
+        [TestMethod]
+        public void CapacityIsRoundedUpToPowerOfTwo()
+        {
+            // --- Act
+            var ring = new AudioRingBuffer(1000);
+
+            // --- Assert
+            ring.Capacity.ShouldBe(1024);
+            ring.Count.ShouldBe(0);
+        }
+
+        [TestMethod]
+        public void ReadReturnsSamplesAcrossWrapAround()
+        {
+            // --- Arrange
+            var ring = new AudioRingBuffer(8);
+            var output = new float[8];
+            ring.Write(new[] { 1f, 2f, 3f, 4f, 5f, 6f }, 0, 6);
+            ring.Read(output, 0, 6);
+
+            // --- Act
+            ring.Write(new[] { 7f, 8f, 9f, 10f, 11f }, 0, 5);
+            var read = ring.Read(output, 0, 5);
+
+            // --- Assert
+            read.ShouldBe(5);
+            output[0].ShouldBe(7f);
+            output[4].ShouldBe(11f);
+            ring.Count.ShouldBe(0);
+        }
+
+        [TestMethod]
+        public void OverrunDropsSamples()
+        {
+            // --- Arrange
+            var ring = new AudioRingBuffer(4);
+
+            // --- Act
+            var written = ring.Write(new[] { 1f, 2f, 3f, 4f, 5f, 6f }, 0, 6);
+
+            // --- Assert
+            written.ShouldBe(4);
+            ring.Count.ShouldBe(4);
+            ring.Overruns.ShouldBe(1);
+        }
+
+        [TestMethod]
+        public void UnderrunReadsAvailableSamples()
+        {
+            // --- Arrange
+            var ring = new AudioRingBuffer(4);
+            ring.Write(new[] { 1f, 2f }, 0, 2);
+
+            // --- Act
+            var read = ring.Read(new float[4], 0, 4);
+
+            // --- Assert
+            read.ShouldBe(2);
+            ring.Underruns.ShouldBe(1);
+        }
+
+        [TestMethod]
+        public void ProducerAndConsumerThreadsKeepOrder()
+        {
+            // --- Arrange
+            const int TOTAL = 200_000;
+            var ring = new AudioRingBuffer(256);
+            var errors = 0;
+
+            // --- Act
+            var producer = Task.Run(() =>
+            {
+                var chunk = new float[37];
+                var next = 0;
+                while (next < TOTAL)
+                {
+                    var count = 0;
+                    while (count < chunk.Length && next + count < TOTAL)
+                    {
+                        chunk[count] = next + count;
+                        count++;
+                    }
+                    next += ring.Write(chunk, 0, count);
+                }
+            });
+            var consumer = Task.Run(() =>
+            {
+                var chunk = new float[29];
+                var expected = 0;
+                while (expected < TOTAL)
+                {
+                    var read = ring.Read(chunk, 0, chunk.Length);
+                    for (var i = 0; i < read; i++)
+                    {
+                        if (chunk[i] != expected++) errors++;
+                    }
+                }
+            });
+            Task.WaitAll(producer, consumer);
+
+            // --- Assert
+            errors.ShouldBe(0);
+            ring.Count.ShouldBe(0);
+        }
+    }
+}
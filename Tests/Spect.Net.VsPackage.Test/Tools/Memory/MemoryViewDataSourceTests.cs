@@ -0,0 +1,128 @@
+﻿using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Shouldly;
+using Spect.Net.VsPackage.ToolWindows.Memory;
+
+namespace Spect.Net.VsPackage.Test.Tools.Memory
+{
+    [TestClass]
+    public class MemoryViewDataSourceTests
+    {
+        [TestMethod]
+        public void BindSetsLineCount()
+        {
+            // --- Arrange
+            var ds = new MemoryViewDataSource();
+
+            // --- Act
+            ds.Bind(new byte[0x4000], 0x4000);
+
+            // --- Assert
+            ds.Length.ShouldBe(0x4000);
+            ds.LineCount.ShouldBe(0x400);
+        }
+
+        [TestMethod]
+        public void RefreshWithoutChangeReportsNoLines()
+        {
+            // --- Arrange
+            var ds = new MemoryViewDataSource();
+            var memory = new byte[0x4000];
+            ds.Bind(memory, 0x4000);
+            var eventRaised = false;
+            ds.LinesChanged += (s, e) => eventRaised = true;
+
+            // --- Act
+            var changed = ds.Refresh();
+
+            // --- Assert
+            changed.Count.ShouldBe(0);
+            eventRaised.ShouldBeFalse();
+        }
+
+        [TestMethod]
+        public void RefreshReportsChangedLinesOnlyOnce()
+        {
+            // --- Arrange
+            var ds = new MemoryViewDataSource();
+            var memory = new byte[0x4000];
+            ds.Bind(memory, 0x4000);
+            memory[0x0000] = 0x01;
+            memory[0x000F] = 0x02;
+            memory[0x1234] = 0x03;
+            memory[0x3FFF] = 0x04;
+
+            // --- Act
+            var changed = ds.Refresh();
+            var changedAgain = ds.Refresh();
+
+            // --- Assert
+            changed.ShouldBe(new[] { 0x000, 0x123, 0x3FF });
+            changedAgain.Count.ShouldBe(0);
+        }
+
+        [TestMethod]
+        public void RefreshWithNewBufferComparesToLastContents()
+        {
+            // --- Arrange
+            var ds = new MemoryViewDataSource();
+            var memory = new byte[0x10000];
+            ds.Bind(memory, 0x10000);
+            var clone = (byte[])memory.Clone();
+            clone[0x8000] = 0xAA;
+            MemoryLinesChangedEventArgs args = null;
+            ds.LinesChanged += (s, e) => args = e;
+
+            // --- Act
+            var changed = ds.Refresh(clone);
+
+            // --- Assert
+            changed.ShouldBe(new[] { 0x800 });
+            args.ShouldNotBeNull();
+            args.LineIndexes.ShouldBe(new[] { 0x800 });
+            ds.Memory.ShouldBeSameAs(clone);
+        }
+
+        [TestMethod]
+        public void LazyLineIsBoundOnDemand()
+        {
+            // --- Arrange
+            var ds = new MemoryViewDataSource();
+            var memory = new byte[0x4000];
+            memory[0x0010] = 0xC3;
+            ds.Bind(memory, 0x4000);
+            var line = new MemoryLineViewModel(null, 0x0010);
+            line.BindLazily(ds);
+
+            // --- Act
+            var valueBefore = line.Value0;
+            line.EnsureBound();
+
+            // --- Assert
+            valueBefore.ShouldBeNull();
+            line.IsBound.ShouldBeTrue();
+            line.Value0.ShouldBe("C3");
+        }
+
+        [TestMethod]
+        public void ReleasedLineIsNotRebound()
+        {
+            // --- Arrange
+            var ds = new MemoryViewDataSource();
+            var memory = new byte[0x4000];
+            ds.Bind(memory, 0x4000);
+            var line = new MemoryLineViewModel(null, 0x0010);
+            line.BindLazily(ds);
+            line.EnsureBound();
+            line.Release();
+            memory[0x0010] = 0x3E;
+
+            // --- Act
+            line.Rebind();
+
+            // --- Assert
+            line.Value0.ShouldBe("00");
+            line.EnsureBound();
+            line.Value0.ShouldBe("3E");
+        }
+    }
+}
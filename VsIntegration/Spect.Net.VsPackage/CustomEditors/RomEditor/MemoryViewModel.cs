@@ -1,6 +1,6 @@
 ﻿using System.Collections.Generic;
 using System.Collections.ObjectModel;
-using Spect.Net.SpectrumEmu.Cpu;
+using Spect.Net.SpectrumEmu.Abstraction.Devices;
 using Spect.Net.SpectrumEmu.Disassembler;
 using Spect.Net.VsPackage.ToolWindows.Disassembly;
 using Spect.Net.VsPackage.ToolWindows.Memory;
@@ -18,7 +18,7 @@ namespace Spect.Net.VsPackage.CustomEditors.RomEditor
         private bool _allowDisassembly;
         private bool _showDisassembly;
         private ObservableCollection<DisassemblyItemViewModel> _disassemblyItems;
-        private Registers _registers;
+        private IZ80Cpu _cpu;
 
         /// <summary>
         /// The contents of the memory
@@ -91,12 +91,12 @@ namespace Spect.Net.VsPackage.CustomEditors.RomEditor
         }
 
         /// <summary>
-        /// The current values of Z80 registers
+        /// The CPU with the current values of Z80 registers
         /// </summary>
-        public Registers Registers
+        public IZ80Cpu Cpu
         {
-            get => _registers;
-            set => Set(ref _registers, value);
+            get => _cpu;
+            set => Set(ref _cpu, value);
         }
 
         /// <summary>
@@ -144,7 +144,7 @@ namespace Spect.Net.VsPackage.CustomEditors.RomEditor
 
             for (var addr = 0x0000; addr < _memoryBuffer.Length; addr += 16)
             {
-                var line = new MemoryLineViewModel(Registers, addr, _memoryBuffer.Length - 1);
+                var line = new MemoryLineViewModel(Cpu, addr, _memoryBuffer.Length - 1);
                 line.BindTo(MemoryBuffer);
                 MemoryLines.Add(line);
             }
@@ -19,6 +19,12 @@ namespace Spect.Net.VsPackage
         [Description("Specifies if fast load is enabled for loading tape files")]
         public bool UseFastLoad { get; set; } = false;
 
+        [Category("Virtual machine")]
+        [DisplayName("Use Fast Disk")]
+        [Description("Specifies if +3DOS reads and writes disk sectors directly from the virtual " +
+                     "floppy files, without emulating the disk controller")]
+        public bool UseFastDisk { get; set; } = false;
+
         [Category("Virtual machine")]
         [DisplayName("SAVE folder")]
         [Description("When the SAVE command is used, the virtual machine strores the " +
@@ -57,6 +63,12 @@ namespace Spect.Net.VsPackage
         [Description("Virtual floppy disk files are added to this folder")]
         public string VfddFolder { get; set; } = @"FloppyDisks";
 
+        [Category("Virtual machine")]
+        [DisplayName("Watch evaluation interval")]
+        [Description("The number of CPU tacts between two evaluations of the watch " +
+                     "expressions while the machine runs. Zero means every frame.")]
+        public int WatchEvaluationTacts { get; set; } = 0;
+
         // --- Run Z80 Code options
         [Category("Run Z80 Code")]
         [DisplayName("Confirm non-zero displacement")]
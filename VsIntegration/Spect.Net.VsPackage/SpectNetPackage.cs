@@ -215,9 +215,8 @@ namespace Spect.Net.VsPackage
             SpectrumMachine.RegisterProvider<IRomProvider>(() => new PackageRomProvider());
             SpectrumMachine.RegisterProvider<IKeyboardProvider>(() => new KeyboardProvider());
             SpectrumMachine.RegisterProvider<IKempstonProvider>(() => new KempstonProvider());
-            SpectrumMachine.RegisterProvider<IBeeperProvider>(() => new AudioWaveProvider());
             SpectrumMachine.RegisterProvider<ITapeProvider>(() => new VsIntegratedTapeProvider());
-            SpectrumMachine.RegisterProvider<ISoundProvider>(() => new AudioWaveProvider(AudioProviderType.Psg));
+            SpectrumMachine.RegisterProvider<IAudioMixerProvider>(() => new AudioWaveProvider(AudioProviderType.Mixer));
             DebugInfoProvider = new VsIntegratedSpectrumDebugInfoProvider();
             SpectrumMachine.RegisterProvider<ISpectrumDebugInfoProvider>(() => DebugInfoProvider);
 
@@ -1,4 +1,5 @@
-﻿using Spect.Net.Wpf.Mvvm;
+﻿using System;
+using Spect.Net.Wpf.Mvvm;
 
 namespace Spect.Net.VsPackage.ToolWindows.BasicList
 {
@@ -7,6 +8,7 @@ namespace Spect.Net.VsPackage.ToolWindows.BasicList
         private int _lineNo;
         private int _length;
         private string _text;
+        private Func<string> _textProvider;
 
         /// <summary>
         /// Line number
@@ -26,10 +28,42 @@ namespace Spect.Net.VsPackage.ToolWindows.BasicList
         /// <summary>
         /// BASIC line text
         /// </summary>
+        /// <remarks>
+        /// When the text is not set, it is created by the text provider the
+        /// first time it is asked for, so only the displayed lines are formatted
+        /// </remarks>
         public string Text
         {
-            get => _text;
-            set => Set(ref _text, value);
+            get
+            {
+                if (_text == null && _textProvider != null)
+                {
+                    _text = _textProvider();
+                    _textProvider = null;
+                }
+                return _text;
+            }
+            set
+            {
+                _textProvider = null;
+                Set(ref _text, value);
+            }
+        }
+
+        /// <summary>
+        /// Instantiates this view model
+        /// </summary>
+        public BasicLineViewModel()
+        {
+        }
+
+        /// <summary>
+        /// Instantiates this view model with a text that is created on demand
+        /// </summary>
+        /// <param name="textProvider">Function that creates the text of the line</param>
+        public BasicLineViewModel(Func<string> textProvider)
+        {
+            _textProvider = textProvider;
         }
     }
 }
\ No newline at end of file
@@ -1,4 +1,4 @@
-using Spect.Net.SpectrumEmu.Machine;
+using Spect.Net.SpectrumEmu.Basic;
 
 namespace Spect.Net.VsPackage.ToolWindows.BasicList
 {
@@ -8,6 +8,7 @@ namespace Spect.Net.VsPackage.ToolWindows.BasicList
     public class BasicListToolWindowViewModel: SpectrumGenericToolWindowViewModel
     {
         private BasicListViewModel _basicListViewModel;
+        private BasicListing _listing;
 
         /// <summary>
         /// The view model that represents the BASIC List
@@ -38,13 +39,14 @@ namespace Spect.Net.VsPackage.ToolWindows.BasicList
                 return;
             }
             var memory = MachineViewModel.SpectrumVm.MemoryDevice.CloneMemory();
-            var prog = SystemVariables.Get("PROG")?.Address;
-            if (prog == null) return;
-            var progStart = (ushort)(memory[(ushort)prog] + memory[(ushort)(prog + 1)] * 0x100);
-            var vars = SystemVariables.Get("VARS")?.Address;
-            if (vars == null) return;
-            var progEnd = (ushort)(memory[(ushort)vars] + memory[(ushort)(vars + 1)] * 0x100);
-            List = new BasicListViewModel(memory, progStart, progEnd);
+            if (!BasicProgramDecoder.TryGetProgramBounds(memory, out var progStart, out var progEnd)) return;
+
+            // --- The listing is kept, so unchanged lines are not decoded again
+            if (_listing == null)
+            {
+                _listing = new BasicListing(BasicListViewModel.CreateDecoder(MachineViewModel.SpectrumVm));
+            }
+            List = new BasicListViewModel(memory, progStart, progEnd, _listing);
             List.DecodeBasicProgram();
         }
     }
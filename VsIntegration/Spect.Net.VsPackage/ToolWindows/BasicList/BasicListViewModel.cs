@@ -1,6 +1,7 @@
 ﻿using System.Collections.Generic;
 using System.Collections.ObjectModel;
-using System.Text;
+using Spect.Net.SpectrumEmu.Abstraction.Devices;
+using Spect.Net.SpectrumEmu.Basic;
 using Spect.Net.SpectrumEmu.Devices.Rom;
 
 namespace Spect.Net.VsPackage.ToolWindows.BasicList
@@ -10,7 +11,7 @@ namespace Spect.Net.VsPackage.ToolWindows.BasicList
     /// </summary>
     public class BasicListViewModel: SpectrumGenericToolWindowViewModel
     {
-        private readonly List<string> _tokens;
+        private readonly BasicListing _listing;
 
         /// <summary>
         /// The memory address to decode the basic listing from
@@ -54,110 +55,53 @@ namespace Spect.Net.VsPackage.ToolWindows.BasicList
         /// <param name="memory">Memory array</param>
         /// <param name="startOffset">Start offset of the BASIC code</param>
         /// <param name="endOffset">End offset of the BASIC Code (exclusive)</param>
-        public BasicListViewModel(byte[] memory, ushort startOffset, ushort endOffset): this()
+        /// <param name="listing">
+        /// Listing to refresh; lines that did not change since its last refresh
+        /// are not decoded again
+        /// </param>
+        public BasicListViewModel(byte[] memory, ushort startOffset, ushort endOffset,
+            BasicListing listing = null): this()
         {
-            var romDevice = MachineViewModel?.SpectrumVm?.RomDevice;
-            if (romDevice != null)
-            {
-                romDevice.GetProperty<List<string>>(SpectrumRomDevice.TOKEN_TABLE_KEY, out var tokenList,
-                    romDevice.HostVm.RomConfiguration.Spectrum48RomIndex);
-                {
-                    _tokens = tokenList;
-                }
-            }
+            _listing = listing ?? new BasicListing(CreateDecoder(MachineViewModel?.SpectrumVm));
             Memory = memory;
             StartOffset = startOffset;
             EndOffset = endOffset;
         }
 
         /// <summary>
-        /// Decodes the BASIC program in the memory
+        /// Creates a BASIC decoder that uses the token table of the machine's ROM
         /// </summary>
-        public void DecodeBasicProgram()
+        /// <param name="spectrumVm">Virtual machine; null to use the default tokens</param>
+        public static BasicProgramDecoder CreateDecoder(ISpectrumVm spectrumVm)
         {
-            var progStart = StartOffset;
-            var progEnd = EndOffset;
-
-            if (progStart == 0 || progEnd == 0) return;
-
-            while (progStart < progEnd)
+            var romDevice = spectrumVm?.RomDevice;
+            if (romDevice != null 
+                && romDevice.GetProperty<List<string>>(SpectrumRomDevice.TOKEN_TABLE_KEY, out var tokenList,
+                    romDevice.HostVm.RomConfiguration.Spectrum48RomIndex))
             {
-                progStart = GetBasicLine(progStart, out BasicLineViewModel line);
-                ProgramLines.Add(line);
+                return new BasicProgramDecoder(tokenList);
             }
+            return new BasicProgramDecoder();
         }
 
         /// <summary>
-        /// Gets the specified BASIC code line
+        /// Decodes the BASIC program in the memory
         /// </summary>
-        /// <param name="progStart">Code line address in the memory</param>
-        /// <param name="lineVm">BASIC line view model</param>
-        /// <returns></returns>
-        public ushort GetBasicLine(ushort progStart, out BasicLineViewModel lineVm)
+        public void DecodeBasicProgram()
         {
-            lineVm = new BasicLineViewModel
+            _listing.Refresh(Memory, StartOffset, EndOffset);
+            for (var i = 0; i < _listing.Lines.Count; i++)
             {
-                LineNo = Memory[progStart++] * 0x100 + Memory[progStart++],
-                Length = Memory[progStart++] + Memory[progStart++] * 0x100
-            };
-            var lineEnd = progStart + lineVm.Length;
-            if (lineEnd > Memory.Length - 1)
-            {
-                lineEnd = Memory.Length - 1;
-            }
+                var line = _listing.Lines[i];
+                var index = i;
 
-            var spaceBeforeToken = false;
-            var sb = new StringBuilder(256);
-
-            while (progStart < lineEnd)
-            {
-                var nextSymbol = Memory[progStart++];
-                if (nextSymbol >= 0xA5)
-                {
-                    // --- This is a token
-                    if (spaceBeforeToken)
-                    {
-                        sb.Append(" ");
-                    }
-                    var tokenCode = nextSymbol - 0xA5;
-                    var token = _tokens[tokenCode];
-                    sb.Append(token);
-                    if (tokenCode > 2 && char.IsLetter(token[token.Length - 1]))
-                    {
-                        sb.Append(" ");
-                        spaceBeforeToken = false;
-                    }
-                    continue;
-                }
-
-                // --- Whatever we print, the next token needs a space
-                spaceBeforeToken = true;
-
-                if (nextSymbol >= 0x20 && nextSymbol <= 0x7F)
+                // --- The ListBox is virtualized, so only the visible lines get formatted
+                ProgramLines.Add(new BasicLineViewModel(() => _listing.GetText(index))
                 {
-                    // --- Printable character
-                    sb.Append((char)nextSymbol);
-                    continue;
-                }
-
-                if (nextSymbol == 0x0D)
-                {
-                    continue;
-                }
-
-                if (nextSymbol == 0x0E)
-                {
-                    // --- Skip the binary form of a floating point number
-                    progStart += 5;
-                    continue;
-                }
-
-                // --- Non-printable character, let's display it with an escape sequence
-                sb.Append($"°{nextSymbol:X2}°");
+                    LineNo = line.LineNo,
+                    Length = line.Length
+                });
             }
-
-            lineVm.Text = sb.ToString();
-            return progStart;
         }
     }
 }
\ No newline at end of file
@@ -9,6 +9,7 @@ using Spect.Net.CommandParser.SyntaxTree;
 using Spect.Net.EvalParser;
 using Spect.Net.EvalParser.Generated;
 using Spect.Net.EvalParser.SyntaxTree;
+using Spect.Net.SpectrumEmu.Abstraction.Devices;
 using Spect.Net.SpectrumEmu.Disassembler;
 using Spect.Net.SpectrumEmu.Machine;
 using Spect.Net.VsPackage.Z80Programs.Debugging;
@@ -24,8 +25,15 @@ namespace Spect.Net.VsPackage.ToolWindows.Disassembly
 {
     public class DisassemblyToolWindowViewModel: BankAwareToolWindowViewModelBase, IDisassemblyItemParent
     {
+        /// <summary>
+        /// Decode cache keys of ROM pages start from this value, so that they
+        /// differ from the RAM bank keys
+        /// </summary>
+        private const int ROM_BANK_KEY = 0x100;
+
         private bool _tapeDeviceAttached;
         private ObservableCollection<DisassemblyItemViewModel> _disassemblyItems;
+        private DisassemblyDecodeCache _decodeCache;
 
         /// <summary>
         /// The disassembly items belonging to this project
@@ -600,6 +608,7 @@ namespace Spect.Net.VsPackage.ToolWindows.Disassembly
             var map = new MemoryMap();
 
             byte[] memory;
+            int[] bankKeys;
             if (RomViewMode)
             {
                 if (AnnotationHandler.RomPageAnnotations.TryGetValue(RomIndex, out var romAnn))
@@ -608,6 +617,7 @@ namespace Spect.Net.VsPackage.ToolWindows.Disassembly
                     disassemblyFlags[0] = romAnn.DisassemblyFlags;
                 }
                 memory = memoryDevice.GetRomBuffer(RomIndex);
+                bankKeys = new[] { ROM_BANK_KEY + RomIndex };
             }
             else if (RamBankViewMode)
             {
@@ -616,10 +626,13 @@ namespace Spect.Net.VsPackage.ToolWindows.Disassembly
                 map = ramAnn.MemoryMap;
                 memory = memoryDevice.GetRamBank(RamBankIndex);
                 disassemblyFlags[0] = ramAnn.DisassemblyFlags;
+                bankKeys = new[] { RamBankIndex };
             }
             else
             {
                 // --- We are in FullViewMode
+                memory = memoryDevice.CloneMemory();
+                MemoryMap discovered = null;
                 var currentRom = memoryDevice.GetSelectedRomIndex();
                 if (AnnotationHandler.RomPageAnnotations.TryGetValue(currentRom, out var fullAnn))
                 {
@@ -632,10 +645,12 @@ namespace Spect.Net.VsPackage.ToolWindows.Disassembly
                 }
 
                 // --- Merge the maps of the paged banks with the ROM maps  
+                bankKeys = new[] { ROM_BANK_KEY + currentRom, 1, 2, 3 };
                 if (memoryConfig.SupportsBanking)
                 {
                     for (var i = 1; i <= 3; i++)
                     {
+                        bankKeys[i] = memoryDevice.GetSelectedBankIndex(i);
                         if (AnnotationHandler.RamBankAnnotations.TryGetValue(
                             memoryDevice.GetSelectedBankIndex(i), out var ramAnn))
                         {
@@ -644,12 +659,10 @@ namespace Spect.Net.VsPackage.ToolWindows.Disassembly
                         }
                         else
                         {
-                            map.Merge(new MemoryMap
-                            {
-                                new MemorySection(0, 
-                                    0x3FFF, 
-                                    MemorySectionType.ByteArray)
-                            }, (ushort)(i * 0x4000));
+                            // --- Tell code from data by following the code flow
+                            MergeDiscoveredSections(map, ref discovered, memory, 
+                                (ushort)(i * 0x4000), 
+                                (ushort)(i * 0x4000 + 0x3FFF));
                         }
                     }
                 }
@@ -663,22 +676,57 @@ namespace Spect.Net.VsPackage.ToolWindows.Disassembly
                     }
                     else
                     {
-                        map.Merge(new MemoryMap
-                        {
-                            new MemorySection(0x4000, 0xFFFF, MemorySectionType.ByteArray)
-                        });
+                        MergeDiscoveredSections(map, ref discovered, memory, 0x4000, 0xFFFF);
                     }
                 }
-                memory = memoryDevice.CloneMemory();
             }
 
             var disassembler = new Z80Disassembler(map, 
                 memory, 
                 disassemblyFlags,
-                MachineViewModel.SpectrumVm.Cpu.AllowExtendedInstructionSet);
+                MachineViewModel.SpectrumVm.Cpu.AllowExtendedInstructionSet)
+            {
+                DecodeCache = _decodeCache,
+                BankKeys = bankKeys
+            };
             return disassembler;
         }
 
+        /// <summary>
+        /// Merges the discovered code and data sections of the specified 
+        /// range into the memory map
+        /// </summary>
+        /// <param name="map">Memory map to merge the sections into</param>
+        /// <param name="discovered">
+        /// The result of code discovery. It is analyzed on first use.
+        /// </param>
+        /// <param name="memory">Memory contents</param>
+        /// <param name="startAddress">Start address of the range</param>
+        /// <param name="endAddress">End address of the range</param>
+        private void MergeDiscoveredSections(MemoryMap map, ref MemoryMap discovered, byte[] memory,
+            ushort startAddress, ushort endAddress)
+        {
+            if (discovered == null)
+            {
+                // --- Start from the current PC, and use the addresses executed since reset
+                var cpu = MachineViewModel.SpectrumVm.Cpu;
+                var analyzer = new CodeFlowAnalyzer(memory, extendedSet: cpu.AllowExtendedInstructionSet)
+                {
+                    ExecutionCoverage = (cpu as IZ80CpuTestSupport)?.ExecutionFlowStatus
+                };
+                discovered = analyzer.Analyze(new[] { cpu.Registers.PC }, 0x4000);
+            }
+
+            var range = new MemorySection(startAddress, endAddress);
+            foreach (var section in discovered)
+            {
+                var part = section.Intersect(range);
+                if (part == null) continue;
+                part.SectionType = section.SectionType;
+                map.Add(part);
+            }
+        }
+
         /// <summary>
         /// Initializes disassembly items and annotations
         /// </summary>
@@ -686,6 +734,7 @@ namespace Spect.Net.VsPackage.ToolWindows.Disassembly
         {
             DisassemblyItems = new ObservableCollection<DisassemblyItemViewModel>();
             LineIndexes = new Dictionary<ushort, int>();
+            _decodeCache = new DisassemblyDecodeCache();
             AnnotationHandler = new DisassemblyAnnotationHandler(this);
         }
 
@@ -34,6 +34,16 @@ namespace Spect.Net.VsPackage.ToolWindows.Memory
             _byteControls.Add(ByteF);
             Loaded += OnLoaded;
             Unloaded += OnUnloaded;
+            DataContextChanged += OnDataContextChanged;
+        }
+
+        /// <summary>
+        /// Only the displayed lines are bound to the memory
+        /// </summary>
+        private void OnDataContextChanged(object sender, DependencyPropertyChangedEventArgs e)
+        {
+            (e.OldValue as MemoryLineViewModel)?.Release();
+            (e.NewValue as MemoryLineViewModel)?.EnsureBound();
         }
 
         private void OnLoaded(object sender, RoutedEventArgs e)
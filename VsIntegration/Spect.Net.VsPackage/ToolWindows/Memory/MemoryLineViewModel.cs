@@ -5,7 +5,7 @@ using System.Reflection;
 using System.Text;
 using System.Text.RegularExpressions;
 using System.Windows.Media;
-using Spect.Net.SpectrumEmu.Cpu;
+using Spect.Net.SpectrumEmu.Abstraction.Devices;
 using Spect.Net.VsPackage.Utility;
 using Spect.Net.Wpf.Mvvm;
 
@@ -28,8 +28,9 @@ namespace Spect.Net.VsPackage.ToolWindows.Memory
         private static Brush s_SpBrush;
         private static Brush s_PcBrush;
 
-        private readonly Registers _regs;
+        private readonly IZ80Cpu _cpu;
         private BankAwareToolWindowViewModelBase _bankViewModel;
+        private MemoryViewDataSource _dataSource;
         private string _addr1;
         private string _value0;
         private string _value1;
@@ -109,6 +110,11 @@ namespace Spect.Net.VsPackage.ToolWindows.Memory
         /// </summary>
         public int TopAddress { get; }
 
+        /// <summary>
+        /// Indicates if the line displays the current memory contents
+        /// </summary>
+        public bool IsBound { get; private set; }
+
         public string Addr1
         {
             get => _addr1;
@@ -552,12 +558,12 @@ namespace Spect.Net.VsPackage.ToolWindows.Memory
         /// <summary>
         /// Creates a memory line with the specified base address and top address
         /// </summary>
-        /// <param name="regs">Z80 register current values</param>
+        /// <param name="cpu">Z80 CPU with the current register values</param>
         /// <param name="baseAddr">Memory base address</param>
         /// <param name="topAddress">Memory top address</param>
-        public MemoryLineViewModel(Registers regs, int baseAddr, int topAddress = 0xFFFF)
+        public MemoryLineViewModel(IZ80Cpu cpu, int baseAddr, int topAddress = 0xFFFF)
         {
-            _regs = regs;
+            _cpu = cpu;
             BaseAddress = baseAddr;
             TopAddress = topAddress;
         }
@@ -570,6 +576,7 @@ namespace Spect.Net.VsPackage.ToolWindows.Memory
         public void BindTo(byte[] memory, BankAwareToolWindowViewModelBase bankViewModel = null)
         {
             _bankViewModel = bankViewModel;
+            IsBound = true;
             Addr1 = BaseAddress.AsHexWord();
             Dump1 = DumpValue(memory, BaseAddress);
             Value0 = GetByte(memory, 0);
@@ -647,18 +654,61 @@ namespace Spect.Net.VsPackage.ToolWindows.Memory
             }
         }
 
+        /// <summary>
+        /// Assigns this memory line to the specified data source. The line is
+        /// bound to the memory only when it is displayed.
+        /// </summary>
+        /// <param name="dataSource">Memory view data source</param>
+        /// <param name="bankViewModel">Optional view model to set symbol border</param>
+        public void BindLazily(MemoryViewDataSource dataSource, 
+            BankAwareToolWindowViewModelBase bankViewModel = null)
+        {
+            _dataSource = dataSource;
+            _bankViewModel = bankViewModel;
+            IsBound = false;
+        }
+
+        /// <summary>
+        /// Binds the line to the memory of its data source, unless it is 
+        /// already bound
+        /// </summary>
+        public void EnsureBound()
+        {
+            if (IsBound || _dataSource?.Memory == null) return;
+            BindTo(_dataSource.Memory, _bankViewModel);
+        }
+
+        /// <summary>
+        /// Rebinds the line to the memory of its data source, provided it is bound
+        /// </summary>
+        public void Rebind()
+        {
+            if (!IsBound || _dataSource?.Memory == null) return;
+            BindTo(_dataSource.Memory, _bankViewModel);
+        }
+
+        /// <summary>
+        /// Signs that the line is not displayed anymore, so it need not follow
+        /// the memory changes
+        /// </summary>
+        public void Release()
+        {
+            IsBound = false;
+        }
+
         public List<string> GetAffectedRegisters(int address)
         {
             var result = new List<string>();
-            if (_regs != null)
+            if (_cpu != null)
             {
-                if (_regs.BC == address) result.Add("BC");
-                if (_regs.DE == address) result.Add("DE");
-                if (_regs.HL == address) result.Add("HL");
-                if (_regs.IX == address) result.Add("IX");
-                if (_regs.IY == address) result.Add("IY");
-                if (_regs.PC == address) result.Add("PC");
-                if (_regs.SP == address) result.Add("SP");
+                ref var regs = ref _cpu.Registers;
+                if (regs.BC == address) result.Add("BC");
+                if (regs.DE == address) result.Add("DE");
+                if (regs.HL == address) result.Add("HL");
+                if (regs.IX == address) result.Add("IX");
+                if (regs.IY == address) result.Add("IY");
+                if (regs.PC == address) result.Add("PC");
+                if (regs.SP == address) result.Add("SP");
             }
             return result;
         }
@@ -749,16 +799,17 @@ namespace Spect.Net.VsPackage.ToolWindows.Memory
 
         private Brush GetBrush(int offset)
         {
-            if (_regs != null)
+            if (_cpu != null)
             {
+                ref var regs = ref _cpu.Registers;
                 var addr = BaseAddress + offset;
-                if (_regs.BC == addr) return s_BcBrush;
-                if (_regs.DE == addr) return s_DeBrush;
-                if (_regs.HL == addr) return s_HlBrush;
-                if (_regs.IX == addr) return s_IxBrush;
-                if (_regs.IY == addr) return s_IyBrush;
-                if (_regs.PC == addr) return s_PcBrush;
-                if (_regs.SP == addr) return s_SpBrush;
+                if (regs.BC == addr) return s_BcBrush;
+                if (regs.DE == addr) return s_DeBrush;
+                if (regs.HL == addr) return s_HlBrush;
+                if (regs.IX == addr) return s_IxBrush;
+                if (regs.IY == addr) return s_IyBrush;
+                if (regs.PC == addr) return s_PcBrush;
+                if (regs.SP == addr) return s_SpBrush;
             }
             return Brushes.Transparent;
         }
@@ -0,0 +1,22 @@
+﻿using System;
+using System.Collections.Generic;
+
+namespace Spect.Net.VsPackage.ToolWindows.Memory
+{
+    /// <summary>
+    /// These event arguments tell the memory lines that have changed
+    /// since the last refresh
+    /// </summary>
+    public class MemoryLinesChangedEventArgs: EventArgs
+    {
+        /// <summary>
+        /// The indexes of the changed lines in ascending order
+        /// </summary>
+        public IReadOnlyList<int> LineIndexes { get; }
+
+        public MemoryLinesChangedEventArgs(IReadOnlyList<int> lineIndexes)
+        {
+            LineIndexes = lineIndexes;
+        }
+    }
+}
@@ -85,7 +85,7 @@ namespace Spect.Net.VsPackage.ToolWindows.Memory
             {
                 DispatchOnUiThread(() =>
                 {
-                    RefreshVisibleItems();
+                    Vm.RefreshChangedLines();
                     if (Vm.FullViewMode)
                     {
                         Vm.UpdatePageInformation();
@@ -112,22 +112,6 @@ namespace Spect.Net.VsPackage.ToolWindows.Memory
             }
         }
 
-        /// <summary>
-        /// This method refreshes only those memory items that are visible in the 
-        /// current viewport
-        /// </summary>
-        private void RefreshVisibleItems()
-        {
-            var stack = MemoryDumpListBox.GetInnerStackPanel();
-            for (var i = 0; i < stack.Children.Count; i++)
-            {
-                if ((stack.Children[i] as FrameworkElement)?.DataContext is MemoryLineViewModel memLine)
-                {
-                    Vm.RefreshItemIfItMayChange((ushort)memLine.BaseAddress);
-                }
-            }
-        }
-
         /// <summary>
         /// Scrolls the disassembly item with the specified address into view
         /// </summary>
@@ -1,7 +1,7 @@
 ﻿using System.Collections.ObjectModel;
 using System.IO;
 using Spect.Net.CommandParser.SyntaxTree;
-using Spect.Net.SpectrumEmu.Cpu;
+using Spect.Net.SpectrumEmu.Abstraction.Devices;
 using Spect.Net.SpectrumEmu.Machine;
 using Spect.Net.VsPackage.Z80Programs.ExportMemory;
 
@@ -14,9 +14,16 @@ namespace Spect.Net.VsPackage.ToolWindows.Memory
     /// </summary>
     public class MemoryToolWindowViewModel : BankAwareToolWindowViewModelBase
     {
+        private IZ80Cpu _lineCpu;
+
         public ObservableCollection<MemoryLineViewModel> MemoryLines { get; } =
             new ObservableCollection<MemoryLineViewModel>();
 
+        /// <summary>
+        /// The data source that tells the changed memory lines
+        /// </summary>
+        public MemoryViewDataSource DataSource { get; } = new MemoryViewDataSource();
+
         /// <summary>
         /// Instantiates this view model
         /// </summary>
@@ -60,41 +67,64 @@ namespace Spect.Net.VsPackage.ToolWindows.Memory
         /// <param name="addr">Address of the memory line</param>
         public override void RefreshItem(int addr)
         {
+            var lineNo = addr >> 4;
             var memory = GetMemoryBuffer();
-            var length = GetMemoryLength();
-            if (memory == null || length == null) return;
+            if (memory == null || lineNo < 0 || lineNo >= MemoryLines.Count) return;
 
-            if (addr < 0 || addr >= length) return;
+            DataSource.Refresh(memory);
+            MemoryLines[lineNo].Rebind();
+        }
 
-            Registers regs = null;
-            if (MachineViewModel != null)
+        /// <summary>
+        /// Refreshes all displayed memory lines
+        /// </summary>
+        /// <remarks>
+        /// Register and symbol marks may change even if the memory does not,
+        /// so every displayed line is refreshed. Lines not displayed are bound
+        /// when they get into the view.
+        /// </remarks>
+        public override void RefreshViewMode()
+        {
+            if (GetCurrentCpu() != _lineCpu)
             {
-                if (MachineViewModel.MachineState != VmState.None && MachineViewModel.MachineState != VmState.Stopped)
-                {
-                    regs = MachineViewModel.SpectrumVm.Cpu.Registers;
-                }
+                InitViewMode();
+                return;
             }
-            var memLine = new MemoryLineViewModel(regs, addr);
-            memLine.BindTo(memory, this);
-            var lineNo = addr >> 4;
-            if (lineNo < MemoryLines.Count)
+            var memory = GetMemoryBuffer();
+            if (memory == null) return;
+
+            DataSource.Refresh(memory);
+            foreach (var line in MemoryLines)
             {
-                MemoryLines[lineNo] = memLine;
+                line.Rebind();
             }
         }
 
         /// <summary>
-        /// Refreshes all memory lines
+        /// Refreshes the displayed memory lines that have changed since the
+        /// last refresh
         /// </summary>
-        public override void RefreshViewMode()
+        public void RefreshChangedLines()
         {
+            // --- ROM items never change
+            if (RomViewMode) return;
+
+            if (RamBankViewMode 
+                && !MachineViewModel.SpectrumVm.MemoryDevice.IsRamBankPagedIn(RamBankIndex, out _))
+            {
+                // --- The current RAM bank is not paged in, so it may not change
+                return;
+            }
+
             var memory = GetMemoryBuffer();
-            var length = GetMemoryLength();
-            if (memory == null || length == null) return;
+            if (memory == null) return;
 
-            for (var addr = 0x0000; addr < length; addr += 16)
+            foreach (var lineNo in DataSource.Refresh(memory))
             {
-                RefreshItem((ushort)addr);
+                if (lineNo < MemoryLines.Count)
+                {
+                    MemoryLines[lineNo].Rebind();
+                }
             }
         }
 
@@ -252,22 +282,32 @@ namespace Spect.Net.VsPackage.ToolWindows.Memory
             if (memory == null || length == null) return;
 
             MemoryLines.Clear();
-            Registers regs = null;
-            if (MachineViewModel != null)
-            {
-                if (MachineViewModel.MachineState != VmState.None && MachineViewModel.MachineState != VmState.Stopped)
-                {
-                    regs = MachineViewModel.SpectrumVm.Cpu.Registers;
-                }
-            }
+            DataSource.Bind(memory, length.Value);
+            _lineCpu = GetCurrentCpu();
             for (var i = 0; i < length; i+= 16)
             {
-                var line = new MemoryLineViewModel(regs, (ushort)i);
-                line.BindTo(memory, this);
+                // --- Lines are bound to the memory when displayed
+                var line = new MemoryLineViewModel(_lineCpu, (ushort)i);
+                line.BindLazily(DataSource, this);
                 MemoryLines.Add(line);
             }
         }
 
+        /// <summary>
+        /// Gets the CPU with the registers to mark in the memory lines
+        /// </summary>
+        /// <returns>The CPU, if the machine runs or paused; otherwise, null</returns>
+        private IZ80Cpu GetCurrentCpu()
+        {
+            if (MachineViewModel == null
+                || MachineViewModel.MachineState == VmState.None 
+                || MachineViewModel.MachineState == VmState.Stopped)
+            {
+                return null;
+            }
+            return MachineViewModel.SpectrumVm.Cpu;
+        }
+
         /// <summary>
         /// Displays the Export Disassembly dialog to collect parameter data
         /// </summary>
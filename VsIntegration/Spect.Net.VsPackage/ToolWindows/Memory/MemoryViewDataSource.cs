@@ -0,0 +1,104 @@
+﻿using System;
+using System.Collections.Generic;
+
+namespace Spect.Net.VsPackage.ToolWindows.Memory
+{
+    /// <summary>
+    /// This class provides the lines of the memory view, and tells which
+    /// lines have changed since the last refresh.
+    /// </summary>
+    /// <remarks>
+    /// The data source keeps a shadow copy of the memory contents shown the
+    /// last time. A refresh compares the current contents with this copy, so
+    /// it finds every change, independently of whether the CPU, the tape
+    /// loader or a debugger command has written the memory. The data source
+    /// does not depend on WPF, so it can be tested without a UI.
+    /// </remarks>
+    public class MemoryViewDataSource
+    {
+        /// <summary>
+        /// Number of bytes displayed in a memory line
+        /// </summary>
+        public const int BYTES_PER_LINE = 16;
+
+        private static readonly int[] s_NoLines = new int[0];
+
+        private byte[] _shadow = new byte[0];
+        private readonly List<int> _changedLines = new List<int>();
+
+        /// <summary>
+        /// The memory buffer the lines are read from
+        /// </summary>
+        public byte[] Memory { get; private set; }
+
+        /// <summary>
+        /// The number of bytes shown
+        /// </summary>
+        public int Length { get; private set; }
+
+        /// <summary>
+        /// The number of memory lines
+        /// </summary>
+        public int LineCount => (Length + BYTES_PER_LINE - 1) / BYTES_PER_LINE;
+
+        /// <summary>
+        /// This event is raised when a refresh finds changed lines
+        /// </summary>
+        public event EventHandler<MemoryLinesChangedEventArgs> LinesChanged;
+
+        /// <summary>
+        /// Binds the data source to the specified memory buffer
+        /// </summary>
+        /// <param name="memory">Memory buffer</param>
+        /// <param name="length">Number of bytes to show</param>
+        public void Bind(byte[] memory, int length)
+        {
+            Memory = memory;
+            Length = memory == null ? 0 : Math.Min(length, memory.Length);
+            if (_shadow.Length != Length)
+            {
+                _shadow = new byte[Length];
+            }
+            if (Length > 0)
+            {
+                Buffer.BlockCopy(memory, 0, _shadow, 0, Length);
+            }
+        }
+
+        /// <summary>
+        /// Compares the memory contents with the contents shown the last time
+        /// </summary>
+        /// <param name="memory">
+        /// The new memory buffer, or null to use the currently bound buffer
+        /// </param>
+        /// <returns>The indexes of the changed lines in ascending order</returns>
+        public IReadOnlyList<int> Refresh(byte[] memory = null)
+        {
+            if (memory != null)
+            {
+                Memory = memory;
+            }
+            if (Memory == null || Memory.Length < Length) return s_NoLines;
+
+            _changedLines.Clear();
+            for (var lineStart = 0; lineStart < Length; lineStart += BYTES_PER_LINE)
+            {
+                var lineEnd = Math.Min(lineStart + BYTES_PER_LINE, Length);
+                for (var addr = lineStart; addr < lineEnd; addr++)
+                {
+                    if (Memory[addr] == _shadow[addr]) continue;
+
+                    // --- The line has changed, save its new contents
+                    _changedLines.Add(lineStart / BYTES_PER_LINE);
+                    Buffer.BlockCopy(Memory, lineStart, _shadow, lineStart, lineEnd - lineStart);
+                    break;
+                }
+            }
+            if (_changedLines.Count == 0) return s_NoLines;
+
+            var changed = _changedLines.ToArray();
+            LinesChanged?.Invoke(this, new MemoryLinesChangedEventArgs(changed));
+            return changed;
+        }
+    }
+}
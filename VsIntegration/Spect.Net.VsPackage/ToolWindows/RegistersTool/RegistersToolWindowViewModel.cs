@@ -261,7 +261,7 @@ namespace Spect.Net.VsPackage.ToolWindows.RegistersTool
 
             // --- Register values
             var cpu = spectrumVm.Cpu;
-            var regs = cpu.Registers;
+            var regs = cpu.GetRegisters();
             AF = regs.AF;
             F = regs.F;
             BC = regs.BC;
@@ -140,6 +140,17 @@ namespace Spect.Net.VsPackage.ToolWindows.SpectrumEmulator
         /// </summary>
         public bool FastTapeMode { get; set; }
 
+        /// <summary>
+        /// Gets the flag that indicates if fast disk mode is allowed
+        /// </summary>
+        public bool FastDiskMode { get; set; }
+
+        /// <summary>
+        /// Signs if the machine runs with a multiplied CPU clock, so the
+        /// screen should be rendered in turbo mode
+        /// </summary>
+        public bool TurboMode => Machine.SpectrumVm.ClockMultiplier > 1;
+
         /// <summary>
         /// Signs if the instructions within the maskable interrupt 
         /// routine should be skipped
@@ -221,7 +232,8 @@ namespace Spect.Net.VsPackage.ToolWindows.SpectrumEmulator
         public void Start()
         {
             RunsInDebugMode = false;
-            Machine.Start(new ExecuteCycleOptions(fastTapeMode: FastTapeMode));
+            Machine.Start(new ExecuteCycleOptions(fastTapeMode: FastTapeMode, turboMode: TurboMode,
+                fastDiskMode: FastDiskMode));
         }
 
         /// <summary>
@@ -299,7 +311,9 @@ namespace Spect.Net.VsPackage.ToolWindows.SpectrumEmulator
             RunsInDebugMode = true;
             Machine.Start(new ExecuteCycleOptions(EmulationMode.Debugger, 
                 fastTapeMode: FastTapeMode,
-                skipInterruptRoutine: SkipInterruptRoutine));
+                skipInterruptRoutine: SkipInterruptRoutine,
+                turboMode: TurboMode,
+                fastDiskMode: FastDiskMode));
         }
 
         /// <summary>
@@ -312,7 +326,9 @@ namespace Spect.Net.VsPackage.ToolWindows.SpectrumEmulator
             RunsInDebugMode = true;
             Machine.Start(new ExecuteCycleOptions(EmulationMode.Debugger,
                 DebugStepMode.StepInto, FastTapeMode,
-                    skipInterruptRoutine: SkipInterruptRoutine));
+                    skipInterruptRoutine: SkipInterruptRoutine,
+                    turboMode: TurboMode,
+                    fastDiskMode: FastDiskMode));
         }
 
         /// <summary>
@@ -325,7 +341,9 @@ namespace Spect.Net.VsPackage.ToolWindows.SpectrumEmulator
             RunsInDebugMode = true;
             Machine.Start(new ExecuteCycleOptions(EmulationMode.Debugger,
                     DebugStepMode.StepOver, FastTapeMode,
-                    skipInterruptRoutine: SkipInterruptRoutine));
+                    skipInterruptRoutine: SkipInterruptRoutine,
+                    turboMode: TurboMode,
+                    fastDiskMode: FastDiskMode));
         }
 
         /// <summary>
@@ -338,7 +356,9 @@ namespace Spect.Net.VsPackage.ToolWindows.SpectrumEmulator
             RunsInDebugMode = true;
             Machine.Start(new ExecuteCycleOptions(EmulationMode.Debugger,
                 DebugStepMode.StepOut, FastTapeMode,
-                skipInterruptRoutine: SkipInterruptRoutine));
+                skipInterruptRoutine: SkipInterruptRoutine,
+                turboMode: TurboMode,
+                fastDiskMode: FastDiskMode));
         }
 
         #endregion
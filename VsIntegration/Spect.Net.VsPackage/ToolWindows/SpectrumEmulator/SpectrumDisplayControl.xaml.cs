@@ -1,5 +1,5 @@
 ﻿using System;
-using System.Threading.Tasks;
+using System.Threading;
 using System.Windows;
 using System.Windows.Media;
 using System.Windows.Media.Imaging;
@@ -29,7 +29,8 @@ namespace Spect.Net.VsPackage.ToolWindows.SpectrumEmulator
         private WriteableBitmap _bitmap;
         private bool _isReloaded;
         private readonly DispatcherTimer _dispatchTimer;
-        private byte[] _lastBuffer;
+        private ScreenPresentationSurface _surface;
+        private int _refreshPending;
 
         /// <summary>
         /// The ZX Spectrum virtual machine view model utilized by this user control
@@ -47,7 +48,6 @@ namespace Spect.Net.VsPackage.ToolWindows.SpectrumEmulator
                 DispatcherPriority.Normal,
                 OnDispatchTimer, Dispatcher);
             _dispatchTimer.Stop();
-            _lastBuffer = null;
         }
 
         /// <summary>
@@ -71,6 +71,7 @@ namespace Spect.Net.VsPackage.ToolWindows.SpectrumEmulator
                     96,
                     PixelFormats.Bgr32,
                     null);
+                _surface = new ScreenPresentationSurface(_displayPars.ScreenWidth, _displayPars.ScreenLines);
             }
             Display.Source = _bitmap;
             Display.Width = _displayPars.ScreenWidth;
@@ -80,8 +81,9 @@ namespace Spect.Net.VsPackage.ToolWindows.SpectrumEmulator
             // --- When the control is reloaded, resume playing the sound
             if (_isReloaded && Vm.MachineState == VmState.Running)
             {
-                Vm.SpectrumVm.BeeperProvider.PlaySound();
+                Vm.SpectrumVm.BeeperProvider?.PlaySound();
                 Vm.SpectrumVm.SoundProvider?.PlaySound();
+                Vm.SpectrumVm.AudioMixerProvider?.PlaySound();
             }
             Vm.VmScreenRefreshed += OnVmScreenRefreshed;
             ResizeFor(ActualWidth, ActualHeight);
@@ -94,6 +96,7 @@ namespace Spect.Net.VsPackage.ToolWindows.SpectrumEmulator
         {
             Vm?.SpectrumVm.BeeperProvider?.PauseSound();
             Vm?.SpectrumVm.SoundProvider?.PauseSound();
+            Vm?.SpectrumVm.AudioMixerProvider?.PauseSound();
             if (Vm != null)
             {
                 Vm.VmScreenRefreshed += OnVmScreenRefreshed;
@@ -110,17 +113,20 @@ namespace Spect.Net.VsPackage.ToolWindows.SpectrumEmulator
                     {
                         case VmState.Stopped:
                             _dispatchTimer.Stop();
-                            Vm.SpectrumVm.BeeperProvider.KillSound();
+                            Vm.SpectrumVm.BeeperProvider?.KillSound();
                             Vm.SpectrumVm.SoundProvider?.KillSound();
+                            Vm.SpectrumVm.AudioMixerProvider?.KillSound();
                             break;
                         case VmState.Running:
                             _dispatchTimer.Stop();
-                            Vm.SpectrumVm.BeeperProvider.PlaySound();
+                            Vm.SpectrumVm.BeeperProvider?.PlaySound();
                             Vm.SpectrumVm.SoundProvider?.PlaySound();
+                            Vm.SpectrumVm.AudioMixerProvider?.PlaySound();
                             break;
                         case VmState.Paused:
-                            Vm.SpectrumVm.BeeperProvider.PauseSound();
+                            Vm.SpectrumVm.BeeperProvider?.PauseSound();
                             Vm.SpectrumVm.SoundProvider?.PauseSound();
+                            Vm.SpectrumVm.AudioMixerProvider?.PauseSound();
                             _dispatchTimer.Start();
                             break;
                     }
@@ -131,18 +137,29 @@ namespace Spect.Net.VsPackage.ToolWindows.SpectrumEmulator
         /// <summary>
         /// The new screen frame is ready, it is time to display it
         /// </summary>
+        /// <remarks>
+        /// The frame is converted on the emulation thread, so the UI thread only
+        /// copies the completed surface into the bitmap. The emulation thread
+        /// does not wait for the UI; when the UI falls behind, it displays the
+        /// most recent frame only.
+        /// </remarks>
         private void OnVmScreenRefreshed(object sender, VmScreenRefreshedEventArgs args)
         {
-            // --- Refresh the screen
-            Dispatcher.Invoke(() =>
+            var surface = _surface;
+            if (surface == null) return;
+            surface.Present(args.Buffer);
+
+            // --- Refresh the screen, unless a refresh is already waiting
+            if (Interlocked.Exchange(ref _refreshPending, 1) == 1) return;
+            Dispatcher.BeginInvoke((Action)(() =>
                 {
+                    Interlocked.Exchange(ref _refreshPending, 0);
                     lock (_dispatchTimer)
                     {
-                        _lastBuffer = args.Buffer;
-                        RefreshSpectrumScreen(_lastBuffer);
+                        RefreshSpectrumScreen();
                     }
                     Vm.SpectrumVm.KeyboardProvider.Scan(Vm.AllowKeyboardScan);
-                },
+                }),
                 DispatcherPriority.Send
             );
         }
@@ -176,32 +193,15 @@ namespace Spect.Net.VsPackage.ToolWindows.SpectrumEmulator
         }
 
         /// <summary>
-        /// Refreshes the spectrum screen
+        /// Refreshes the spectrum screen from the most recent completed frame
         /// </summary>
-        private void RefreshSpectrumScreen(byte[] currentBuffer)
+        private void RefreshSpectrumScreen()
         {
-            var width = _displayPars.ScreenWidth;
-            var height = _displayPars.ScreenLines;
-
-            _bitmap.Lock();
-            unsafe
-            {
-                var stride = _bitmap.BackBufferStride;
-                // Get a pointer to the back buffer.
-                var pBackBuffer = (int)_bitmap.BackBuffer;
-
-                for (var x = 0; x < width; x++)
-                {
-                    for (var y = 0; y < height; y++)
-                    {
-                        var addr = pBackBuffer + y * stride + x * 4;
-                        var pixelData = currentBuffer[y * width + x];
-                        *(uint*)addr = Spectrum48ScreenDevice.SpectrumColors[pixelData & 0x0F];
-                    }
-                }
-            }
-            _bitmap.AddDirtyRect(new Int32Rect(0, 0, width, height));
-            _bitmap.Unlock();
+            if (_surface == null || _surface.PresentedFrames == 0) return;
+            var width = _surface.Width;
+            var height = _surface.Height;
+            var pixels = _surface.AcquireFrame(out _);
+            _bitmap.WritePixels(new Int32Rect(0, 0, width, height), pixels, width * 4, 0);
         }
 
         /// <summary>
@@ -211,10 +211,7 @@ namespace Spect.Net.VsPackage.ToolWindows.SpectrumEmulator
         {
             lock (_dispatchTimer)
             {
-                if (_lastBuffer != null)
-                {
-                    RefreshSpectrumScreen(_lastBuffer);
-                }
+                RefreshSpectrumScreen();
             }
         }
     }
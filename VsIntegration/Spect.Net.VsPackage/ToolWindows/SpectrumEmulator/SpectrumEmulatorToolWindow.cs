@@ -68,6 +68,7 @@ namespace Spect.Net.VsPackage.ToolWindows.SpectrumEmulator
             if (state == VmState.None || state == VmState.Stopped)
             {
                 package.MachineViewModel.FastTapeMode = package.Options.UseFastLoad;
+                package.MachineViewModel.FastDiskMode = package.Options.UseFastDisk;
             }
             package.MachineViewModel.SkipInterruptRoutine = package.Options.SkipInterruptRoutine;
         }
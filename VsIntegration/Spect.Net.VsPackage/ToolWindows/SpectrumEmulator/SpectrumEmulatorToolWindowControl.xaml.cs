@@ -37,8 +37,9 @@ namespace Spect.Net.VsPackage.ToolWindows.SpectrumEmulator
                 Dispatcher.Invoke(() =>
 #pragma warning restore VSTHRD001 // Avoid legacy thread switching APIs
                 {
-                        SpectrumControl.Vm.SpectrumVm.BeeperProvider.KillSound();
+                        SpectrumControl.Vm.SpectrumVm.BeeperProvider?.KillSound();
                         SpectrumControl.Vm.SpectrumVm.SoundProvider?.KillSound();
+                        SpectrumControl.Vm.SpectrumVm.AudioMixerProvider?.KillSound();
                     },
                     DispatcherPriority.Normal);
             };
@@ -121,7 +121,7 @@ namespace Spect.Net.VsPackage.ToolWindows.StackTool
 
             var spectrumVm = MachineViewModel?.SpectrumVm;
             var memory = spectrumVm?.MemoryDevice;
-            var spValue = spectrumVm?.Cpu?.Registers?.SP;
+            var spValue = spectrumVm?.Cpu?.Registers.SP;
             if (memory == null || spValue == null)
             {
                 return;
@@ -726,7 +726,7 @@ namespace Spect.Net.VsPackage.ToolWindows.TestExplorer
         /// <param name="value">Value to assign</param>
         private void AssignRegisterValue(string regName, ushort value)
         {
-            var regs = Package.MachineViewModel.SpectrumVm.Cpu.Registers;
+            ref var regs = ref Package.MachineViewModel.SpectrumVm.Cpu.Registers;
             switch (regName.ToUpper())
             {
                 case "A": regs.A = (byte)value; break;
@@ -767,7 +767,7 @@ namespace Spect.Net.VsPackage.ToolWindows.TestExplorer
         /// <param name="flagName">Flag name (naming includes the value, too)</param>
         private void AssignFlagValue(string flagName)
         {
-            var regs = Package.MachineViewModel.SpectrumVm.Cpu.Registers;
+            ref var regs = ref Package.MachineViewModel.SpectrumVm.Cpu.Registers;
             switch (flagName.ToUpper())
             {
                 case "NZ": regs.F &= FlagsResetMask.Z; break;
@@ -1092,7 +1092,7 @@ namespace Spect.Net.VsPackage.ToolWindows.TestExplorer
         /// </returns>
         public ushort GetRegisterValue(string regName)
         {
-            var regs = Package.MachineViewModel.SpectrumVm.Cpu.Registers;
+            ref var regs = ref Package.MachineViewModel.SpectrumVm.Cpu.Registers;
             switch (regName.ToUpper())
             {
                 case "A": return regs.A;
@@ -36,6 +36,11 @@ namespace Spect.Net.VsPackage.ToolWindows.Watch
         /// </summary>
         public ExpressionNode ExpressionNode { get; set; }
 
+        /// <summary>
+        /// The ID of the expression in the watch engine (0, if not registered)
+        /// </summary>
+        public int WatchId { get; set; }
+
         /// <summary>
         /// Watch expression to evaluate
         /// </summary>
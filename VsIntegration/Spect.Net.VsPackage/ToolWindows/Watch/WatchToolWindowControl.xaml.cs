@@ -1,5 +1,7 @@
 ﻿using System.Windows;
 using System.Windows.Input;
+using System.Windows.Threading;
+using Spect.Net.EvalParser.Watch;
 using Spect.Net.VsPackage.Vsx;
 
 namespace Spect.Net.VsPackage.ToolWindows.Watch
@@ -22,6 +24,15 @@ namespace Spect.Net.VsPackage.ToolWindows.Watch
         {
             DataContext = Vm = vm;
             Vm.CommandLineModified += OnCommandLineModified;
+            Vm.WatchEngine.ValuesChanged += OnWatchValuesChanged;
+        }
+
+        /// <summary>
+        /// The watch engine publishes the changes on the emulation thread
+        /// </summary>
+        private void OnWatchValuesChanged(object sender, WatchValuesChangedEventArgs e)
+        {
+            DispatchOnUiThread(() => Vm.ApplyWatchChanges(e.Changes), DispatcherPriority.Background);
         }
 
         private void OnCommandLineModified(object sender, string commandText)
@@ -57,6 +68,7 @@ namespace Spect.Net.VsPackage.ToolWindows.Watch
             if (Vm != null)
             {
                 Vm.CommandLineModified -= OnCommandLineModified;
+                Vm.WatchEngine.ValuesChanged -= OnWatchValuesChanged;
             }
         }
 
@@ -1,12 +1,16 @@
 ﻿using System;
+using System.Collections.Generic;
 using System.Collections.ObjectModel;
+using System.Collections.Specialized;
 using System.Windows;
 using Antlr4.Runtime;
 using Spect.Net.CommandParser.SyntaxTree;
 using Spect.Net.EvalParser;
 using Spect.Net.EvalParser.Generated;
 using Spect.Net.EvalParser.SyntaxTree;
+using Spect.Net.EvalParser.Watch;
 using Spect.Net.SpectrumEmu.Machine;
+using Spect.Net.VsPackage.Z80Programs;
 
 namespace Spect.Net.VsPackage.ToolWindows.Watch
 {
@@ -35,6 +39,11 @@ namespace Spect.Net.VsPackage.ToolWindows.Watch
         /// </summary>
         public SymbolAwareSpectrumEvaluationContext EvalContext { get; }
 
+        /// <summary>
+        /// The engine that evaluates the watch items while the machine runs
+        /// </summary>
+        public WatchEngine WatchEngine { get; }
+
         /// <summary>
         /// The width of the label
         /// </summary>
@@ -62,7 +71,10 @@ namespace Spect.Net.VsPackage.ToolWindows.Watch
 
             LabelWidth = 100;
             EvalContext = Package.DebugEvaluationContext;
+            WatchEngine = new WatchEngine(EvalContext);
+            EvalContext.SpectrumVm.WatchEngine = WatchEngine;
             WatchItems.CollectionChanged += ItemsCollectionChanged;
+            Package.CodeManager.CompilationCompleted += OnCompilationCompleted;
         }
 
         /// <summary>
@@ -72,6 +84,11 @@ namespace Spect.Net.VsPackage.ToolWindows.Watch
         public override void Dispose()
         {
             WatchItems.CollectionChanged -= ItemsCollectionChanged;
+            Package.CodeManager.CompilationCompleted -= OnCompilationCompleted;
+            if (EvalContext.SpectrumVm.WatchEngine == WatchEngine)
+            {
+                EvalContext.SpectrumVm.WatchEngine = null;
+            }
             EvalContext.Dispose();
             base.Dispose();
         }
@@ -311,24 +328,61 @@ namespace Spect.Net.VsPackage.ToolWindows.Watch
         }
 
         /// <summary>
-        /// Set the machine status when the screen has been refreshed
+        /// Override to handle the start of the virtual machine
         /// </summary>
-        protected override void OnScreenRefreshed()
+        protected override void OnStart()
         {
-            base.OnScreenRefreshed();
-            if (ScreenRefreshCount % 10 != 0) return;
-            EvaluateWatchItems();
+            base.OnStart();
+            WatchEngine.TactInterval = Package.Options.WatchEvaluationTacts;
         }
 
         /// <summary>
-        /// Signs the changes of the WatchItems collection
+        /// Signs the changes of the WatchItems collection, and keeps the watch
+        /// engine in sync with the items
         /// </summary>
-        private void ItemsCollectionChanged(object sender, System.Collections.Specialized.NotifyCollectionChangedEventArgs e)
+        private void ItemsCollectionChanged(object sender, NotifyCollectionChangedEventArgs e)
         {
+            if (e.Action == NotifyCollectionChangedAction.Reset)
+            {
+                WatchEngine.Clear();
+                foreach (var item in WatchItems)
+                {
+                    item.WatchId = 0;
+                }
+            }
+
+            // --- Items exchanged by index are removed only when they are
+            // --- not in the collection any more
+            if (e.OldItems != null)
+            {
+                foreach (WatchItemViewModel item in e.OldItems)
+                {
+                    if (item.WatchId == 0 || WatchItems.Contains(item)) continue;
+                    WatchEngine.Remove(item.WatchId);
+                    item.WatchId = 0;
+                }
+            }
+            if (e.NewItems != null)
+            {
+                foreach (WatchItemViewModel item in e.NewItems)
+                {
+                    if (item.WatchId != 0 || item.ExpressionNode == null) continue;
+                    item.WatchId = WatchEngine.Add(item.ExpressionNode);
+                }
+            }
+
             // ReSharper disable once ExplicitCallerInfoArgument
             RaisePropertyChanged("ItemsVisible");
         }
 
+        /// <summary>
+        /// Symbol values may change with the compilation
+        /// </summary>
+        private void OnCompilationCompleted(object sender, CompilationCompletedEventArgs e)
+        {
+            WatchEngine.Invalidate();
+        }
+
         /// <summary>
         /// Renumbers the watch items
         /// </summary>
@@ -342,24 +396,33 @@ namespace Spect.Net.VsPackage.ToolWindows.Watch
         }
 
         /// <summary>
-        /// Evaluates the watch items
+        /// Evaluates the watch items whose dependencies have changed since the
+        /// last evaluation
         /// </summary>
+        /// <remarks>
+        /// The changes are published through the ValuesChanged event of the engine
+        /// </remarks>
         private void EvaluateWatchItems()
         {
-            foreach (var item in WatchItems)
+            WatchEngine.Evaluate(EvalContext.SpectrumVm.Cpu.Tacts);
+        }
+
+        /// <summary>
+        /// Updates the watch items with the changed values
+        /// </summary>
+        /// <param name="changes">Changed watch values</param>
+        public void ApplyWatchChanges(IReadOnlyList<WatchValueChange> changes)
+        {
+            foreach (var change in changes)
             {
-                try
-                {
-                    if (item.ExpressionNode == null) continue;
-                    var value = item.ExpressionNode.Evaluate(EvalContext);
-                    item.HasError = value == ExpressionValue.Error;
-                    item.Value = item.HasError 
-                        ? item.ExpressionNode.EvaluationError 
-                        : FormatWatchExpression(item.ExpressionNode, value, item.Format);
-                }
-                catch
+                foreach (var item in WatchItems)
                 {
-                    // --- This exception is intentionally ignored.
+                    if (item.WatchId != change.Id) continue;
+                    item.HasError = change.HasError;
+                    item.Value = change.HasError
+                        ? change.EvaluationError
+                        : FormatWatchValue(change.ValueType, change.Value, item.Format);
+                    break;
                 }
             }
         }
@@ -379,11 +442,23 @@ namespace Spect.Net.VsPackage.ToolWindows.Watch
             {
                 return expression.EvaluationError;
             }
+            return FormatWatchValue(expression.ValueType, exprValue, formatSpecifier);
+        }
 
+        /// <summary>
+        /// Formats a watch value
+        /// </summary>
+        /// <param name="valueType">Value type of the expression</param>
+        /// <param name="exprValue">Evaluated expression value</param>
+        /// <param name="formatSpecifier">Format specifier</param>
+        /// <returns></returns>
+        public static string FormatWatchValue(ExpressionValueType valueType, ExpressionValue exprValue,
+            string formatSpecifier)
+        {
             // --- No format provided, use default based on expression type
             if (string.IsNullOrEmpty(formatSpecifier))
             {
-                switch (expression.ValueType)
+                switch (valueType)
                 {
                     case ExpressionValueType.Bool:
                         formatSpecifier = "F";
@@ -65,7 +65,8 @@ namespace Spect.Net.VsPackage.Z80Programs
         protected override void ResetDevicesAfterLoad()
         {
             Package.MachineViewModel.SpectrumVm.BeeperDevice.Reset();
-            Package.MachineViewModel.SpectrumVm.BeeperProvider.Reset();
+            Package.MachineViewModel.SpectrumVm.BeeperProvider?.Reset();
+            Package.MachineViewModel.SpectrumVm.AudioMixerDevice?.Reset();
         }
 
         /// <summary>